@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/reg/Arena.cpp" "CMakeFiles/cRegister.dir/src/reg/Arena.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Arena.cpp.o.d"
+  "/root/repo/src/reg/BlobStore.cpp" "CMakeFiles/cRegister.dir/src/reg/BlobStore.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/BlobStore.cpp.o.d"
+  "/root/repo/src/reg/Expirer.cpp" "CMakeFiles/cRegister.dir/src/reg/Expirer.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Expirer.cpp.o.d"
+  "/root/repo/src/reg/FileLock.cpp" "CMakeFiles/cRegister.dir/src/reg/FileLock.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/FileLock.cpp.o.d"
+  "/root/repo/src/reg/Instance.cpp" "CMakeFiles/cRegister.dir/src/reg/Instance.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Instance.cpp.o.d"
+  "/root/repo/src/reg/KeyFilter.cpp" "CMakeFiles/cRegister.dir/src/reg/KeyFilter.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/KeyFilter.cpp.o.d"
+  "/root/repo/src/reg/KeyIndex.cpp" "CMakeFiles/cRegister.dir/src/reg/KeyIndex.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/KeyIndex.cpp.o.d"
+  "/root/repo/src/reg/Manager.cpp" "CMakeFiles/cRegister.dir/src/reg/Manager.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Manager.cpp.o.d"
+  "/root/repo/src/reg/Metrics.cpp" "CMakeFiles/cRegister.dir/src/reg/Metrics.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Metrics.cpp.o.d"
+  "/root/repo/src/reg/Serializer.cpp" "CMakeFiles/cRegister.dir/src/reg/Serializer.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Serializer.cpp.o.d"
+  "/root/repo/src/reg/Stamp.cpp" "CMakeFiles/cRegister.dir/src/reg/Stamp.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Stamp.cpp.o.d"
+  "/root/repo/src/reg/ThreadPool.cpp" "CMakeFiles/cRegister.dir/src/reg/ThreadPool.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/ThreadPool.cpp.o.d"
+  "/root/repo/src/reg/Tracer.cpp" "CMakeFiles/cRegister.dir/src/reg/Tracer.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Tracer.cpp.o.d"
+  "/root/repo/src/reg/ValueIndex.cpp" "CMakeFiles/cRegister.dir/src/reg/ValueIndex.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/ValueIndex.cpp.o.d"
+  "/root/repo/src/reg/ValueStream.cpp" "CMakeFiles/cRegister.dir/src/reg/ValueStream.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/ValueStream.cpp.o.d"
+  "/root/repo/src/reg/Variable.cpp" "CMakeFiles/cRegister.dir/src/reg/Variable.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Variable.cpp.o.d"
+  "/root/repo/src/reg/Watcher.cpp" "CMakeFiles/cRegister.dir/src/reg/Watcher.cpp.o" "gcc" "CMakeFiles/cRegister.dir/src/reg/Watcher.cpp.o.d"
+  "/root/repo/third_party/tinyxml2/tinyxml2.cpp" "CMakeFiles/cRegister.dir/third_party/tinyxml2/tinyxml2.cpp.o" "gcc" "CMakeFiles/cRegister.dir/third_party/tinyxml2/tinyxml2.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/lib/libcRegister.so" "/root/repo/lib/libcRegister.so.0.1.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/findKeys_bench"
+  "/root/repo/bin/findKeys_bench.pdb"
+  "CMakeFiles/findKeys_bench.dir/src/findKeys_bench.cpp.o"
+  "CMakeFiles/findKeys_bench.dir/src/findKeys_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findKeys_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
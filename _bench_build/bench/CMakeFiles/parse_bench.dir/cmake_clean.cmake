@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/parse_bench"
+  "/root/repo/bin/parse_bench.pdb"
+  "CMakeFiles/parse_bench.dir/src/parse_bench.cpp.o"
+  "CMakeFiles/parse_bench.dir/src/parse_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/register_bench"
+  "/root/repo/bin/register_bench.pdb"
+  "CMakeFiles/register_bench.dir/src/Allocations.cpp.o"
+  "CMakeFiles/register_bench.dir/src/Allocations.cpp.o.d"
+  "CMakeFiles/register_bench.dir/src/register_bench.cpp.o"
+  "CMakeFiles/register_bench.dir/src/register_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/register_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/save_bench"
+  "/root/repo/bin/save_bench.pdb"
+  "CMakeFiles/save_bench.dir/src/save_bench.cpp.o"
+  "CMakeFiles/save_bench.dir/src/save_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/save_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/stress_bench"
+  "/root/repo/bin/stress_bench.pdb"
+  "CMakeFiles/stress_bench.dir/src/stress_bench.cpp.o"
+  "CMakeFiles/stress_bench.dir/src/stress_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stress_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
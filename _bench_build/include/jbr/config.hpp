@@ -0,0 +1,15 @@
+//!
+//! @file jbr/reg/config.hpp.in
+//! @author jbruel
+//! @date 29/04/19
+//!
+
+#ifndef CREGISTER_JBR_REG_CONFIG_HPP
+# define CREGISTER_JBR_REG_CONFIG_HPP
+
+# define VERSION_MAJOR "0"
+# define VERSION_MINOR "1"
+# define VERSION_PATCH "0"
+# define VERSION "0.1.0"
+
+#endif // !CREGISTER_JBR_REG_CONFIG_HPP
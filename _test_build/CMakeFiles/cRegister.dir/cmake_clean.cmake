@@ -0,0 +1,46 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libcRegister.pdb"
+  "/root/repo/lib/libcRegister.so"
+  "/root/repo/lib/libcRegister.so.0.1.0"
+  "CMakeFiles/cRegister.dir/src/reg/Arena.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Arena.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/BlobStore.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/BlobStore.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Expirer.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Expirer.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/FileLock.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/FileLock.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Instance.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Instance.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/KeyFilter.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/KeyFilter.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/KeyIndex.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/KeyIndex.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Manager.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Manager.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Metrics.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Metrics.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Serializer.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Serializer.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Stamp.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Stamp.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/ThreadPool.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/ThreadPool.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Tracer.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Tracer.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/ValueIndex.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/ValueIndex.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/ValueStream.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/ValueStream.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Variable.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Variable.cpp.o.d"
+  "CMakeFiles/cRegister.dir/src/reg/Watcher.cpp.o"
+  "CMakeFiles/cRegister.dir/src/reg/Watcher.cpp.o.d"
+  "CMakeFiles/cRegister.dir/third_party/tinyxml2/tinyxml2.cpp.o"
+  "CMakeFiles/cRegister.dir/third_party/tinyxml2/tinyxml2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cRegister.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
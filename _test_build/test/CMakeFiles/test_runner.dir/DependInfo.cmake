@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/reg/Arena.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Arena.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Arena.cpp.o.d"
+  "/root/repo/src/reg/BlobStore.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/BlobStore.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/BlobStore.cpp.o.d"
+  "/root/repo/src/reg/Expirer.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Expirer.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Expirer.cpp.o.d"
+  "/root/repo/src/reg/FileLock.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/FileLock.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/FileLock.cpp.o.d"
+  "/root/repo/src/reg/Instance.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Instance.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Instance.cpp.o.d"
+  "/root/repo/src/reg/KeyFilter.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/KeyFilter.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/KeyFilter.cpp.o.d"
+  "/root/repo/src/reg/KeyIndex.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/KeyIndex.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/KeyIndex.cpp.o.d"
+  "/root/repo/src/reg/Manager.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Manager.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Manager.cpp.o.d"
+  "/root/repo/src/reg/Metrics.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Metrics.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Metrics.cpp.o.d"
+  "/root/repo/src/reg/Serializer.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Serializer.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Serializer.cpp.o.d"
+  "/root/repo/src/reg/Stamp.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Stamp.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Stamp.cpp.o.d"
+  "/root/repo/src/reg/ThreadPool.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/ThreadPool.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/ThreadPool.cpp.o.d"
+  "/root/repo/src/reg/Tracer.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Tracer.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Tracer.cpp.o.d"
+  "/root/repo/src/reg/ValueIndex.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/ValueIndex.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/ValueIndex.cpp.o.d"
+  "/root/repo/src/reg/ValueStream.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/ValueStream.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/ValueStream.cpp.o.d"
+  "/root/repo/src/reg/Variable.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Variable.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Variable.cpp.o.d"
+  "/root/repo/src/reg/Watcher.cpp" "test/CMakeFiles/test_runner.dir/__/src/reg/Watcher.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/src/reg/Watcher.cpp.o.d"
+  "/root/repo/third_party/tinyxml2/tinyxml2.cpp" "test/CMakeFiles/test_runner.dir/__/third_party/tinyxml2/tinyxml2.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/__/third_party/tinyxml2/tinyxml2.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Arena/Lease_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Arena/Lease_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Arena/Lease_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Expirer/schedule_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Expirer/schedule_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Expirer/schedule_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Histogram/record_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Histogram/record_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Histogram/record_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/applyRights_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/applyRights_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/applyRights_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/asyncGet_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncGet_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncGet_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/asyncSet_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncSet_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncSet_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/available_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/available_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/available_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/compareAndSet_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/compareAndSet_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/compareAndSet_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/copy_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/copy_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/copy_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/expiration_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/expiration_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/expiration_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/fetchAdd_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/fetchAdd_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/fetchAdd_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/findKeys_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/findKeys_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/findKeys_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/find_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/find_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/find_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/forEach_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/forEach_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/forEach_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/get_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/get_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/get_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/increment_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/increment_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/increment_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/isCopyable_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isCopyable_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isCopyable_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/isMovable_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isMovable_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isMovable_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/keysWithValue_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/keysWithValue_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/keysWithValue_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/memoryUsage_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/memoryUsage_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/memoryUsage_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/move_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/move_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/move_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/openValueStream_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/openValueStream_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/openValueStream_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/remove_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/remove_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/remove_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/set_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/set_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/set_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/tryGet_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/tryGet_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/tryGet_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/verify_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/verify_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/verify_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/watch_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/watch_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/watch_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Instance/writeValueStream_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/writeValueStream_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Instance/writeValueStream_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/KeyFilter/mayContain_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/KeyFilter/mayContain_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/KeyFilter/mayContain_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/acquire_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/acquire_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/acquire_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/create_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/create_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/create_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/destroy_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/destroy_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/destroy_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/exist_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/exist_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/exist_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/metrics_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/metrics_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/metrics_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/openAll_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/openAll_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/openAll_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/open_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/open_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/open_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Manager/tracing_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/tracing_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Manager/tracing_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Mask/rights_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Mask/rights_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Mask/rights_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Operation/wait_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Operation/wait_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Operation/wait_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Serializer/serialize_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Serializer/serialize_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Serializer/serialize_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/ThreadPool/post_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/ThreadPool/post_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/ThreadPool/post_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/TimerWheel/advance_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/TimerWheel/advance_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/TimerWheel/advance_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/expireAt_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/expireAt_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/expireAt_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/key_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/key_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/key_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/reaccess_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/reaccess_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/reaccess_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/read_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/read_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/read_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/rename_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/rename_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/rename_test.cpp.o.d"
+  "/root/repo/test/src/jbr/reg/Variable/update_test.cpp" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/update_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/jbr/reg/Variable/update_test.cpp.o.d"
+  "/root/repo/test/src/test_runner.cpp" "test/CMakeFiles/test_runner.dir/src/test_runner.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/test_runner.cpp.o.d"
+  "/root/repo/test/src/tinyxml2/XMLDocument/MapFile_test.cpp" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLDocument/MapFile_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLDocument/MapFile_test.cpp.o.d"
+  "/root/repo/test/src/tinyxml2/XMLNode/FirstChildElement_test.cpp" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLNode/FirstChildElement_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLNode/FirstChildElement_test.cpp.o.d"
+  "/root/repo/test/src/tinyxml2/XMLUtil/SetScanKernel_test.cpp" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLUtil/SetScanKernel_test.cpp.o" "gcc" "test/CMakeFiles/test_runner.dir/src/tinyxml2/XMLUtil/SetScanKernel_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
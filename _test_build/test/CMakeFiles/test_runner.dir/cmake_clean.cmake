@@ -0,0 +1,149 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_runner"
+  "/root/repo/bin/test_runner.pdb"
+  "CMakeFiles/test_runner.dir/__/src/reg/Arena.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Arena.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/BlobStore.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/BlobStore.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Expirer.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Expirer.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/FileLock.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/FileLock.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Instance.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Instance.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/KeyFilter.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/KeyFilter.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/KeyIndex.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/KeyIndex.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Manager.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Manager.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Metrics.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Metrics.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Serializer.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Serializer.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Stamp.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Stamp.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/ThreadPool.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/ThreadPool.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Tracer.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Tracer.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/ValueIndex.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/ValueIndex.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/ValueStream.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/ValueStream.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Variable.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Variable.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/src/reg/Watcher.cpp.o"
+  "CMakeFiles/test_runner.dir/__/src/reg/Watcher.cpp.o.d"
+  "CMakeFiles/test_runner.dir/__/third_party/tinyxml2/tinyxml2.cpp.o"
+  "CMakeFiles/test_runner.dir/__/third_party/tinyxml2/tinyxml2.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Arena/Lease_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Arena/Lease_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Expirer/schedule_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Expirer/schedule_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Histogram/record_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Histogram/record_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/applyRights_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/applyRights_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncGet_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncGet_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncSet_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/asyncSet_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/available_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/available_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/compareAndSet_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/compareAndSet_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/copy_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/copy_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/expiration_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/expiration_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/fetchAdd_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/fetchAdd_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/findKeys_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/findKeys_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/find_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/find_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/forEach_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/forEach_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/get_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/get_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/increment_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/increment_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isCopyable_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isCopyable_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isMovable_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/isMovable_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/keysWithValue_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/keysWithValue_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/memoryUsage_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/memoryUsage_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/move_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/move_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/openValueStream_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/openValueStream_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/remove_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/remove_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/set_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/set_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/tryGet_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/tryGet_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/verify_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/verify_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/watch_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/watch_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/writeValueStream_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Instance/writeValueStream_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/KeyFilter/mayContain_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/KeyFilter/mayContain_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/acquire_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/acquire_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/create_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/create_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/destroy_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/destroy_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/exist_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/exist_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/metrics_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/metrics_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/openAll_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/openAll_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/open_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/open_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/tracing_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Manager/tracing_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Mask/rights_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Mask/rights_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Operation/wait_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Operation/wait_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Serializer/serialize_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Serializer/serialize_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/ThreadPool/post_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/ThreadPool/post_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/TimerWheel/advance_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/TimerWheel/advance_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/expireAt_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/expireAt_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/key_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/key_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/reaccess_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/reaccess_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/read_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/read_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/rename_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/rename_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/update_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/jbr/reg/Variable/update_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/test_runner.cpp.o"
+  "CMakeFiles/test_runner.dir/src/test_runner.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLDocument/MapFile_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLDocument/MapFile_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLNode/FirstChildElement_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLNode/FirstChildElement_test.cpp.o.d"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLUtil/SetScanKernel_test.cpp.o"
+  "CMakeFiles/test_runner.dir/src/tinyxml2/XMLUtil/SetScanKernel_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
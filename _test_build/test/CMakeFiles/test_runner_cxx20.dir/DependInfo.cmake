@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/src/jbr/reg/Operation/co_await_test.cpp" "test/CMakeFiles/test_runner_cxx20.dir/src/jbr/reg/Operation/co_await_test.cpp.o" "gcc" "test/CMakeFiles/test_runner_cxx20.dir/src/jbr/reg/Operation/co_await_test.cpp.o.d"
+  "/root/repo/test/src/test_runner.cpp" "test/CMakeFiles/test_runner_cxx20.dir/src/test_runner.cpp.o" "gcc" "test/CMakeFiles/test_runner_cxx20.dir/src/test_runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/cRegister.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_runner_cxx20"
+  "/root/repo/bin/test_runner_cxx20.pdb"
+  "CMakeFiles/test_runner_cxx20.dir/src/jbr/reg/Operation/co_await_test.cpp.o"
+  "CMakeFiles/test_runner_cxx20.dir/src/jbr/reg/Operation/co_await_test.cpp.o.d"
+  "CMakeFiles/test_runner_cxx20.dir/src/test_runner.cpp.o"
+  "CMakeFiles/test_runner_cxx20.dir/src/test_runner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_runner_cxx20.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_test_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(RUN_TESTS "/root/repo/bin/test_runner")
+set_tests_properties(RUN_TESTS PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;64;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RUN_CXX20_TESTS "/root/repo/bin/test_runner_cxx20")
+set_tests_properties(RUN_CXX20_TESTS PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;74;add_test;/root/repo/test/CMakeLists.txt;0;")
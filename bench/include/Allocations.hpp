@@ -0,0 +1,39 @@
+//!
+//! @file Allocations.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! Process wide heap allocations counter. The global operators new and delete are replaced by Allocations.cpp, linked into the
+//! benchmark executables which extract the allocations.
+//!
+
+#ifndef JBR_CREGISTER_BENCH_ALLOCATIONS_HPP
+# define JBR_CREGISTER_BENCH_ALLOCATIONS_HPP
+
+# include <cstdint>
+
+//!
+//! @namespace jbr::bench
+//!
+namespace jbr::bench
+{
+
+    //!
+    //! @struct Allocations
+    //! @brief Heap allocations done since the process start.
+    //!
+    struct Allocations
+    {
+        std::uint64_t   mCount; //!< Number of allocations.
+        std::uint64_t   mBytes; //!< Allocated bytes.
+    };
+
+    //!
+    //! @brief Extract the heap allocations done since the process start.
+    //! @return Allocations.
+    //!
+    Allocations allocations() noexcept;
+
+}
+
+#endif //JBR_CREGISTER_BENCH_ALLOCATIONS_HPP
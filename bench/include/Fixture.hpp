@@ -0,0 +1,75 @@
+//!
+//! @file Fixture.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_BENCH_FIXTURE_HPP
+# define JBR_CREGISTER_BENCH_FIXTURE_HPP
+
+# include <jbr/reg/Manager.hpp>
+# include <jbr/reg/Variable.hpp>
+# include <functional>
+# include <fstream>
+# include <optional>
+# include <string>
+
+//!
+//! @namespace jbr::bench
+//!
+namespace jbr::bench
+{
+
+    //!
+    //! @brief Fill a new register with generated variables. The variables are written directly into the register file, from
+    //! a variable serialized by the library, so large registers are generated in a single write.
+    //! @param path Register location, replaced if existing.
+    //! @param count Number of variables.
+    //! @param key Key generator, from the variable position.
+    //! @param value Value of all the variables.
+    //! @param rights Rights of all the variables, default rights if not set.
+    //!
+    inline void fill(const std::string &path, std::size_t count, const std::function<std::string(std::size_t)> &key, const std::string &value,
+                     const std::optional<jbr::reg::var::perm::Rights> &rights = std::nullopt)
+    {
+        static const std::string    marker = "@KEY@";
+        std::string                 content;
+        std::string                 out;
+
+        if (jbr::reg::Manager::exist(path.c_str()))
+        {
+            jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+            jbr::reg::Manager::destroy(reg);
+        }
+        {
+            jbr::Register   reg = jbr::reg::Manager::create(path.c_str());
+
+            reg->set(jbr::reg::Variable(std::string(marker), std::string(value), rights));
+        }
+        {
+            std::ifstream   ifs(path);
+
+            content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+
+        std::size_t begin = content.rfind('\n', content.find("<variable>")) + 1;
+        std::size_t end = content.find('\n', content.find("</variable>")) + 1;
+        std::string variable = content.substr(begin, end - begin);
+        std::size_t position = variable.find(marker);
+
+        out.reserve(content.size() + count * (variable.size() + 16));
+        out.append(content, 0, begin);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out.append(variable, 0, position);
+            out += key(i);
+            out.append(variable, position + marker.size(), std::string::npos);
+        }
+        out.append(content, end, std::string::npos);
+        std::ofstream(path, std::ios::trunc | std::ios::binary) << out;
+    }
+
+}
+
+#endif //JBR_CREGISTER_BENCH_FIXTURE_HPP
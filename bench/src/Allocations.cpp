@@ -0,0 +1,182 @@
+//!
+//! @file Allocations.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "Allocations.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+
+namespace jbr::bench
+{
+
+    namespace
+    {
+
+        std::atomic<std::uint64_t>  allocationsCount(0); //!< Number of allocations.
+        std::atomic<std::uint64_t>  allocationsBytes(0); //!< Allocated bytes.
+
+        //!
+        //! @brief Count then do a allocation.
+        //! @param size Allocation size.
+        //! @return Allocated memory, nullptr on failure.
+        //!
+        void    *allocate(std::size_t size) noexcept
+        {
+            allocationsCount.fetch_add(1, std::memory_order_relaxed);
+            allocationsBytes.fetch_add(size, std::memory_order_relaxed);
+            return (std::malloc(size == 0 ? 1 : size));
+        }
+
+        //!
+        //! @brief Count then do a aligned allocation.
+        //! @param size Allocation size.
+        //! @param alignment Allocation alignment, a power of two.
+        //! @return Allocated memory, released with release(), nullptr on failure.
+        //!
+        void    *allocate(std::size_t size, std::align_val_t alignment) noexcept
+        {
+            std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+
+            allocationsCount.fetch_add(1, std::memory_order_relaxed);
+            allocationsBytes.fetch_add(size, std::memory_order_relaxed);
+            size = (std::max<std::size_t>(size, 1) + align - 1) / align * align; // A multiple of the alignment.
+#ifdef _WIN32
+            return (_aligned_malloc(size, align));
+#else
+            return (std::aligned_alloc(align, size));
+#endif
+        }
+
+        //!
+        //! @brief Release a aligned allocation.
+        //! @param memory Memory allocated by allocate(), may be nullptr.
+        //!
+        void    release(void *memory, std::align_val_t) noexcept
+        {
+#ifdef _WIN32
+            _aligned_free(memory);
+#else
+            std::free(memory);
+#endif
+        }
+
+    }
+
+    Allocations allocations() noexcept
+    {
+        return (Allocations{ allocationsCount.load(std::memory_order_relaxed), allocationsBytes.load(std::memory_order_relaxed) });
+    }
+
+}
+
+void    *operator new(std::size_t size)
+{
+    void    *memory = jbr::bench::allocate(size);
+
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return (memory);
+}
+
+void    *operator new[](std::size_t size)
+{
+    return (operator new(size));
+}
+
+void    *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return (jbr::bench::allocate(size));
+}
+
+void    *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return (jbr::bench::allocate(size));
+}
+
+void    *operator new(std::size_t size, std::align_val_t alignment)
+{
+    void    *memory = jbr::bench::allocate(size, alignment);
+
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return (memory);
+}
+
+void    *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return (operator new(size, alignment));
+}
+
+void    *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return (jbr::bench::allocate(size, alignment));
+}
+
+void    *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return (jbr::bench::allocate(size, alignment));
+}
+
+void    operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete[](void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+void    operator delete(void *memory, std::align_val_t alignment) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
+
+void    operator delete[](void *memory, std::align_val_t alignment) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
+
+void    operator delete(void *memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
+
+void    operator delete[](void *memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
+
+void    operator delete(void *memory, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
+
+void    operator delete[](void *memory, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    jbr::bench::release(memory, alignment);
+}
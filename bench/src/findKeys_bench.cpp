@@ -0,0 +1,69 @@
+//!
+//! @file findKeys_bench.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! Compare Instance::findKeys (trigram index) with a naive scan of all the keys. Usage : findKeys_bench [keys] [register]
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/KeyIndex.hpp>
+#include <jbr/reg/exception.hpp>
+#include "Fixture.hpp"
+#include <filesystem>
+#include <iostream>
+#include <chrono>
+#include <string>
+
+//!
+//! @brief Measure a search.
+//! @param name Search name.
+//! @param search Search to measure, return the number of matching keys.
+//!
+template <typename Search>
+static void measure(const char *name, Search &&search)
+{
+    auto        start = std::chrono::steady_clock::now();
+    std::size_t found = search();
+    auto        elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << name << " : " << found << " keys in " << elapsed.count() << " us" << std::endl;
+}
+
+int main(int ac, char **av)
+{
+    std::size_t keys = ac > 1 ? std::stoul(av[1]) : 1000000;
+    std::string path = ac > 2 ? av[2] : "./findKeys_bench.reg";
+    const char  *patterns[] = { "service.42.node.*", "*.node.99999*", "*" };
+
+    try {
+        jbr::bench::fill(path, keys, [](std::size_t i) { return ("service." + std::to_string(i % 1000) + ".node." + std::to_string(i)); }, "value");
+
+        jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+        std::cout << "register : " << keys << " keys, " << std::filesystem::file_size(path) << " bytes" << std::endl;
+        for (const char *pattern : patterns)
+        {
+            std::cout << "pattern '" << pattern << "'" << std::endl;
+            measure("  naive scan", [&reg, pattern]() {
+                jbr::reg::KeyMatcher    matcher(pattern, jbr::reg::Pattern::Glob);
+                std::size_t             found = 0;
+
+                (void)reg->forEach([&matcher, &found](const jbr::reg::VariableView &variable) {
+                    found += matcher.match(std::string(variable.mKey));
+                    return (true);
+                });
+                return (found);
+            });
+            measure("  findKeys", [&reg, pattern]() { return (reg->findKeys(pattern).size()); });
+            measure("  findKeys (cached index)", [&reg, pattern]() { return (reg->findKeys(pattern).size()); });
+        }
+        jbr::reg::Manager::destroy(reg);
+    }
+    catch (const jbr::reg::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,167 @@
+//!
+//! @file parse_bench.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! tinyxml2 parsing throughput of generated registers, for each scanning kernel (scalar, SSE2, AVX2). Results written as JSON.
+//!
+//! Usage : parse_bench [--sizes 1000,10000,...] [--values 16,1024] [--kernels scalar,sse2,avx2] [--iterations N]
+//!                     [--directory DIR] [--output FILE]
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/exception.hpp>
+#include <jbr/config.hpp>
+#include "Fixture.hpp"
+#include <tinyxml2.h>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//!
+//! @struct Options
+//! @brief Benchmark options.
+//!
+struct Options
+{
+    std::vector<std::size_t>    mSizes{ 1000, 10000, 100000 }; //!< Registers sizes, in variables.
+    std::vector<std::size_t>    mValues{ 16, 1024 }; //!< Values lengths.
+    std::vector<std::string>    mKernels{ "scalar", "sse2", "avx2" }; //!< Benchmarked scanning kernels.
+    std::size_t                 mIterations = 20; //!< Parsing per register and kernel.
+    std::string                 mDirectory = "."; //!< Registers directory.
+    std::string                 mOutput; //!< JSON output file, standard output if empty.
+};
+
+static const char   *kernels[] = { "scalar", "sse2", "avx2" }; //!< Kernels names, by tinyxml2::XMLUtil::ScanKernel.
+
+//!
+//! @brief Split a comma separated list.
+//! @param list List to split.
+//! @return List items.
+//!
+static std::vector<std::string> split(const std::string &list)
+{
+    std::vector<std::string>    items;
+    std::istringstream          iss(list);
+    std::string                 item;
+
+    while (std::getline(iss, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return (items);
+}
+
+//!
+//! @brief Parse the command line options.
+//! @param ac Arguments number.
+//! @param av Arguments.
+//! @return Benchmark options.
+//!
+static Options parse(int ac, char **av)
+{
+    Options options;
+
+    for (int i = 1; i + 1 < ac; i += 2)
+    {
+        std::string name = av[i];
+        std::string value = av[i + 1];
+
+        if (name == "--sizes" || name == "--values")
+        {
+            std::vector<std::size_t>    &list = name == "--sizes" ? options.mSizes : options.mValues;
+
+            list.clear();
+            for (const std::string &item : split(value))
+                list.push_back(std::stoul(item));
+        }
+        else if (name == "--kernels")
+            options.mKernels = split(value);
+        else if (name == "--iterations")
+            options.mIterations = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--directory")
+            options.mDirectory = value;
+        else if (name == "--output")
+            options.mOutput = value;
+        else
+            throw jbr::reg::exception("Unknown benchmark option '" + name + "'.");
+    }
+    return (options);
+}
+
+int main(int ac, char **av)
+{
+    try {
+        Options                         options = parse(ac, av);
+        tinyxml2::XMLUtil::ScanKernel   initial = tinyxml2::XMLUtil::GetScanKernel();
+        std::ostringstream              results;
+        bool                            first = true;
+
+        for (std::size_t valueLength : options.mValues)
+            for (std::size_t size : options.mSizes)
+            {
+                std::string path = options.mDirectory + "/parse_bench_" + std::to_string(valueLength) + '_' + std::to_string(size) + ".reg";
+                std::string content;
+
+                jbr::bench::fill(path, size, [](std::size_t i) { return ("variable." + std::to_string(i)); }, std::string(valueLength, 'v'));
+                {
+                    std::ifstream   ifs(path, std::ios::binary);
+
+                    content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+                }
+                for (const std::string &name : options.mKernels)
+                {
+                    auto                        kernel = std::find(std::begin(kernels), std::end(kernels), name);
+                    std::vector<std::uint64_t>  samples;
+
+                    if (kernel == std::end(kernels))
+                        throw jbr::reg::exception("Unknown scanning kernel '" + name + "'.");
+                    if (tinyxml2::XMLUtil::SetScanKernel(static_cast<tinyxml2::XMLUtil::ScanKernel>(kernel - std::begin(kernels))) !=
+                        static_cast<tinyxml2::XMLUtil::ScanKernel>(kernel - std::begin(kernels)))
+                    {
+                        std::cerr << name << " : not supported, skipped" << std::endl;
+                        continue;
+                    }
+                    for (std::size_t i = 0; i < options.mIterations; ++i)
+                    {
+                        tinyxml2::XMLDocument   document;
+                        auto                    start = std::chrono::steady_clock::now();
+
+                        if (document.Parse(content.data(), content.size()) != tinyxml2::XML_SUCCESS)
+                            throw jbr::reg::exception("Impossible to parse the generated register " + path + '.');
+                        samples.push_back(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+                    }
+                    std::sort(samples.begin(), samples.end());
+
+                    std::uint64_t   median = samples[samples.size() / 2];
+
+                    results << (first ? "\n" : ",\n") << "    { \"kernel\": \"" << name << "\", \"variables\": " << size << ", \"value_length\": " << valueLength
+                            << ", \"register_bytes\": " << content.size() << ", \"iterations\": " << samples.size() << ", \"min_ns\": " << samples.front()
+                            << ", \"p50_ns\": " << median << ", \"mb_per_sec\": " << (median == 0 ? 0.0 : static_cast<double>(content.size()) * 1e3 / static_cast<double>(median)) << " }";
+                    first = false;
+                    std::cerr << valueLength << ' ' << size << ' ' << name << " : " << median << " ns" << std::endl;
+                }
+
+                jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+                jbr::reg::Manager::destroy(reg);
+            }
+        tinyxml2::XMLUtil::SetScanKernel(initial);
+
+        std::string json = "{\n  \"benchmark\": \"parse_bench\",\n  \"version\": \"" + std::string(VERSION) + "\",\n  \"results\": [" + results.str() + "\n  ]\n}\n";
+
+        if (options.mOutput.empty())
+            std::cout << json;
+        else
+            std::ofstream(options.mOutput, std::ios::trunc) << json;
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return (1);
+    }
+    return (0);
+}
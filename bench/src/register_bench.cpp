@@ -0,0 +1,342 @@
+//!
+//! @file register_bench.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! Register operations micro-benchmarks, results written as JSON.
+//!
+//! Usage : register_bench [--sizes 10,100,...] [--layouts small,large,rights] [--operations get,set,...] [--iterations N]
+//!                        [--budget MS] [--directory DIR] [--output FILE]
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <jbr/config.hpp>
+#include "Fixture.hpp"
+#include "Allocations.hpp"
+#include <unordered_map>
+#include <functional>
+#include <filesystem>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//!
+//! @struct Layout
+//! @brief Variables layout of a benchmarked register.
+//!
+struct Layout
+{
+    std::string                                 mName; //!< Layout name.
+    std::size_t                                 mKeyLength; //!< Keys length.
+    std::size_t                                 mValueLength; //!< Values length.
+    std::optional<jbr::reg::var::perm::Rights>  mRights; //!< Variables rights, default rights if not set.
+};
+
+//!
+//! @struct Options
+//! @brief Benchmark options.
+//!
+struct Options
+{
+    std::vector<std::size_t>    mSizes{ 10, 100, 1000, 10000, 100000, 1000000 }; //!< Registers sizes, in variables.
+    std::vector<std::string>    mLayouts{ "small", "large", "rights" }; //!< Variables layouts.
+    std::vector<std::string>    mOperations{ "get", "set", "available", "remove", "copy", "move", "open" }; //!< Benchmarked operations.
+    std::size_t                 mIterations = 100; //!< Maximum iterations per operation.
+    std::chrono::milliseconds   mBudget{ 2000 }; //!< Maximum duration per operation, at least one iteration is run.
+    std::string                 mDirectory = "."; //!< Registers directory.
+    std::string                 mOutput; //!< JSON output file, standard output if empty.
+};
+
+//!
+//! @struct Result
+//! @brief Measures of a operation.
+//!
+struct Result
+{
+    std::string                 mOperation; //!< Operation name.
+    std::size_t                 mSize; //!< Register size, in variables.
+    const Layout                *mLayout; //!< Variables layout.
+    std::uintmax_t              mRegisterBytes; //!< Register file size.
+    std::size_t                 mLoadedBytes; //!< Memory held by the loaded register.
+    std::vector<std::uint64_t>  mSamples; //!< Operations latencies, in nanoseconds.
+    std::uint64_t               mBytesRead; //!< Bytes read by all the operations.
+    std::uint64_t               mBytesWritten; //!< Bytes written by all the operations.
+    jbr::bench::Allocations     mAllocations; //!< Heap allocations done by all the operations.
+};
+
+//!
+//! @brief Extract the bytes read and written by the process (Linux only).
+//! @param read Bytes read.
+//! @param written Bytes written.
+//!
+static void io(std::uint64_t &read, std::uint64_t &written)
+{
+    std::ifstream   ifs("/proc/self/io");
+    std::string     name;
+    std::uint64_t   value = 0;
+
+    read = 0;
+    written = 0;
+    while (ifs >> name >> value)
+    {
+        if (name == "rchar:")
+            read = value;
+        else if (name == "wchar:")
+            written = value;
+    }
+}
+
+//!
+//! @brief Split a comma separated list.
+//! @param list List to split.
+//! @return List items.
+//!
+static std::vector<std::string> split(const std::string &list)
+{
+    std::vector<std::string>    items;
+    std::istringstream          iss(list);
+    std::string                 item;
+
+    while (std::getline(iss, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return (items);
+}
+
+//!
+//! @brief Generate the key of a variable.
+//! @param position Variable position.
+//! @param length Key length, extended if too short for the position.
+//! @return Variable key.
+//!
+static std::string key(std::size_t position, std::size_t length)
+{
+    std::string digits = std::to_string(position);
+
+    return (digits.size() >= length ? digits : std::string(length - digits.size(), 'k') + digits);
+}
+
+//!
+//! @brief Run a operation until the iterations or the time budget are reached.
+//! @param result Operation result to fill.
+//! @param options Benchmark options.
+//! @param prepare Not measured preparation, called before each iteration with the iteration number.
+//! @param operation Measured operation, called with the iteration number.
+//!
+static void run(Result &result, const Options &options, const std::function<void(std::size_t)> &prepare, const std::function<void(std::size_t)> &operation)
+{
+    auto    deadline = std::chrono::steady_clock::now() + options.mBudget;
+
+    result.mBytesRead = 0;
+    result.mBytesWritten = 0;
+    result.mAllocations = jbr::bench::Allocations{ 0, 0 };
+    for (std::size_t i = 0; i < options.mIterations && (i == 0 || std::chrono::steady_clock::now() < deadline); ++i)
+    {
+        std::uint64_t   readBefore = 0;
+        std::uint64_t   writtenBefore = 0;
+        std::uint64_t   readAfter = 0;
+        std::uint64_t   writtenAfter = 0;
+
+        prepare(i);
+        io(readBefore, writtenBefore);
+
+        jbr::bench::Allocations allocationsBefore = jbr::bench::allocations();
+        auto                    start = std::chrono::steady_clock::now();
+
+        operation(i);
+
+        auto                    elapsed = std::chrono::steady_clock::now() - start;
+        jbr::bench::Allocations allocationsAfter = jbr::bench::allocations();
+
+        io(readAfter, writtenAfter);
+        result.mSamples.push_back(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        result.mBytesRead += readAfter - readBefore;
+        result.mBytesWritten += writtenAfter - writtenBefore;
+        result.mAllocations.mCount += allocationsAfter.mCount - allocationsBefore.mCount;
+        result.mAllocations.mBytes += allocationsAfter.mBytes - allocationsBefore.mBytes;
+    }
+}
+
+//!
+//! @brief Benchmark a operation on a register.
+//! @param path Benchmarked register location.
+//! @param operation Operation name.
+//! @param size Register size, in variables.
+//! @param layout Variables layout.
+//! @param options Benchmark options.
+//! @return Operation measures.
+//!
+static Result benchmark(const std::string &path, const std::string &operation, std::size_t size, const Layout &layout, const Options &options)
+{
+    jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+    Result          result{ operation, size, &layout, std::filesystem::file_size(path), reg->memoryUsage().loaded(), {}, 0, 0, { 0, 0 } };
+    std::string     value(layout.mValueLength, 'w');
+    std::string     other = path + ".other";
+    auto            nothing = [](std::size_t) {};
+    auto            pick = [size, &layout](std::size_t i) { return (key((i * 2654435761u) % size, layout.mKeyLength)); };
+
+    if (operation == "get")
+        run(result, options, nothing, [&reg, &pick](std::size_t i) { (void)reg->get(pick(i).c_str()); });
+    else if (operation == "set")
+        run(result, options, nothing, [&reg, &pick, &value, &layout](std::size_t i) {
+            reg->set(jbr::reg::Variable(pick(i), std::string(value), layout.mRights));
+        });
+    else if (operation == "available")
+        run(result, options, nothing, [&reg, &pick](std::size_t i) { (void)reg->available(i % 2 == 0 ? pick(i).c_str() : "missing"); });
+    else if (operation == "remove")
+        run(result, options, [&reg, &value, &layout](std::size_t) { reg->set(jbr::reg::Variable("removed", std::string(value), layout.mRights)); },
+            [&reg](std::size_t) { reg->remove("removed"); });
+    else if (operation == "copy")
+        run(result, options, [&other](std::size_t) { std::filesystem::remove(other); }, [&reg, &other](std::size_t) { reg->copy(other.c_str()); });
+    else if (operation == "move")
+    {
+        run(result, options, nothing, [&reg, &path, &other](std::size_t i) { reg->move(i % 2 == 0 ? other.c_str() : path.c_str()); });
+        if (result.mSamples.size() % 2 == 1)
+            reg->move(path.c_str());
+    }
+    else if (operation == "open")
+        run(result, options, nothing, [&path](std::size_t) { (void)jbr::reg::Manager::open(path.c_str()); });
+    else
+        throw jbr::reg::exception("Unknown benchmark operation '" + operation + "'.");
+    std::filesystem::remove(other);
+    return (result);
+}
+
+//!
+//! @brief Extract a percentile of the sorted latencies (nearest rank).
+//! @param samples Sorted latencies.
+//! @param percentile Percentile, between 0 and 100.
+//! @return Latency, in nanoseconds.
+//!
+static std::uint64_t percentile(const std::vector<std::uint64_t> &samples, double percentile)
+{
+    std::size_t rank = static_cast<std::size_t>(percentile / 100.0 * static_cast<double>(samples.size()) + 0.999999);
+
+    return (samples[std::min(std::max<std::size_t>(rank, 1), samples.size()) - 1]);
+}
+
+//!
+//! @brief Write the results as JSON.
+//! @param os Output stream.
+//! @param results Operations results.
+//!
+static void write(std::ostream &os, std::vector<Result> &results)
+{
+    os << "{\n  \"benchmark\": \"register_bench\",\n  \"version\": \"" << VERSION << "\",\n  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        Result          &result = results[i];
+        std::uint64_t   total = 0;
+        std::size_t     count = result.mSamples.size();
+
+        for (std::uint64_t sample : result.mSamples)
+            total += sample;
+        std::sort(result.mSamples.begin(), result.mSamples.end());
+        os << (i == 0 ? "\n" : ",\n") << "    { \"operation\": \"" << result.mOperation << "\", \"variables\": " << result.mSize
+           << ", \"layout\": \"" << result.mLayout->mName << "\", \"key_length\": " << result.mLayout->mKeyLength
+           << ", \"value_length\": " << result.mLayout->mValueLength << ", \"rights\": \"" << (result.mLayout->mRights ? "custom" : "default")
+           << "\", \"register_bytes\": " << result.mRegisterBytes << ", \"loaded_bytes\": " << result.mLoadedBytes << ", \"iterations\": " << count
+           << ", \"ops_per_sec\": " << (total == 0 ? 0.0 : static_cast<double>(count) * 1e9 / static_cast<double>(total))
+           << ", \"mean_ns\": " << total / count << ", \"p50_ns\": " << percentile(result.mSamples, 50) << ", \"p99_ns\": " << percentile(result.mSamples, 99)
+           << ", \"bytes_read_per_op\": " << result.mBytesRead / count << ", \"bytes_written_per_op\": " << result.mBytesWritten / count
+           << ", \"allocations_per_op\": " << result.mAllocations.mCount / count << ", \"allocated_bytes_per_op\": " << result.mAllocations.mBytes / count << " }";
+    }
+    os << "\n  ]\n}" << std::endl;
+}
+
+//!
+//! @brief Parse the command line options.
+//! @param ac Arguments number.
+//! @param av Arguments.
+//! @return Benchmark options.
+//!
+static Options parse(int ac, char **av)
+{
+    Options options;
+
+    for (int i = 1; i + 1 < ac; i += 2)
+    {
+        std::string name = av[i];
+        std::string value = av[i + 1];
+
+        if (name == "--sizes")
+        {
+            options.mSizes.clear();
+            for (const std::string &size : split(value))
+                options.mSizes.push_back(std::stoul(size));
+        }
+        else if (name == "--layouts")
+            options.mLayouts = split(value);
+        else if (name == "--operations")
+            options.mOperations = split(value);
+        else if (name == "--iterations")
+            options.mIterations = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--budget")
+            options.mBudget = std::chrono::milliseconds(std::stoul(value));
+        else if (name == "--directory")
+            options.mDirectory = value;
+        else if (name == "--output")
+            options.mOutput = value;
+        else
+            throw jbr::reg::exception("Unknown benchmark option '" + name + "'.");
+    }
+    return (options);
+}
+
+int main(int ac, char **av)
+{
+    const std::unordered_map<std::string, Layout>   layouts{
+        { "small", Layout{ "small", 16, 16, std::nullopt } },
+        { "large", Layout{ "large", 128, 1024, std::nullopt } },
+        { "rights", Layout{ "rights", 16, 16, jbr::reg::var::perm::Rights(true, true, true, false, false, true) } }
+    };
+    std::vector<Result>                             results;
+
+    try {
+        Options options = parse(ac, av);
+
+        for (const std::string &name : options.mLayouts)
+        {
+            auto    layout = layouts.find(name);
+
+            if (layout == layouts.end())
+                throw jbr::reg::exception("Unknown benchmark layout '" + name + "'.");
+            for (std::size_t size : options.mSizes)
+            {
+                std::string path = options.mDirectory + "/register_bench_" + name + '_' + std::to_string(size) + ".reg";
+
+                jbr::bench::fill(path, size, [&layout](std::size_t i) { return (key(i, layout->second.mKeyLength)); },
+                                 std::string(layout->second.mValueLength, 'v'), layout->second.mRights);
+                for (const std::string &operation : options.mOperations)
+                {
+                    results.push_back(benchmark(path, operation, size, layout->second, options));
+                    std::cerr << name << ' ' << size << ' ' << operation << " : " << results.back().mSamples.size() << " iterations" << std::endl;
+                }
+
+                jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+                jbr::reg::Manager::destroy(reg);
+            }
+        }
+        if (options.mOutput.empty())
+            write(std::cout, results);
+        else
+        {
+            std::ofstream   ofs(options.mOutput, std::ios::trunc);
+
+            write(ofs, results);
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,206 @@
+//!
+//! @file save_bench.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! Register saving throughput : tinyxml2 SaveFile, tinyxml2 printing into memory then writing, and the streaming serializer,
+//! with the texts untouched since the parsing or all accessed. Results written as JSON.
+//!
+//! Usage : save_bench [--sizes 1000,10000,...] [--values 16,1024] [--iterations N] [--directory DIR] [--output FILE]
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Serializer.hpp>
+#include <jbr/reg/exception.hpp>
+#include <jbr/config.hpp>
+#include "Fixture.hpp"
+#include <tinyxml2.h>
+#include <filesystem>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//!
+//! @struct Options
+//! @brief Benchmark options.
+//!
+struct Options
+{
+    std::vector<std::size_t>    mSizes{ 1000, 10000, 100000 }; //!< Registers sizes, in variables.
+    std::vector<std::size_t>    mValues{ 16, 1024 }; //!< Values lengths.
+    std::size_t                 mIterations = 10; //!< Saving per register and method.
+    std::string                 mDirectory = "."; //!< Registers directory.
+    std::string                 mOutput; //!< JSON output file, standard output if empty.
+};
+
+static const char   *methods[] = { "savefile", "printer", "serializer", "serializer_accessed" }; //!< Benchmarked saving methods.
+
+//!
+//! @brief Split a comma separated list.
+//! @param list List to split.
+//! @return List items.
+//!
+static std::vector<std::string> split(const std::string &list)
+{
+    std::vector<std::string>    items;
+    std::istringstream          iss(list);
+    std::string                 item;
+
+    while (std::getline(iss, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return (items);
+}
+
+//!
+//! @brief Parse the command line options.
+//! @param ac Arguments number.
+//! @param av Arguments.
+//! @return Benchmark options.
+//!
+static Options parse(int ac, char **av)
+{
+    Options options;
+
+    for (int i = 1; i + 1 < ac; i += 2)
+    {
+        std::string name = av[i];
+        std::string value = av[i + 1];
+
+        if (name == "--sizes" || name == "--values")
+        {
+            std::vector<std::size_t>    &list = name == "--sizes" ? options.mSizes : options.mValues;
+
+            list.clear();
+            for (const std::string &item : split(value))
+                list.push_back(std::stoul(item));
+        }
+        else if (name == "--iterations")
+            options.mIterations = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--directory")
+            options.mDirectory = value;
+        else if (name == "--output")
+            options.mOutput = value;
+        else
+            throw jbr::reg::exception("Unknown benchmark option '" + name + "'.");
+    }
+    return (options);
+}
+
+//!
+//! @brief Access all the texts of a document, as the register operations do on the values they read.
+//! @param node First node to access.
+//!
+static void access(const tinyxml2::XMLNode *node)
+{
+    for (; node != nullptr; node = node->NextSibling())
+    {
+        (void)node->Value();
+        access(node->FirstChild());
+    }
+}
+
+//!
+//! @brief Save a document with a method.
+//! @param document Document to save.
+//! @param method Saving method.
+//! @param path Saved file location.
+//!
+static void save(tinyxml2::XMLDocument &document, const std::string &method, const std::string &path)
+{
+    if (method == "savefile")
+    {
+        if (document.SaveFile(path.c_str()) != tinyxml2::XML_SUCCESS)
+            throw jbr::reg::exception("Impossible to save " + path + '.');
+    }
+    else if (method == "printer")
+    {
+        tinyxml2::XMLPrinter    printer;
+
+        document.Print(&printer);
+        if (!std::ofstream(path, std::ios::binary | std::ios::trunc).write(printer.CStr(), printer.CStrSize() - 1))
+            throw jbr::reg::exception("Impossible to save " + path + '.');
+    }
+    else
+    {
+        jbr::reg::Serializer    serializer(path);
+
+        serializer.serialize(document);
+        serializer.finish();
+    }
+}
+
+int main(int ac, char **av)
+{
+    try {
+        Options             options = parse(ac, av);
+        std::ostringstream  results;
+        bool                first = true;
+
+        for (std::size_t valueLength : options.mValues)
+            for (std::size_t size : options.mSizes)
+            {
+                std::string path = options.mDirectory + "/save_bench_" + std::to_string(valueLength) + '_' + std::to_string(size) + ".reg";
+                std::string target = path + ".saved";
+                std::string content;
+
+                jbr::bench::fill(path, size, [](std::size_t i) { return ("variable." + std::to_string(i)); }, std::string(valueLength, 'v') + "&<>");
+                {
+                    std::ifstream   ifs(path, std::ios::binary);
+
+                    content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+                }
+                for (const char *method : methods)
+                {
+                    std::vector<std::uint64_t>  samples;
+
+                    for (std::size_t i = 0; i < options.mIterations; ++i)
+                    {
+                        tinyxml2::XMLDocument   document;
+
+                        if (document.Parse(content.data(), content.size()) != tinyxml2::XML_SUCCESS)
+                            throw jbr::reg::exception("Impossible to parse the generated register " + path + '.');
+                        if (std::string(method) == "serializer_accessed")
+                            access(document.FirstChild());
+
+                        auto    start = std::chrono::steady_clock::now();
+
+                        save(document, method, target);
+                        samples.push_back(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+                    }
+                    std::sort(samples.begin(), samples.end());
+
+                    std::uint64_t   median = samples[samples.size() / 2];
+                    std::size_t     bytes = static_cast<std::size_t>(std::filesystem::file_size(target));
+
+                    results << (first ? "\n" : ",\n") << "    { \"method\": \"" << method << "\", \"variables\": " << size << ", \"value_length\": " << valueLength
+                            << ", \"bytes_written\": " << bytes << ", \"iterations\": " << samples.size() << ", \"min_ns\": " << samples.front()
+                            << ", \"p50_ns\": " << median << ", \"mb_per_sec\": " << (median == 0 ? 0.0 : static_cast<double>(bytes) * 1e3 / static_cast<double>(median)) << " }";
+                    first = false;
+                    std::cerr << valueLength << ' ' << size << ' ' << method << " : " << median << " ns" << std::endl;
+                }
+                std::filesystem::remove(target);
+
+                jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+                jbr::reg::Manager::destroy(reg);
+            }
+
+        std::string json = "{\n  \"benchmark\": \"save_bench\",\n  \"version\": \"" + std::string(VERSION) + "\",\n  \"results\": [" + results.str() + "\n  ]\n}\n";
+
+        if (options.mOutput.empty())
+            std::cout << json;
+        else
+            std::ofstream(options.mOutput, std::ios::trunc) << json;
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return (1);
+    }
+    return (0);
+}
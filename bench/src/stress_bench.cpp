@@ -0,0 +1,488 @@
+//!
+//! @file stress_bench.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+//! Concurrent access stress : a mix of get/set/available/remove/increment run by N threads in M processes on a shared
+//! register. Reports throughput and tail latencies, then checks the lost updates (shared counter) and the corruptions
+//! (values checksums, register verification). Results written as JSON, the exit code is 2 if a issue is detected.
+//!
+//! Usage : stress_bench [--threads N] [--processes M] [--duration MS] [--keys K] [--mix get:50,set:25,...]
+//!                      [--directory DIR] [--output FILE]
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <jbr/config.hpp>
+#include <filesystem>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <array>
+
+#ifndef _WIN32
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+//!
+//! @enum Kind
+//! @brief Stressed operations.
+//!
+enum Kind : std::size_t
+{
+    Get = 0, //!< Instance::tryGet, the value checksum is verified.
+    Set, //!< Instance::set.
+    Available, //!< Instance::available.
+    Remove, //!< Instance::remove.
+    Increment, //!< Instance::increment of the shared counter.
+    Kinds //!< Number of operations.
+};
+
+static const char   *names[Kinds] = { "get", "set", "available", "remove", "increment" }; //!< Operations names.
+static const char   *counter = "stress.counter"; //!< Shared counter key.
+
+//!
+//! @struct Options
+//! @brief Stress options.
+//!
+struct Options
+{
+    std::size_t                 mThreads = 4; //!< Threads per process.
+    std::size_t                 mProcesses = 1; //!< Processes.
+    std::chrono::milliseconds   mDuration{ 2000 }; //!< Stress duration.
+    std::size_t                 mKeys = 64; //!< Number of shared keys.
+    std::array<unsigned, Kinds> mMix{ 50, 25, 15, 5, 5 }; //!< Operations weights.
+    std::string                 mDirectory = "."; //!< Register directory.
+    std::string                 mOutput; //!< JSON output file, standard output if empty.
+};
+
+//!
+//! @struct Stats
+//! @brief Measures of a operation, for a thread, a process or all of them.
+//!
+struct Stats
+{
+    std::vector<std::uint64_t>  mSamples; //!< Operations latencies, in nanoseconds.
+    std::uint64_t               mMisses = 0; //!< Operations on a missing variable.
+    std::uint64_t               mErrors = 0; //!< Operations failed for a other reason.
+    std::uint64_t               mCorruptions = 0; //!< Values read with a invalid checksum, or unreadable register.
+};
+
+using Report = std::array<Stats, Kinds>;
+
+//!
+//! @brief Compute the checksum of a value (FNV-1a, 32 bits).
+//! @param data Checksummed data.
+//! @return Checksum, in hexadecimal.
+//!
+static std::string checksum(const std::string &data)
+{
+    std::uint32_t       hash = 2166136261u;
+    std::ostringstream  oss;
+
+    for (unsigned char c : data)
+        hash = (hash ^ c) * 16777619u;
+    oss << std::hex << hash;
+    return (oss.str());
+}
+
+//!
+//! @brief Build a value, writer identity followed by its checksum.
+//! @param writer Writer identity.
+//! @return Value.
+//!
+static std::string value(const std::string &writer)
+{
+    return (writer + '#' + checksum(writer));
+}
+
+//!
+//! @brief Check a value checksum.
+//! @param value Value to check.
+//! @return Validity.
+//!
+static bool valid(const std::string &value)
+{
+    std::size_t separator = value.rfind('#');
+
+    return (separator != std::string::npos && value.substr(separator + 1) == checksum(value.substr(0, separator)));
+}
+
+//!
+//! @brief Check if a exception is a miss.
+//! @param e Raised exception.
+//! @return Miss status.
+//!
+static bool miss(const jbr::reg::exception &e)
+{
+    return (std::string(e.what()).rfind("No variable named", 0) == 0);
+}
+
+//!
+//! @brief Stress the register from the current thread until the deadline.
+//! @param path Register location.
+//! @param options Stress options.
+//! @param writer Thread identity, process and thread index.
+//! @param start Start time, shared by all the processes.
+//! @param report Thread measures.
+//! @param increments Successful increments of the shared counter.
+//!
+static void stress(const std::string &path, const Options &options, const std::string &writer, std::chrono::system_clock::time_point start,
+                   Report &report, std::uint64_t &increments)
+{
+    jbr::reg::Instance                          reg(path.c_str());
+    std::mt19937_64                             random(std::hash<std::string>{}(writer));
+    std::discrete_distribution<std::size_t>     kinds(options.mMix.begin(), options.mMix.end());
+    std::uniform_int_distribution<std::size_t>  keys(0, options.mKeys - 1);
+    std::chrono::steady_clock::time_point       deadline;
+
+    std::this_thread::sleep_until(start);
+    deadline = std::chrono::steady_clock::now() + options.mDuration;
+    for (std::uint64_t sequence = 0; std::chrono::steady_clock::now() < deadline; ++sequence)
+    {
+        std::size_t                             kind = kinds(random);
+        std::string                             key = "stress." + std::to_string(keys(random));
+        Stats                                   &stats = report[kind];
+        std::chrono::steady_clock::time_point   begin = std::chrono::steady_clock::now();
+
+        try {
+            switch (kind)
+            {
+                case Get:
+                {
+                    std::optional<jbr::reg::Variable>   variable;
+                    jbr::reg::Error                     err = reg.tryGet(key.c_str(), variable);
+
+                    if (err == jbr::reg::Error::NotFound)
+                        ++stats.mMisses;
+                    else if (err != jbr::reg::Error::None || !valid(variable->read()))
+                        ++stats.mCorruptions;
+                    break;
+                }
+                case Set:
+                    reg.set(jbr::reg::Variable(std::string(key), value(writer + '.' + std::to_string(sequence))));
+                    break;
+                case Available:
+                    (void)reg.available(key.c_str());
+                    break;
+                case Remove:
+                    reg.remove(key.c_str());
+                    break;
+                default:
+                    (void)reg.increment(counter);
+                    ++increments;
+                    break;
+            }
+        }
+        catch (const jbr::reg::exception &e) {
+            ++(miss(e) ? stats.mMisses : stats.mErrors);
+        }
+        stats.mSamples.push_back(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count()));
+    }
+}
+
+//!
+//! @brief Run the threads of the current process.
+//! @param path Register location.
+//! @param options Stress options.
+//! @param process Process index.
+//! @param start Start time, shared by all the processes.
+//! @param increments Successful increments of the shared counter, by the process.
+//! @return Process measures.
+//!
+static Report run(const std::string &path, const Options &options, std::size_t process, std::chrono::system_clock::time_point start,
+                  std::uint64_t &increments)
+{
+    std::vector<Report>         reports(options.mThreads);
+    std::vector<std::uint64_t>  threadIncrements(options.mThreads, 0);
+    std::vector<std::thread>    threads;
+    Report                      report;
+
+    for (std::size_t i = 0; i < options.mThreads; ++i)
+        threads.emplace_back([&, i]() {
+            stress(path, options, std::to_string(process) + '.' + std::to_string(i), start, reports[i], threadIncrements[i]);
+        });
+    for (std::thread &thread : threads)
+        thread.join();
+    increments = 0;
+    for (std::size_t i = 0; i < options.mThreads; ++i)
+    {
+        increments += threadIncrements[i];
+        for (std::size_t kind = 0; kind < Kinds; ++kind)
+        {
+            report[kind].mSamples.insert(report[kind].mSamples.end(), reports[i][kind].mSamples.begin(), reports[i][kind].mSamples.end());
+            report[kind].mMisses += reports[i][kind].mMisses;
+            report[kind].mErrors += reports[i][kind].mErrors;
+            report[kind].mCorruptions += reports[i][kind].mCorruptions;
+        }
+    }
+    return (report);
+}
+
+//!
+//! @brief Save the measures of a process, to be merged by the parent process.
+//! @param path Measures file.
+//! @param report Process measures.
+//! @param increments Successful increments of the shared counter.
+//!
+static void save(const std::string &path, const Report &report, std::uint64_t increments)
+{
+    std::ofstream   ofs(path, std::ios::trunc);
+
+    ofs << increments << '\n';
+    for (const Stats &stats : report)
+    {
+        ofs << stats.mMisses << ' ' << stats.mErrors << ' ' << stats.mCorruptions << ' ' << stats.mSamples.size();
+        for (std::uint64_t sample : stats.mSamples)
+            ofs << ' ' << sample;
+        ofs << '\n';
+    }
+}
+
+//!
+//! @brief Merge the measures saved by a process.
+//! @param path Measures file.
+//! @param report Merged measures.
+//! @param increments Merged successful increments of the shared counter.
+//!
+static void merge(const std::string &path, Report &report, std::uint64_t &increments)
+{
+    std::ifstream   ifs(path);
+    std::uint64_t   processIncrements = 0;
+
+    if (!(ifs >> processIncrements))
+        throw jbr::reg::exception("Impossible to read the stress measures " + path + ", the process failed.");
+    increments += processIncrements;
+    for (Stats &stats : report)
+    {
+        std::uint64_t   misses = 0;
+        std::uint64_t   errors = 0;
+        std::uint64_t   corruptions = 0;
+        std::size_t     count = 0;
+
+        ifs >> misses >> errors >> corruptions >> count;
+        stats.mMisses += misses;
+        stats.mErrors += errors;
+        stats.mCorruptions += corruptions;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint64_t   sample = 0;
+
+            ifs >> sample;
+            stats.mSamples.push_back(sample);
+        }
+    }
+    if (!ifs)
+        throw jbr::reg::exception("Impossible to read the stress measures " + path + ", the file is truncated.");
+}
+
+//!
+//! @brief Extract a percentile of the sorted latencies (nearest rank).
+//! @param samples Sorted latencies.
+//! @param percentile Percentile, between 0 and 100.
+//! @return Latency, in nanoseconds, 0 if empty.
+//!
+static std::uint64_t percentile(const std::vector<std::uint64_t> &samples, double percentile)
+{
+    std::size_t rank = static_cast<std::size_t>(percentile / 100.0 * static_cast<double>(samples.size()) + 0.999999);
+
+    return (samples.empty() ? 0 : samples[std::min(std::max<std::size_t>(rank, 1), samples.size()) - 1]);
+}
+
+//!
+//! @brief Parse the command line options.
+//! @param ac Arguments number.
+//! @param av Arguments.
+//! @return Stress options.
+//!
+static Options parse(int ac, char **av)
+{
+    Options options;
+
+    for (int i = 1; i + 1 < ac; i += 2)
+    {
+        std::string name = av[i];
+        std::string value = av[i + 1];
+
+        if (name == "--threads")
+            options.mThreads = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--processes")
+            options.mProcesses = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--duration")
+            options.mDuration = std::chrono::milliseconds(std::stoul(value));
+        else if (name == "--keys")
+            options.mKeys = std::max<std::size_t>(std::stoul(value), 1);
+        else if (name == "--mix")
+        {
+            std::istringstream  iss(value);
+            std::string         item;
+
+            options.mMix.fill(0);
+            while (std::getline(iss, item, ','))
+            {
+                std::size_t separator = item.find(':');
+                auto        kind = std::find(std::begin(names), std::end(names), item.substr(0, separator));
+
+                if (separator == std::string::npos || kind == std::end(names))
+                    throw jbr::reg::exception("Invalid operations mix item '" + item + "', expected <operation>:<weight>.");
+                options.mMix[static_cast<std::size_t>(kind - std::begin(names))] = static_cast<unsigned>(std::stoul(item.substr(separator + 1)));
+            }
+            if (std::all_of(options.mMix.begin(), options.mMix.end(), [](unsigned weight) { return (weight == 0); }))
+                throw jbr::reg::exception("Invalid operations mix, all the weights are null.");
+        }
+        else if (name == "--directory")
+            options.mDirectory = value;
+        else if (name == "--output")
+            options.mOutput = value;
+        else
+            throw jbr::reg::exception("Unknown stress option '" + name + "'.");
+    }
+#ifdef _WIN32
+    if (options.mProcesses > 1)
+        throw jbr::reg::exception("Multiple processes stress is not supported on this platform.");
+#endif
+    return (options);
+}
+
+//!
+//! @brief Write the results as JSON.
+//! @param os Output stream.
+//! @param options Stress options.
+//! @param report Merged measures.
+//! @param lost Lost counter updates.
+//! @param corruptions Corruptions found after the stress.
+//!
+static void write(std::ostream &os, const Options &options, Report &report, std::int64_t lost, std::uint64_t corruptions)
+{
+    double          seconds = std::chrono::duration<double>(options.mDuration).count();
+    std::uint64_t   total = 0;
+
+    for (const Stats &stats : report)
+        total += stats.mSamples.size();
+    os << "{\n  \"benchmark\": \"stress_bench\",\n  \"version\": \"" << VERSION << "\",\n  \"threads\": " << options.mThreads
+       << ",\n  \"processes\": " << options.mProcesses << ",\n  \"duration_ms\": " << options.mDuration.count() << ",\n  \"keys\": " << options.mKeys
+       << ",\n  \"operations\": " << total << ",\n  \"ops_per_sec\": " << (seconds == 0 ? 0.0 : static_cast<double>(total) / seconds)
+       << ",\n  \"lost_updates\": " << lost << ",\n  \"corruptions\": " << corruptions << ",\n  \"results\": [";
+    for (std::size_t kind = 0; kind < Kinds; ++kind)
+    {
+        Stats   &stats = report[kind];
+
+        std::sort(stats.mSamples.begin(), stats.mSamples.end());
+        os << (kind == 0 ? "\n" : ",\n") << "    { \"operation\": \"" << names[kind] << "\", \"count\": " << stats.mSamples.size()
+           << ", \"ops_per_sec\": " << (seconds == 0 ? 0.0 : static_cast<double>(stats.mSamples.size()) / seconds)
+           << ", \"misses\": " << stats.mMisses << ", \"errors\": " << stats.mErrors << ", \"corruptions\": " << stats.mCorruptions
+           << ", \"p50_ns\": " << percentile(stats.mSamples, 50) << ", \"p99_ns\": " << percentile(stats.mSamples, 99)
+           << ", \"p999_ns\": " << percentile(stats.mSamples, 99.9) << ", \"max_ns\": " << (stats.mSamples.empty() ? 0 : stats.mSamples.back()) << " }";
+    }
+    os << "\n  ]\n}" << std::endl;
+}
+
+int main(int ac, char **av)
+{
+    try {
+        Options                     options = parse(ac, av);
+        std::string                 path = options.mDirectory + "/stress_bench.reg";
+        auto                        start = std::chrono::system_clock::now() + std::chrono::milliseconds(200);
+        Report                      report;
+        std::uint64_t               increments = 0;
+        std::uint64_t               corruptions = 0;
+        std::int64_t                lost = 0;
+        std::vector<std::string>    measures;
+
+        if (jbr::reg::Manager::exist(path.c_str()))
+        {
+            jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+            jbr::reg::Manager::destroy(reg);
+        }
+        {
+            jbr::Register   reg = jbr::reg::Manager::create(path.c_str());
+
+            for (std::size_t i = 0; i < options.mKeys; ++i)
+                reg->set(jbr::reg::Variable("stress." + std::to_string(i), value("initial")));
+            reg->set(jbr::reg::Variable(counter, "0"));
+        }
+#ifndef _WIN32
+        std::vector<pid_t>          children;
+
+        for (std::size_t process = 1; process < options.mProcesses; ++process)
+        {
+            std::string measure = options.mDirectory + "/stress_bench." + std::to_string(process) + ".measures";
+            pid_t       pid = fork();
+
+            if (pid < 0)
+                throw jbr::reg::exception("Impossible to start the stress process " + std::to_string(process) + '.');
+            if (pid == 0)
+            {
+                std::uint64_t   processIncrements = 0;
+                int             status = 0;
+
+                try {
+                    Report  processReport = run(path, options, process, start, processIncrements);
+
+                    save(measure, processReport, processIncrements);
+                }
+                catch (const std::exception &e) {
+                    std::cerr << e.what() << std::endl;
+                    status = 1;
+                }
+                _exit(status);
+            }
+            children.push_back(pid);
+            measures.push_back(measure);
+        }
+#endif
+        report = run(path, options, 0, start, increments);
+#ifndef _WIN32
+        for (pid_t child : children)
+            (void)waitpid(child, nullptr, 0);
+#endif
+        for (const std::string &measure : measures)
+        {
+            merge(measure, report, increments);
+            std::filesystem::remove(measure);
+        }
+        for (const Stats &stats : report)
+            corruptions += stats.mCorruptions;
+        {
+            jbr::Register   reg = jbr::reg::Manager::open(path.c_str());
+
+            try {
+                reg->verify();
+                lost = static_cast<std::int64_t>(increments) - std::stoll(reg->get(counter).read());
+                (void)reg->forEach([&corruptions](const jbr::reg::VariableView &variable) {
+                    if (variable.mKey != counter && !valid(std::string(variable.mValue)))
+                        ++corruptions;
+                    return (true);
+                });
+            }
+            catch (const std::exception &e) {
+                std::cerr << "Register corrupted after the stress : " << e.what() << std::endl;
+                ++corruptions;
+            }
+            jbr::reg::Manager::destroy(reg);
+        }
+        if (options.mOutput.empty())
+            write(std::cout, options, report, lost, corruptions);
+        else
+        {
+            std::ofstream   ofs(options.mOutput, std::ios::trunc);
+
+            write(ofs, options, report, lost, corruptions);
+        }
+        return (lost != 0 || corruptions != 0 ? 2 : 0);
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return (1);
+    }
+}
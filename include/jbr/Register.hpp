@@ -20,6 +20,11 @@ namespace jbr
     //! @brief Register type definition.
     //!
     using Register = std::unique_ptr<jbr::reg::Instance>;
+    //!
+    //! @brief Shared register type definition, a register instance shared through the process (see Manager::acquire). The
+    //! instance is constant : it can't be moved and its settings can't be changed by one of its users.
+    //!
+    using SharedRegister = std::shared_ptr<const jbr::reg::Instance>;
 
 }
 
@@ -0,0 +1,119 @@
+//!
+//! @file Arena.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_ARENA_HPP
+# define JBR_CREGISTER_REGISTER_ARENA_HPP
+
+# include <tinyxml2.h>
+# include <cstddef>
+# include <atomic>
+# include <new>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Arena
+    //! @brief Per thread reusable XML documents. A leased document is cleared on return but keeps its tinyxml2 pools blocks
+    //! and character buffer, so the next loads on the thread reuse them instead of allocating.
+    //!
+    class Arena final
+    {
+    public:
+        static constexpr std::size_t    mDefaultBlockSize = 4 * 1024; //!< Default pools block size, the tinyxml2 one.
+        static constexpr std::size_t    mDefaultMaxRetained = 32 * 1024 * 1024; //!< Default maximum bytes kept by a document.
+        static constexpr std::size_t    mMaxDocuments = 4; //!< Maximum documents kept per thread, for nested loads.
+
+        //!
+        //! @class Lease
+        //! @brief Document leased from the thread arena, returned on destruction.
+        //!
+        class Lease final
+        {
+        private:
+            tinyxml2::XMLDocument   *mDocument; //!< Leased document.
+
+        public:
+            //!
+            //! @brief Lease a document, a kept one if available on this thread.
+            //! @throw Raise std::bad_alloc if the document can't be allocated.
+            //!
+            Lease() noexcept(false);
+            //!
+            //! @brief Lease a document, a kept one if available on this thread. The lease is empty if the document can't be allocated.
+            //!
+            explicit Lease(const std::nothrow_t &) noexcept;
+            //!
+            //! @brief Clear and return the document to the thread arena.
+            //!
+            ~Lease();
+            //!
+            //! @brief Copy constructor.
+            //! @warning Not usable.
+            //!
+            Lease(const Lease &) = delete;
+            //!
+            //! @brief Equal overload operator.
+            //! @warning Not usable.
+            //!
+            Lease   &operator=(const Lease &) = delete;
+
+        public:
+            //!
+            //! @brief Check if a document is leased.
+            //! @return False if the document allocation failed.
+            //!
+            explicit inline operator bool() const noexcept { return (mDocument != nullptr); }
+            //!
+            //! @brief Access the leased document.
+            //! @return Leased document.
+            //!
+            inline tinyxml2::XMLDocument    &operator*() const noexcept { return (*mDocument); }
+            //!
+            //! @brief Access the leased document.
+            //! @return Leased document.
+            //!
+            inline tinyxml2::XMLDocument    *operator->() const noexcept { return (mDocument); }
+        };
+
+    private:
+        static std::atomic<std::size_t> mBlockSize; //!< Pools block size.
+        static std::atomic<std::size_t> mMaxRetained; //!< Maximum bytes kept by a document.
+
+    public:
+        Arena() = delete;
+
+    public:
+        //!
+        //! @brief Configure the process arenas. The block size applies to the blocks allocated from now.
+        //! @param blockSize Pools block size, larger blocks do fewer allocations while loading large registers.
+        //! @param maxRetained Maximum bytes (pools blocks and character buffer) kept by a returned document, above its memory is freed.
+        //!
+        static void                 configure(std::size_t blockSize, std::size_t maxRetained) noexcept;
+        //!
+        //! @brief Extract the pools block size.
+        //! @return Block size.
+        //!
+        [[nodiscard]]
+        static inline std::size_t   blockSize() noexcept { return (mBlockSize.load(std::memory_order_relaxed)); }
+        //!
+        //! @brief Extract the maximum bytes kept by a returned document.
+        //! @return Maximum bytes.
+        //!
+        [[nodiscard]]
+        static inline std::size_t   maxRetained() noexcept { return (mMaxRetained.load(std::memory_order_relaxed)); }
+        //!
+        //! @brief Free the documents kept by the calling thread.
+        //!
+        static void                 release() noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_ARENA_HPP
@@ -0,0 +1,144 @@
+//!
+//! @file BlobStore.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_BLOB_STORE_HPP
+# define JBR_CREGISTER_REGISTER_BLOB_STORE_HPP
+
+# include <filesystem>
+# include <chrono>
+# include <cstdint>
+# include <string>
+# include <set>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class BlobStore
+    //! @brief Content addressed chunks of the large variables values of a register, stored into the '<register>.blobs' directory.
+    //! A chunk is named by his content hash and size, identical chunks are stored once.
+    //! @note Chunks are staged into pending files first, then published under the register lock.
+    //!
+    class BlobStore final
+    {
+    public:
+        static constexpr std::size_t    mChunkSize = 64 * 1024; //!< Maximum chunk size, in bytes.
+        static constexpr std::uint64_t  mDigestBasis = 14695981039346656037ull; //!< Hash of a empty content.
+        static constexpr const char     *mJournal = "collect.journal"; //!< Unreferenced chunks journal, with the time they were found unreferenced.
+
+    private:
+        std::filesystem::path   mDirectory; //!< Chunks directory.
+
+    public:
+        //!
+        //! @brief Blob store constructor.
+        //! @param registerPath Register location, chunks are stored into the '<registerPath>.blobs' directory.
+        //!
+        explicit BlobStore(const std::string &registerPath) : mDirectory(registerPath + ".blobs") {}
+
+    public:
+        //!
+        //! @brief Extract the chunks directory.
+        //! @return Chunks directory.
+        //!
+        [[nodiscard]]
+        inline const std::filesystem::path  &directory() const noexcept { return (mDirectory); }
+        //!
+        //! @brief Compute the identifier of a chunk.
+        //! @param data Chunk content.
+        //! @param size Chunk size.
+        //! @return Chunk identifier, content hash and size.
+        //!
+        [[nodiscard]]
+        static std::string  identify(const char *data, std::size_t size) noexcept(false);
+        //!
+        //! @brief Format the identifier of a content hashed in several parts.
+        //! @param hash Content hash, computed with digest().
+        //! @param size Content size.
+        //! @return Content identifier, content hash and size.
+        //!
+        [[nodiscard]]
+        static std::string  identify(std::uint64_t hash, std::size_t size) noexcept(false);
+        //!
+        //! @brief Hash a content part (FNV-1a).
+        //! @param data Content part.
+        //! @param size Content part size.
+        //! @param hash Hash of the previous parts.
+        //! @return Content hash, including this part.
+        //!
+        [[nodiscard]]
+        static std::uint64_t    digest(const char *data, std::size_t size, std::uint64_t hash = mDigestBasis) noexcept;
+        //!
+        //! @brief Write a chunk into a pending file, not visible to the collect() until published.
+        //! @param data Chunk content.
+        //! @param size Chunk size.
+        //! @return Pending file location.
+        //! @throw Raise if the chunk can't be written.
+        //!
+        [[nodiscard]]
+        std::filesystem::path   stage(const char *data, std::size_t size) const noexcept(false);
+        //!
+        //! @brief Publish a pending chunk. The pending file is removed if the chunk is already stored.
+        //! @param pending Pending file location.
+        //! @param chunk Chunk identifier.
+        //! @throw Raise if the chunk can't be published.
+        //!
+        void                    publish(const std::filesystem::path &pending, const std::string &chunk) const noexcept(false);
+        //!
+        //! @brief Discard a pending chunk.
+        //! @param pending Pending file location.
+        //!
+        void                    discard(const std::filesystem::path &pending) const noexcept;
+        //!
+        //! @brief Store a chunk, stage and publish it.
+        //! @param data Chunk content.
+        //! @param size Chunk size.
+        //! @return Chunk identifier.
+        //! @throw Raise if the chunk can't be stored.
+        //! @warning Must be called under the register lock.
+        //!
+        [[nodiscard]]
+        std::string             put(const char *data, std::size_t size) const noexcept(false);
+        //!
+        //! @brief Read a chunk.
+        //! @param chunk Chunk identifier.
+        //! @return Chunk content.
+        //! @throw Raise if the chunk does not exist or can't be read.
+        //!
+        [[nodiscard]]
+        std::string             read(const std::string &chunk) const noexcept(false);
+        //!
+        //! @brief Remove the chunks which are not referenced anymore since a delay. Readers don't lock the register, the delay
+        //! lets them read the chunks of the register version they loaded. Pending chunks are kept.
+        //! @param referenced Chunks still referenced by the register.
+        //! @param delay Time a chunk stays unreferenced before its removal.
+        //! @warning Must be called under the register lock.
+        //!
+        void                    collect(const std::set<std::string> &referenced, std::chrono::seconds delay) const noexcept;
+        //!
+        //! @brief Copy the chunks to a other store. Pending chunks are not copied.
+        //! @param target Target store.
+        //! @throw Raise if the chunks can't be copied.
+        //!
+        void                    copy(const BlobStore &target) const noexcept(false);
+        //!
+        //! @brief Move the chunks directory to a other store location.
+        //! @param target Target store.
+        //! @throw Raise if the chunks can't be moved.
+        //!
+        void                    move(const BlobStore &target) const noexcept(false);
+        //!
+        //! @brief Remove the chunks directory.
+        //!
+        void                    destroy() const noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_BLOB_STORE_HPP
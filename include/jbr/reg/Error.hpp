@@ -0,0 +1,64 @@
+//!
+//! @file Error.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_ERROR_HPP
+# define JBR_CREGISTER_ERROR_HPP
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @enum Error
+    //! @brief Error codes reported by the non-throwing register API.
+    //!
+    enum class Error : unsigned char
+    {
+        None = 0, //!< Operation succeed.
+        InvalidKey, //!< The variable key is null or empty.
+        NotExisting, //!< The register file does not exist.
+        Parsing, //!< The register file is not a valid xml file.
+        Corrupted, //!< A mandatory register node is missing or invalid.
+        NotReadable, //!< The register rights does not allow to read it.
+        NotFound, //!< No variable with this key exist into the register.
+        Allocation //!< The result can't be allocated.
+    };
+
+    //!
+    //! @brief Describe a error code. The returned string is static, no allocation are done.
+    //! @param error Error code to describe.
+    //! @return Error description.
+    //!
+    [[nodiscard]]
+    constexpr const char    *describe(jbr::reg::Error error) noexcept
+    {
+        switch (error)
+        {
+            case jbr::reg::Error::None:
+                return ("No error.");
+            case jbr::reg::Error::InvalidKey:
+                return ("The variable key is null or empty.");
+            case jbr::reg::Error::NotExisting:
+                return ("The register file does not exist.");
+            case jbr::reg::Error::Parsing:
+                return ("Parsing error while loading the register file.");
+            case jbr::reg::Error::Corrupted:
+                return ("Register corrupted.");
+            case jbr::reg::Error::NotReadable:
+                return ("The register is not readable.");
+            case jbr::reg::Error::NotFound:
+                return ("No variable were found into the register.");
+            case jbr::reg::Error::Allocation:
+                return ("Memory allocation failed.");
+        }
+        return ("Unknown error.");
+    }
+
+}
+
+#endif //JBR_CREGISTER_ERROR_HPP
@@ -0,0 +1,106 @@
+//!
+//! @file Expirer.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_EXPIRER_HPP
+# define JBR_CREGISTER_REGISTER_EXPIRER_HPP
+
+# include <jbr/reg/TimerWheel.hpp>
+# include <condition_variable>
+# include <chrono>
+# include <string>
+# include <thread>
+# include <mutex>
+# include <map>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Expirer
+    //! @brief Process wide expired variables purger. Expiration dates are scheduled into a hierarchical timer wheel run by a
+    //! background thread. Expired variables of a same register are purged together, with a single register save.
+    //!
+    class Expirer final
+    {
+    public:
+        static constexpr std::chrono::milliseconds  mResolution{100}; //!< Timer wheel tick duration.
+
+    private:
+        std::mutex                                                          mMutex; //!< Protect the timer wheel.
+        std::condition_variable                                             mCondition; //!< Notified when the thread must stop.
+        jbr::reg::TimerWheel<std::pair<std::string, std::string>>           mWheel; //!< Scheduled expirations, register location and variable key.
+        std::map<std::pair<std::string, std::string>, std::uint64_t>        mPending; //!< Last scheduled tick of each variable, a same expiration is scheduled once.
+        bool                                                                mRunning; //!< Purger thread running status.
+        std::thread                                                         mThread; //!< Purger thread.
+
+    public:
+        //!
+        //! @brief Extract the process expirer.
+        //! @return Process expirer.
+        //!
+        [[nodiscard]]
+        static Expirer  &get() noexcept;
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Expirer(const Expirer &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Expirer &operator=(const Expirer &) = delete;
+
+    private:
+        //!
+        //! @brief Expirer constructor. The purger thread is started on the first schedule.
+        //!
+        Expirer() noexcept;
+        //!
+        //! @brief Expirer destructor, stop the purger thread.
+        //!
+        ~Expirer();
+
+    public:
+        //!
+        //! @brief Schedule the purge of a variable. The variable expiration is checked again before the purge, a variable updated
+        //! meanwhile is kept.
+        //! @param path Register location.
+        //! @param key Variable key.
+        //! @param expiration Variable expiration date.
+        //! @note A expiration already scheduled for the variable is not scheduled again.
+        //!
+        void    schedule(const std::string &path, const std::string &key, std::chrono::system_clock::time_point expiration) noexcept(false);
+
+        //!
+        //! @brief Extract the number of scheduled purges.
+        //! @return Number of scheduled purges.
+        //!
+        [[nodiscard]]
+        std::size_t scheduled() noexcept;
+
+    private:
+        //!
+        //! @brief Purger thread main loop.
+        //!
+        void    run() noexcept;
+        //!
+        //! @brief Convert a date to a timer wheel tick.
+        //! @param date Date to convert.
+        //! @return Timer wheel tick.
+        //!
+        [[nodiscard]]
+        static std::uint64_t    tick(std::chrono::system_clock::time_point date) noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_EXPIRER_HPP
@@ -0,0 +1,60 @@
+//!
+//! @file FileLock.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_FILE_LOCK_HPP
+# define JBR_CREGISTER_REGISTER_FILE_LOCK_HPP
+
+# include <string>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class FileLock
+    //! @brief Advisory lock on a register file, shared between threads and processes. Writers hold it exclusively from the
+    //! register loading to the register saving, so concurrent read-modify-write can't lose updates. Readers of the files
+    //! maintained with the register (value index) hold it shared.
+    //! @note Registers are saved by replacing the file, the lock is taken again if the file has been replaced while waiting.
+    //!
+    class FileLock final
+    {
+    private:
+# ifdef _WIN32
+        void    *mHandle; //!< Locked file handle, null if the file does not exist.
+# else
+        int     mDescriptor; //!< Locked file descriptor, -1 if the file does not exist.
+# endif
+
+    public:
+        //!
+        //! @brief Lock a file, block until the lock is acquired. Nothing is locked if the file does not exist.
+        //! @param path File to lock.
+        //! @param shared Lock shared with the other shared locks, else exclusive.
+        //! @throw Raise if the file can't be locked.
+        //!
+        explicit FileLock(const std::string &path, bool shared = false) noexcept(false);
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        FileLock(const FileLock &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        FileLock    &operator=(const FileLock &) = delete;
+        //!
+        //! @brief Unlock the file.
+        //!
+        ~FileLock();
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_FILE_LOCK_HPP
@@ -8,11 +8,30 @@
 # define JBR_CREGISTER_REGISTER_INSTANCE_HPP
 
 # include <jbr/reg/perm/Rights.hpp>
+# include <jbr/reg/perm/Mask.hpp>
+# include <jbr/reg/var/perm/Mask.hpp>
 # include <jbr/reg/Variable.hpp>
+# include <jbr/reg/VariableView.hpp>
+# include <jbr/reg/Error.hpp>
+# include <jbr/reg/Watcher.hpp>
+# include <jbr/reg/Operation.hpp>
+# include <jbr/reg/ValueStream.hpp>
+# include <jbr/reg/ValueIndex.hpp>
+# include <jbr/reg/KeyIndex.hpp>
+# include <jbr/reg/KeyFilter.hpp>
+# include <jbr/reg/MemoryUsage.hpp>
+# include <jbr/reg/node/Name.hpp>
 # include <tinyxml2.h>
 # include <filesystem>
 # include <string>
 # include <optional>
+# include <vector>
+# include <array>
+# include <utility>
+# include <functional>
+# include <cstdint>
+# include <chrono>
+# include <set>
 
 //!
 //! @namespace jbr::reg
@@ -24,6 +43,11 @@ namespace jbr::reg
     //! @note Forward declaration
     //!
     class Manager;
+    //!
+    //! @class Expirer
+    //! @note Forward declaration
+    //!
+    class Expirer;
 
     //!
     //! @class Instance
@@ -32,9 +56,46 @@ namespace jbr::reg
     class Instance final
     {
         friend jbr::reg::Manager; //!< Register manager is allow to use the private member functions.
+        friend jbr::reg::Watcher; //!< Register watcher is allow to use the private member functions.
+        friend jbr::reg::Expirer; //!< Register expirer is allow to use the private member functions.
+        friend jbr::reg::ValueWriter; //!< Value writer is allow to use the private member functions.
+
+    public:
+        static constexpr std::size_t    mDefaultBlobThreshold = 64 * 1024; //!< Default size above which values are stored out of line, in bytes.
+        static constexpr std::chrono::seconds   mDefaultBlobCollectDelay{60}; //!< Default time a chunk stays unreferenced before its removal.
+        static constexpr std::size_t    mMapThreshold = 256 * 1024; //!< Size from which register files are memory mapped and parsed in place, in bytes.
+        static constexpr std::size_t    mParallelParseThreshold = 8 * 1024 * 1024; //!< Size from which the keys are indexed from a parallel parsing, in bytes.
+        static constexpr std::size_t    mHeaderCopyThreshold = 256 * 1024; //!< Size from which the copies only parse the register header, in bytes.
+        static constexpr std::size_t    mHeaderReadLimit = 64 * 1024; //!< Maximum size read to find the register header, in bytes.
 
     private:
-        std::string mPath; //!< Register location.
+        using RightsField = std::pair<jbr::reg::node::Name, std::uint8_t>; //!< Rights field name and mask bit.
+        using RightsFields = std::array<RightsField, 6>; //!< Rights fields, in the register order.
+
+        static constexpr RightsFields   mRightsFields = {{
+            { jbr::reg::node::name::_header::_rights::read, jbr::reg::perm::Mask::Read },
+            { jbr::reg::node::name::_header::_rights::write, jbr::reg::perm::Mask::Write },
+            { jbr::reg::node::name::_header::_rights::open, jbr::reg::perm::Mask::Open },
+            { jbr::reg::node::name::_header::_rights::copy, jbr::reg::perm::Mask::Copy },
+            { jbr::reg::node::name::_header::_rights::move, jbr::reg::perm::Mask::Move },
+            { jbr::reg::node::name::_header::_rights::destroy, jbr::reg::perm::Mask::Destroy }
+        }}; //!< Register rights fields, from register/header/rights nodes.
+        static constexpr RightsFields   mVariableRightsFields = {{
+            { jbr::reg::node::name::_body::_variable::_rights::read, jbr::reg::var::perm::Mask::Read },
+            { jbr::reg::node::name::_body::_variable::_rights::write, jbr::reg::var::perm::Mask::Write },
+            { jbr::reg::node::name::_body::_variable::_rights::update, jbr::reg::var::perm::Mask::Update },
+            { jbr::reg::node::name::_body::_variable::_rights::rename, jbr::reg::var::perm::Mask::Rename },
+            { jbr::reg::node::name::_body::_variable::_rights::copy, jbr::reg::var::perm::Mask::Copy },
+            { jbr::reg::node::name::_body::_variable::_rights::remove, jbr::reg::var::perm::Mask::Remove }
+        }}; //!< Variables rights fields, from register/body/variable/rights nodes.
+
+    private:
+        std::string                     mPath; //!< Register location.
+        std::vector<jbr::reg::WatchId>  mWatches; //!< Watches subscribed through this instance.
+        mutable std::atomic<bool>       mAsync; //!< Tell if asynchronous operations has been launched through this instance.
+        std::size_t                     mBlobThreshold; //!< Size above which values are stored out of line, in bytes.
+        std::chrono::seconds            mBlobCollectDelay; //!< Time a chunk stays unreferenced before its removal.
+        std::size_t                     mAffinity; //!< I/O pool worker affinity, from the register location at construction.
 
     public:
         //!
@@ -53,7 +114,7 @@ namespace jbr::reg
         //! @param path Register location.
         //! @throw Exception raise if the register path is invalid.
         //!
-        explicit Instance(std::string &&path) : mPath(std::move(path)) { checkPathValidity(); }
+        explicit Instance(std::string &&path) : Instance(std::move(path), mDefaultBlobThreshold, mDefaultBlobCollectDelay) {}
         //!
         //! @brief Copy constructor
         //! @warning Not usable.
@@ -65,9 +126,9 @@ namespace jbr::reg
         //!
         Instance    &operator=(const Instance &) = delete;
         //!
-        //! @brief Register instance destructor.
+        //! @brief Register instance destructor. All watches subscribed through this instance are removed and pending asynchronous operations are completed.
         //!
-        ~Instance() = default;
+        ~Instance();
 
     public:
         //!
@@ -103,6 +164,32 @@ namespace jbr::reg
         [[nodiscard]]
         const std::string   &localization() const noexcept { return (mPath); }
 
+    public:
+        //!
+        //! @brief Extract the size above which values are stored out of line, into the '<register>.blobs' chunks directory.
+        //! @return Blob threshold, in bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t  blobThreshold() const noexcept { return (mBlobThreshold); }
+        //!
+        //! @brief Set the size above which values are stored out of line, into the '<register>.blobs' chunks directory.
+        //! Only the values written afterward are affected.
+        //! @param threshold Blob threshold, in bytes.
+        //!
+        inline void         setBlobThreshold(std::size_t threshold) noexcept { mBlobThreshold = threshold; }
+        //!
+        //! @brief Extract the time a chunk stays unreferenced before its removal. Readers of the replaced values have this
+        //! delay to read their chunks.
+        //! @return Blob collect delay.
+        //!
+        [[nodiscard]]
+        inline std::chrono::seconds blobCollectDelay() const noexcept { return (mBlobCollectDelay); }
+        //!
+        //! @brief Set the time a chunk stays unreferenced before its removal.
+        //! @param delay Blob collect delay.
+        //!
+        inline void                 setBlobCollectDelay(std::chrono::seconds delay) noexcept { mBlobCollectDelay = delay; }
+
     public:
         //!
         //! @brief Copy a existing register to a new one.
@@ -111,7 +198,8 @@ namespace jbr::reg
         //!
         void            copy(const char *pathTo) const noexcept(false);
         //!
-        //! @brief Move a existing register. Can be use as a rename register function.
+        //! @brief Move a existing register. Can be use as a rename register function. The asynchronous operations launched
+        //! before are completed first, on the previous location.
         //! @param pathTo New register path, where the current register will be moved.
         //! @throw Raise if impossible to move the register.
         //!
@@ -252,7 +340,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isReadable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mRead); }
+        inline bool isReadable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isReadable()); }
         //!
         //! @brief Check if a register is openable. The register is not openable if the fields read or open from register/header/rights nodes is false.
         //! @param rights Current register rights to check.
@@ -260,7 +348,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isOpenable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mRead && rights.mOpen); }
+        inline bool isOpenable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isOpenable()); }
         //!
         //! @brief Check if a register is writable. The register is not writable if the fields write from register/header/rights nodes is false.
         //! @param rights Current register rights to check.
@@ -268,7 +356,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isWritable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mWrite); }
+        inline bool isWritable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isWritable()); }
         //!
         //! @brief Check if a register is copyable. The register is not copyable if the fields read or copy from register/header/rights nodes is false.
         //! @param rights Current register rights to check.
@@ -276,7 +364,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isCopyable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mRead && rights.mCopy); }
+        inline bool isCopyable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isCopyable()); }
         //!
         //! @brief Check if a register is movable. The register is not movable if the fields write, read or copy from register/header/rights nodes is false.
         //! @param rights Current register rights to check.
@@ -284,7 +372,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isMovable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mWrite && rights.mRead && rights.mMove); }
+        inline bool isMovable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isMovable()); }
         //!
         //! @brief Check if a register is destroyable. The register is not destroyable if the fields read or destroy from register/header/rights nodes is false.
         //! @param rights Current register rights to check.
@@ -292,7 +380,7 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the register.
         //!
         [[nodiscard]]
-        inline bool isDestroyable(const jbr::reg::perm::Rights &rights) const noexcept { return (rights.mRead && rights.mDestroy); }
+        inline bool isDestroyable(const jbr::reg::perm::Rights &rights) const noexcept { return (jbr::reg::perm::Mask(rights).isDestroyable()); }
 
     public:
         //!
@@ -302,7 +390,8 @@ namespace jbr::reg
         //!
         void    set(const jbr::reg::Variable &variable, bool replaceIfExist = true) const noexcept(false);
         //!
-        //! @brief Check if a variable exist on this current register.
+        //! @brief Check if a variable exist on this current register. The missing keys are answered from the register key filter,
+        //! without loading the register, while the register does not change.
         //! @param key Variable to check into this register.
         //! @return Variable existing status.
         //! @throw Raise if impossible to load the register file.
@@ -310,6 +399,80 @@ namespace jbr::reg
         [[nodiscard]]
         bool        available(const char *key) const noexcept(false);
         //!
+        //! @brief Visit all the variables of the register, in the register order, with a single register load. Expired variables
+        //! are skipped. Values stored out of line are loaded into a buffer reused between variables.
+        //! @param visitor Called with a view of each variable, return false to stop the iteration.
+        //! @return Number of visited variables.
+        //! @throw Raise if impossible to load the register file. Exceptions raised by the visitor are forwarded.
+        //!
+        std::size_t forEach(const jbr::reg::Visitor &visitor) const noexcept(false);
+
+    public:
+        //!
+        //! @brief Create the value index of the register, stored into the '<register>.index' directory. The index is then
+        //! maintained on each register change, by any instance or process.
+        //! @throw Raise if impossible to load the register or to write the index.
+        //!
+        void                        enableValueIndex() const noexcept(false);
+        //!
+        //! @brief Remove the value index of the register.
+        //! @throw Raise if impossible to lock the register.
+        //!
+        void                        disableValueIndex() const noexcept(false);
+        //!
+        //! @brief Check if the register has a value index.
+        //! @return Value index status.
+        //!
+        [[nodiscard]]
+        inline bool                 hasValueIndex() const noexcept { return (jbr::reg::ValueIndex(mPath).enabled()); }
+        //!
+        //! @brief Save the key filter of the register into the '<register>.filter' file, the other processes then answer the
+        //! missing keys without loading the register. The file is then maintained on each filter rebuild or update.
+        //! @throw Raise if impossible to load the register or to write the filter.
+        //!
+        void                        enableKeyFilter() const noexcept(false);
+        //!
+        //! @brief Remove the key filter file of the register.
+        //! @throw Raise if impossible to lock the register.
+        //!
+        void                        disableKeyFilter() const noexcept(false);
+        //!
+        //! @brief Check if the register key filter is saved into a file.
+        //! @return Key filter file status.
+        //!
+        [[nodiscard]]
+        inline bool                 hasKeyFilter() const noexcept { return (jbr::reg::KeyFilter::enabled(mPath)); }
+        //!
+        //! @brief Extract the keys of the readable variables holding a value. With a value index, only the index bucket of the
+        //! value is read (O(result)), the index is rebuilt if the register has been changed by a other tool. Without index, all
+        //! the variables are scanned.
+        //! @param value Value to search.
+        //! @return Matching keys, expired variables excluded.
+        //! @throw Raise if the register can't be read.
+        //! @note Values are matched by hash and size (64 bits FNV-1a), collisions are not verified.
+        //!
+        [[nodiscard]]
+        std::vector<std::string>    keysWithValue(const char *value) const noexcept(false);
+        //!
+        //! @brief Extract the keys matching a glob or regular expression pattern. The keys are indexed by trigram, only the keys
+        //! containing all the trigrams of the pattern literal parts are matched. The index is cached per process and rebuilt once
+        //! the register changed, from a parallel parsing from mParallelParseThreshold bytes.
+        //! @param pattern Key pattern.
+        //! @param syntax Pattern syntax, glob by default.
+        //! @return Matching keys, in the register order, expired variables excluded.
+        //! @throw Raise if the pattern is null or invalid, or if the register can't be read.
+        //!
+        [[nodiscard]]
+        std::vector<std::string>    findKeys(const char *pattern, jbr::reg::Pattern syntax = jbr::reg::Pattern::Glob) const noexcept(false);
+        //!
+        //! @brief Measure the memory held by the register once loaded : tinyxml2 node pools, parsed text buffer, raw file buffer
+        //! and the variables if all extracted. Values stored out of line count for their size, without being read.
+        //! @return Memory usage, by category.
+        //! @throw Raise if impossible to load the register file or if the register is not readable.
+        //!
+        [[nodiscard]]
+        jbr::reg::MemoryUsage       memoryUsage() const noexcept(false);
+        //!
         //! @brief Check if a variable exist on this current register.
         //! @param variable Variable to check into this register.
         //! @return Variable existing status.
@@ -326,6 +489,21 @@ namespace jbr::reg
         [[nodiscard]]
         jbr::reg::Variable  get(const char *key) const noexcept(false);
         //!
+        //! @brief Extract a register variable without raising exception. Misses, permission failures and parsing errors are reported as error code.
+        //! @param key Variable key to find and extract from the register.
+        //! @param variable Extracted register variable, reset if the variable can't be extracted.
+        //! @return Error code, jbr::reg::Error::None on success.
+        //!
+        [[nodiscard]]
+        jbr::reg::Error     tryGet(const char *key, std::optional<jbr::reg::Variable> &variable) const noexcept;
+        //!
+        //! @brief Find a register variable without raising exception.
+        //! @param key Variable key to find and extract from the register.
+        //! @return Register variable, std::nullopt if the variable can't be extracted for any reason.
+        //!
+        [[nodiscard]]
+        std::optional<jbr::reg::Variable>   find(const char *key) const noexcept;
+        //!
         //! @brief Remove a variable from the register.
         //! @param variable Variable key to find and remove from the register.
         //! @throw Raise if impossible to find the variable or load the register.
@@ -338,26 +516,315 @@ namespace jbr::reg
         //!
         void    remove(const char *key) const noexcept(false);
 
+    public:
+        //!
+        //! @brief Atomically add a delta to a integer variable, with a single register load and save under the register lock.
+        //! A missing variable is created from 0, a empty value is read as 0.
+        //! @param key Variable key.
+        //! @param delta Value to add.
+        //! @return New variable value.
+        //! @throw Raise if the value is not a integer, on overflow or if the variable is not readable and updatable.
+        //!
+        std::int64_t    increment(const char *key, std::int64_t delta = 1) const noexcept(false);
+        //!
+        //! @brief Atomically add a delta to a integer variable, like increment().
+        //! @param key Variable key.
+        //! @param delta Value to add.
+        //! @return Variable value before the addition.
+        //! @throw Raise if the value is not a integer, on overflow or if the variable is not readable and updatable.
+        //!
+        std::int64_t    fetchAdd(const char *key, std::int64_t delta) const noexcept(false);
+        //!
+        //! @brief Atomically replace a variable value if it is equal to a expected value, with a single register load and save
+        //! under the register lock.
+        //! @param key Variable key.
+        //! @param expected Expected current value.
+        //! @param desired New value.
+        //! @return True if the value has been replaced, false if the variable does not exist or has a different value.
+        //! @throw Raise if the variable is not readable and updatable.
+        //!
+        [[nodiscard]]
+        bool            compareAndSet(const char *key, const char *expected, const char *desired) const noexcept(false);
+
+    public:
+        //!
+        //! @brief Open a input stream on a variable value. Values stored out of line are read chunk by chunk, without loading the
+        //! whole value in memory.
+        //! @param key Variable key.
+        //! @return Value reader.
+        //! @throw Raise if the variable does not exist or is not readable.
+        //!
+        [[nodiscard]]
+        jbr::reg::ValueReader   openValueStream(const char *key) const noexcept(false);
+        //!
+        //! @brief Open a output stream replacing a variable value. Written data are staged chunk by chunk, the value is replaced
+        //! by ValueWriter::commit().
+        //! @param key Variable key.
+        //! @return Value writer, uncommitted data are discarded on destruction.
+        //! @throw Raise if the key is null or empty.
+        //!
+        [[nodiscard]]
+        jbr::reg::ValueWriter   writeValueStream(const char *key) const noexcept(false);
+
     private:
         //!
-        //! @brief Override variable value if she already exist and if this is allow.
+        //! @brief Update a variable under the register lock, with a single register load and save.
+        //! @param key Variable key.
+        //! @param updater Called with the register and the variable node, a missing variable is inserted with the default rights
+        //! before the call. Return true to save the register.
+        //! @throw Raise if the register can't be loaded or saved, or if the variable is not readable and updatable.
+        //!
+        void            update(const char *key, const std::function<bool(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement,
+                                                                         bool existing)> &updater) const noexcept(false);
+        //!
+        //! @brief Read, modify and write a variable value under the register lock, with a single register load and save.
+        //! @param key Variable key.
+        //! @param modifier Called with the current value (null if the variable does not exist), return the new value or std::nullopt
+        //! to keep the register unchanged. A missing variable is created with the default rights.
+        //! @throw Raise if the register can't be loaded or saved, or if the variable is not readable and updatable.
+        //!
+        void            modify(const char *key, const std::function<std::optional<std::string>(const char *value)> &modifier) const noexcept(false);
+        //!
+        //! @brief Publish staged chunks and reference them as a variable value, under the register lock.
+        //! @param key Variable key.
+        //! @param staged Staged chunks, in order.
+        //! @param size Value size, in bytes.
+        //! @throw Raise if the register can't be updated or if the variable is not readable and updatable.
+        //!
+        void            writeBlob(const char *key, const jbr::reg::ValueWriter::Staged &staged, std::size_t size) const noexcept(false);
+        //!
+        //! @brief Extract a variable value, inline or stored out of line.
+        //! @param variableElement Variable node.
+        //! @return Variable value.
+        //! @throw Raise if the value node is missing or if a chunk can't be read.
+        //!
+        [[nodiscard]]
+        std::string     readValue(const tinyxml2::XMLElement *variableElement) const noexcept(false);
+        //!
+        //! @brief Write a variable value. Values above the blob threshold are stored out of line.
+        //! @param xmlDocument Reference XML documentation (register).
+        //! @param variableElement Variable node.
+        //! @param value Variable value.
+        //! @warning File must be saved after call, under the register lock.
+        //! @throw Raise if the value can't be written.
+        //!
+        void            writeValue(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement, const char *value) const noexcept(false);
+        //!
+        //! @brief Replace the blob node of a variable.
+        //! @param xmlDocument Reference XML documentation (register).
+        //! @param variableElement Variable node.
+        //! @param chunks Value chunks identifiers, in order.
+        //! @param size Value size, in bytes.
+        //! @warning File must be saved after call.
+        //!
+        void            writeBlobNode(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement,
+                                      const std::vector<std::string> &chunks, std::size_t size) const noexcept(false);
+        //!
+        //! @brief Extract the chunks of a value stored out of line.
+        //! @param blobNode Variable blob node.
+        //! @param size Filled with the value size, in bytes.
+        //! @return Value chunks identifiers, in order.
+        //! @throw Raise if the blob node is corrupted.
+        //!
+        [[nodiscard]]
+        std::vector<std::string>    getBlobChunksFromNode(const tinyxml2::XMLElement *blobNode, std::size_t &size) const noexcept(false);
+        //!
+        //! @brief Remove the chunks not referenced anymore by the register.
+        //! @param xmlDocument Reference XML documentation (register), as saved.
+        //! @warning Must be called under the register lock.
+        //!
+        void            collectBlobs(tinyxml2::XMLDocument &xmlDocument) const noexcept(false);
+        //!
+        //! @brief Convert a variable value to a integer.
+        //! @param key Variable key, used for error message.
+        //! @param value Variable value, a empty value is converted to 0.
+        //! @return Integer value.
+        //! @throw Raise if the value is not a integer.
+        //!
+        [[nodiscard]]
+        std::int64_t    toInteger(const char *key, const char *value) const noexcept(false);
+        //!
+        //! @brief Insert a new variable on the top of the register body.
+        //! @param xmlDocument Reference XML documentation (register).
+        //! @param body Internal xml document pointer to the 'body' section.
+        //! @param variable Variable to insert.
+        //! @return Inserted variable node.
+        //! @warning File must be saved after call.
+        //!
+        tinyxml2::XMLElement    *insertVariable(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *body, const jbr::reg::Variable &variable) const noexcept(false);
+
+    public:
+        //!
+        //! @brief Extract a register variable asynchronously, on the register I/O pool.
+        //! @param key Variable key to find and extract from the register.
+        //! @return Operation, awaitable from a C++20 coroutine (co_await reg->asyncGet(key)) or blocking through get().
+        //! @note Operations on a same register are run in order. The operation raises the same exceptions as get().
+        //!
+        [[nodiscard]]
+        jbr::reg::Operation<jbr::reg::Variable> asyncGet(const char *key) const noexcept(false);
+        //!
+        //! @brief Set a variable into the register asynchronously, on the register I/O pool.
+        //! @param variable Variable to set.
+        //! @param replaceIfExist Tell if the variable must be replace if the variable already exist.
+        //! @return Operation, awaitable from a C++20 coroutine or blocking through get().
+        //! @note Operations on a same register are run in order. The operation raises the same exceptions as set().
+        //!
+        [[nodiscard]]
+        jbr::reg::Operation<void>   asyncSet(const jbr::reg::Variable &variable, bool replaceIfExist = true) const noexcept(false);
+        //!
+        //! @brief Wait for all asynchronous operations previously launched on this register.
+        //! @return Operation completed once all the previous operations are completed.
+        //!
+        [[nodiscard]]
+        jbr::reg::Operation<void>   asyncFlush() const noexcept(false);
+
+    private:
+        //!
+        //! @brief Register instance constructor, with its blobs settings. Used by the asynchronous operations, run on a
+        //! instance of their own.
+        //! @param path Register location.
+        //! @param blobThreshold Size above which values are stored out of line, in bytes.
+        //! @param blobCollectDelay Time a chunk stays unreferenced before its removal.
+        //! @throw Exception raise if the register path is invalid.
+        //!
+        Instance(std::string &&path, std::size_t blobThreshold, std::chrono::seconds blobCollectDelay) noexcept(false);
+        //!
+        //! @brief Launch a asynchronous operation on the register I/O pool, on the worker associated to this register.
+        //! The jobs must not use this instance, which may be moved or destroyed meanwhile.
+        //! @tparam T Operation result type.
+        //! @param job Operation job.
+        //! @return Operation.
+        //!
+        template <typename T>
+        [[nodiscard]]
+        jbr::reg::Operation<T>  launch(std::function<T()> &&job) const noexcept(false)
+        {
+            mAsync = true;
+            return (jbr::reg::Operation<T>::launch(jbr::reg::ThreadPool::io(), mAffinity, std::move(job)));
+        }
+
+    public:
+        //!
+        //! @brief Watch all register variables changes. The callback is called from the process watcher thread, only for changed keys.
+        //! @param callback Callback called with the changed key and the new variable, std::nullopt if the variable has been removed.
+        //! @return Watch identifier, use it to unwatch.
+        //! @throw Raise if the register can't be loaded.
+        //!
+        jbr::reg::WatchId   watch(jbr::reg::WatchCallback &&callback) noexcept(false);
+        //!
+        //! @brief Watch a register variable changes. The callback is called from the process watcher thread.
+        //! @param key Variable key to watch.
+        //! @param callback Callback called with the key and the new variable, std::nullopt if the variable has been removed.
+        //! @return Watch identifier, use it to unwatch.
+        //! @throw Raise if the key is invalid or if the register can't be loaded.
+        //!
+        jbr::reg::WatchId   watch(const char *key, jbr::reg::WatchCallback &&callback) noexcept(false);
+        //!
+        //! @brief Remove a watch. Nothing is done if the watch does not exist.
+        //! @param id Watch identifier.
+        //!
+        void                unwatch(jbr::reg::WatchId id) noexcept;
+
+    private:
+        //!
+        //! @brief Override variable value if she already exist and if this is allow. A expired variable, not purged yet, is replaced
+        //! as a absent one.
         //! @param xmlDocument Reference XML documentation (register).
         //! @param variable Variable to set.
         //! @param body Internal xml document pointer to the 'body' section.
         //! @param replaceIfExist Tell if the variable must be replace if the variable already exist.
+        //! @param saved Filled with the stamp of the saved register file, if overrided.
         //! @return Status if a variable has been overrided.
         //! @throw If the override is not allow and the variable already exist.
         //!
         [[nodiscard]]
         bool    overrideVariable(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::Variable &variable,
-                                 tinyxml2::XMLElement *body, bool replaceIfExist) const noexcept(false);
+                                 tinyxml2::XMLElement *body, bool replaceIfExist, std::string &saved) const noexcept(false);
+        //!
+        //! @brief Find a variable element by key, expired variables included.
+        //! @param body Internal xml document pointer to the 'body' section.
+        //! @param key Variable key to find.
+        //! @return Variable element, null if not found.
+        //! @throw Raise if a variable has no key field.
+        //!
+        [[nodiscard]]
+        tinyxml2::XMLElement    *findVariableElement(tinyxml2::XMLElement *body, const char *key) const noexcept(false);
         //!
         //! @brief Extract all rights from a variable.
         //! @param nodeRights Rights node from a variable.
         //! @return All variables rights.
         //! @throw Raise if impossible to extract rights.
         //!
-        jbr::reg::var::perm::Rights getVariableRightsFromNode(tinyxml2::XMLNode *nodeRights) const noexcept(false);
+        jbr::reg::var::perm::Rights getVariableRightsFromNode(const tinyxml2::XMLElement *nodeRights) const noexcept(false);
+        //!
+        //! @brief Extract all rights from a variable, packed into a mask.
+        //! @param nodeRights Rights node from a variable, default rights are used if null.
+        //! @return All variables rights.
+        //! @throw Raise if impossible to extract rights.
+        //!
+        [[nodiscard]]
+        jbr::reg::var::perm::Mask   getVariableMaskFromNode(const tinyxml2::XMLElement *nodeRights) const noexcept(false);
+        //!
+        //! @brief Load the register and find a variable element without raising exception.
+        //! @param xmlDocument Reference XML documentation (register) to load.
+        //! @param key Variable key to find.
+        //! @param variableElement Found variable element.
+        //! @return Error code, jbr::reg::Error::None if the variable has been found.
+        //!
+        [[nodiscard]]
+        jbr::reg::Error lookupVariable(tinyxml2::XMLDocument &xmlDocument, const char *key,
+                                       tinyxml2::XMLElement **variableElement) const noexcept;
+        //!
+        //! @brief Extract all rights from a variable without raising exception.
+        //! @param nodeRights Rights node from a variable, default rights are used if null.
+        //! @param rights Extracted variable rights.
+        //! @return Error code, jbr::reg::Error::Corrupted if a right field is invalid.
+        //!
+        [[nodiscard]]
+        jbr::reg::Error queryVariableRights(const tinyxml2::XMLElement *nodeRights, jbr::reg::var::perm::Rights &rights) const noexcept;
+        //!
+        //! @brief Extract a variable expiration date without raising exception.
+        //! @param variableElement Variable element.
+        //! @param expiration Extracted expiration date, std::nullopt if the variable never expire.
+        //! @return Error code, jbr::reg::Error::Corrupted if the expiration field is invalid.
+        //!
+        [[nodiscard]]
+        jbr::reg::Error queryVariableExpiration(const tinyxml2::XMLElement *variableElement,
+                                                std::optional<std::chrono::system_clock::time_point> &expiration) const noexcept;
+        //!
+        //! @brief Extract a variable expiration date.
+        //! @param variableElement Variable element.
+        //! @return Expiration date, std::nullopt if the variable never expire.
+        //! @throw Raise if the expiration field is invalid.
+        //!
+        [[nodiscard]]
+        std::optional<std::chrono::system_clock::time_point>    getVariableExpirationFromNode(const tinyxml2::XMLElement *variableElement) const noexcept(false);
+        //!
+        //! @brief Check if a variable is expired. Expired variables are scheduled to be purged.
+        //! @param variableElement Variable element.
+        //! @return Expired status.
+        //! @throw Raise if the expiration field is invalid.
+        //!
+        [[nodiscard]]
+        bool    isExpired(const tinyxml2::XMLElement *variableElement) const noexcept(false);
+        //!
+        //! @brief Remove expired variables from the register, with a single save.
+        //! @param keys Keys of the variables to purge, only the expired ones are removed.
+        //! @throw Raise if the register can't be loaded, saved or is not writable.
+        //!
+        void    purge(const std::set<std::string> &keys) const noexcept(false);
+        //!
+        //! @brief Check if the register is openable, then schedule the purge of its variables with a expiration date, from a single
+        //! register loading.
+        //! @throw Raise if the register can't be loaded or is not openable.
+        //!
+        void    open() const noexcept(false);
+        //!
+        //! @brief Schedule the purge of all the register variables with a expiration date. Invalid variables are ignored.
+        //! @param body Register body node.
+        //! @throw Raise if the register can't be read.
+        //!
+        void    scheduleExpirations(const tinyxml2::XMLElement *body) const noexcept(false);
 
     private:
         //!
@@ -384,7 +851,23 @@ namespace jbr::reg
         //! @throw Throw a exception when the sub node can't be extracted.
         //!
         [[nodiscard]]
-        tinyxml2::XMLElement    *getSubXMLElement(tinyxml2::XMLNode *node, const char *subNodeName) const noexcept(false);
+        tinyxml2::XMLElement    *getSubXMLElement(tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) const noexcept(false);
+        //!
+        //! @brief Find a sub element from a xml node, the siblings names compared by length first.
+        //! @param node Parent node.
+        //! @param subNodeName Name of the sub node to find.
+        //! @return Found element, nullptr if none.
+        //!
+        [[nodiscard]]
+        static tinyxml2::XMLElement         *findSubXMLElement(tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) noexcept;
+        //!
+        //! @brief Find a sub element from a const xml node, the siblings names compared by length first.
+        //! @param node Parent node.
+        //! @param subNodeName Name of the sub node to find.
+        //! @return Found element, nullptr if none.
+        //!
+        [[nodiscard]]
+        static const tinyxml2::XMLElement   *findSubXMLElement(const tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) noexcept;
         //!
         //! @brief Extract the body xml element from xml document class.
         //! @param xmlDocument Reference XML documentation (register).
@@ -396,17 +879,100 @@ namespace jbr::reg
 
     private:
         //!
-        //! @brief Save xml file with error handling.
+        //! @brief Save xml file with error handling. The value index, if any, is updated with the variables changes.
         //! @param xmlDocument XML documentation to save.
+        //! @param changes Variables values changes, to apply on the value index.
+        //! @return Stamp of the saved register file, taken before it replaces the register.
         //! @throw Raise a exception if the file saving is impossible.
         //!
-        void    saveXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept(false);
+        std::string saveXMLFile(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::ValueIndex::Changes &changes = {}) const noexcept(false);
+        //!
+        //! @brief Update the value index, if any, with the variables changes of a register save. It is rebuilt if out of date.
+        //! @param xmlDocument XML documentation, as saved.
+        //! @param changes Variables values changes.
+        //! @param stamp Stamp of the saved register file.
+        //! @throw Raise if the index can't be written.
+        //! @warning Must be called under the register lock, before the saved register replaces the locked one.
+        //!
+        void    saveIndex(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::ValueIndex::Changes &changes, const std::string &stamp) const noexcept(false);
+        //!
+        //! @brief Serialize a xml document, then write it into a file.
+        //! @param xmlDocument XML documentation to write.
+        //! @param path File to write, replaced if existing.
+        //! @throw Raise a exception if the file can't be written.
+        //!
+        void    writeXMLFile(tinyxml2::XMLDocument &xmlDocument, const std::string &path) const noexcept(false);
+        //!
+        //! @brief Compute the value index bucket of a variable.
+        //! @param variableElement Variable node.
+        //! @param check Filled with the value check digest (see ValueIndex::check), if not null.
+        //! @return Value bucket, empty if the variable is not readable (not indexed).
+        //! @throw Raise if the value can't be read.
+        //!
+        [[nodiscard]]
+        std::string                     indexBucket(const tinyxml2::XMLElement *variableElement, std::uint64_t *check = nullptr) const noexcept(false);
+        //!
+        //! @brief Build the value index change of a variable.
+        //! @param variableElement Variable node, as saved.
+        //! @param from Previous value bucket of the variable, empty if the variable was not indexed.
+        //! @return Value index change.
+        //! @throw Raise if the variable can't be read.
+        //!
+        [[nodiscard]]
+        jbr::reg::ValueIndex::Change    indexChange(const tinyxml2::XMLElement *variableElement, std::string &&from) const noexcept(false);
+        //!
+        //! @brief Rebuild the whole value index from the register.
+        //! @param xmlDocument XML documentation, as saved.
+        //! @param stamp Stamp of the register file holding this content.
+        //! @throw Raise if the index can't be written.
+        //! @warning Must be called under the register lock.
+        //!
+        void                            rebuildIndex(tinyxml2::XMLDocument &xmlDocument, const std::string &stamp) const noexcept(false);
         //!
         //! @brief Load xml file with error handling.
         //! @param xmlDocument XML documentation to load.
         //! @throw Raise a exception if the file loading is impossible.
         //!
         void    loadXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept(false);
+        //!
+        //! @brief Read the register file, memory mapped from mMapThreshold bytes, then parse it in place.
+        //! @param xmlDocument XML documentation to load.
+        //! @return Reading or parsing error code.
+        //!
+        [[nodiscard]]
+        tinyxml2::XMLError  readXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept;
+        //!
+        //! @brief Load only the header of the register file, read up to the body opening tag. The loaded document holds the
+        //! register header and a empty body.
+        //! @param xmlDocument XML documentation to load.
+        //! @return False if the header is not found within mHeaderReadLimit bytes, or if the register has unusual content
+        //! (comments, CDATA, ...) or can't be parsed. The register must then be loaded from loadXMLFile, raising the errors.
+        //!
+        [[nodiscard]]
+        bool                loadXMLHeader(tinyxml2::XMLDocument &xmlDocument) const noexcept;
+        //!
+        //! @brief Extract the keys of a register, its body split at the variables boundaries and the chunks parsed in parallel.
+        //! @param keys Extracted keys, in the register order.
+        //! @return False if the register has unusual content (comments, CDATA, ...), or is not readable or valid. The keys must then
+        //! be extracted from the serial parsing, raising the errors.
+        //!
+        [[nodiscard]]
+        bool                loadKeysParallel(std::vector<jbr::reg::KeyIndex::Key> &keys) const noexcept(false);
+        //!
+        //! @brief Build the key filter of a register, cached if the register has not been replaced since its loading.
+        //! @param body Register body node.
+        //! @param stamp Register stamp before its loading.
+        //! @return Register key filter.
+        //! @throw Raise if the filter can't be saved.
+        //!
+        std::shared_ptr<const jbr::reg::KeyFilter>  buildKeyFilter(const tinyxml2::XMLElement *body, std::string &&stamp) const noexcept(false);
+        //!
+        //! @brief Add a key to the filter of the register, after a save. Without filter for the previous stamp, nothing is done.
+        //! @param stamp Register stamp before the save.
+        //! @param saved Stamp of the saved register file (see saveXMLFile), labelling the updated filter.
+        //! @param key Added key.
+        //!
+        void                updateKeyFilter(const std::string &stamp, const std::string &saved, const char *key) const noexcept;
 
     private:
         //!
@@ -451,12 +1017,35 @@ namespace jbr::reg
         void    updateRights(tinyxml2::XMLDocument *reg, tinyxml2::XMLNode *nodeVariable,
                                        tinyxml2::XMLElement *variableValue, const jbr::reg::var::perm::Rights &rights) const noexcept(false);
         //!
-        //! @brief Query a boolean into a xml element field.
-        //! @param xmlElement XML element to insert the boolean.
-        //! @param status Boolean to insert.
-        //! @throw If the element is set and the query failed.
+        //! @brief Write, update or remove the variable expiration date on register.
+        //! @param reg XML document object.
+        //! @param nodeVariable Variable node from register.
+        //! @param expiration Variable expiration date, the field is removed if not set.
+        //! @warning File must be saved after call.
+        //! @throw Exception raise if parameters are invalid.
+        //!
+        void    writeExpiration(tinyxml2::XMLDocument *reg, tinyxml2::XMLNode *nodeVariable,
+                                const std::optional<std::chrono::system_clock::time_point> &expiration) const noexcept(false);
+        //!
+        //! @brief Query the rights fields of a rights node into a mask bits.
+        //! @param nodeRights Rights node, the bits are unchanged if null.
+        //! @param fields Rights fields names and bits.
+        //! @param bits Rights bits, updated with the fields set.
+        //! @throw If a field is set and its query failed.
         //!
-        void    queryRightToXMLElement(const tinyxml2::XMLElement *xmlElement, bool *status) const noexcept(false);
+        void    queryRightsToXMLElement(const tinyxml2::XMLElement *nodeRights, const RightsFields &fields, std::uint8_t &bits) const noexcept(false);
+        //!
+        //! @brief Query the rights fields of a rights node into a mask bits, in a single pass over the node children. The first
+        //! occurrence of a field applies, the unknown fields are ignored.
+        //! @param nodeRights Rights node, the bits are unchanged if null.
+        //! @param fields Rights fields names and bits.
+        //! @param bits Rights bits, updated with the fields set.
+        //! @param err Query error of the invalid field, if any.
+        //! @return Invalid field, nullptr if all the fields are valid.
+        //!
+        [[nodiscard]]
+        static const tinyxml2::XMLElement   *queryRightsBits(const tinyxml2::XMLElement *nodeRights, const RightsFields &fields, std::uint8_t &bits,
+                                                             tinyxml2::XMLError *err = nullptr) noexcept;
     };
 }
 
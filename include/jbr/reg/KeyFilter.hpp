@@ -0,0 +1,146 @@
+//!
+//! @file KeyFilter.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_KEY_FILTER_HPP
+# define JBR_CREGISTER_REGISTER_KEY_FILTER_HPP
+
+# include <string_view>
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <vector>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class KeyFilter
+    //! @brief Bloom filter of the keys of a register. A key not in the filter is not in the register, the lookups of missing
+    //! keys are answered without parsing the register. The keys removed from the register stay in the filter until it is
+    //! rebuilt, they only cost a false positive.
+    //! @note The filters are cached per process and register, and reused while the register stamp does not change. They are
+    //! also saved into the '<register>.filter' file when enabled, for the other processes.
+    //!
+    class KeyFilter final
+    {
+    public:
+        static constexpr std::size_t    mBitsPerKey = 10; //!< Filter bits per key, about 1% of false positives.
+        static constexpr std::size_t    mHashes = 7; //!< Bits set per key.
+
+    private:
+        static constexpr std::size_t    mCacheSize = 16; //!< Maximum number of cached filters.
+
+    private:
+        std::string                 mStamp; //!< Filtered register stamp.
+        std::vector<std::uint64_t>  mBits; //!< Filter bits.
+
+    public:
+        //!
+        //! @brief Key filter constructor, empty.
+        //! @param stamp Filtered register stamp.
+        //! @param keys Expected number of keys, the filter size.
+        //!
+        KeyFilter(std::string &&stamp, std::size_t keys) noexcept(false);
+        //!
+        //! @brief Key filter copy constructor, for a other register stamp.
+        //! @param stamp Filtered register stamp.
+        //! @param filter Copied filter.
+        //!
+        KeyFilter(std::string &&stamp, const KeyFilter &filter) noexcept(false) : mStamp(std::move(stamp)), mBits(filter.mBits) {}
+
+    public:
+        //!
+        //! @brief Extract the filter of a register, from the process cache or else from the '<register>.filter' file.
+        //! @param path Register location.
+        //! @param stamp Current register stamp.
+        //! @return Register filter, null if there is no filter for this register stamp.
+        //!
+        [[nodiscard]]
+        static std::shared_ptr<const KeyFilter> cached(const std::string &path, const std::string &stamp) noexcept;
+        //!
+        //! @brief Cache the filter of a register, then save it if the register filter file exists.
+        //! @param path Register location.
+        //! @param filter Register filter.
+        //!
+        static void                             cache(const std::string &path, const std::shared_ptr<const KeyFilter> &filter) noexcept(false);
+        //!
+        //! @brief Check if the filter of a register is saved into the '<register>.filter' file.
+        //! @param path Register location.
+        //! @return Saved status.
+        //!
+        [[nodiscard]]
+        static bool                             enabled(const std::string &path) noexcept;
+        //!
+        //! @brief Save the filter of a register into the '<register>.filter' file, replaced.
+        //! @param path Register location.
+        //! @param filter Register filter.
+        //! @throw Raise if the file can't be written.
+        //!
+        static void                             save(const std::string &path, const KeyFilter &filter) noexcept(false);
+        //!
+        //! @brief Copy the filter file of a register to a other register location, if any. The copy is rebuilt on its first use.
+        //! @param from Register location.
+        //! @param to Target register location.
+        //! @throw Raise if the file can't be copied.
+        //!
+        static void                             copy(const std::string &from, const std::string &to) noexcept(false);
+        //!
+        //! @brief Move the filter file of a register to a other register location, if any. The stamp does not change on a move.
+        //! @param from Register location.
+        //! @param to Target register location.
+        //! @throw Raise if the file can't be moved.
+        //!
+        static void                             move(const std::string &from, const std::string &to) noexcept(false);
+        //!
+        //! @brief Forget the filter of a register, its file removed.
+        //! @param path Register location.
+        //!
+        static void                             destroy(const std::string &path) noexcept;
+
+    public:
+        //!
+        //! @brief Extract the filtered register stamp.
+        //! @return Register stamp.
+        //!
+        [[nodiscard]]
+        inline const std::string    &stamp() const noexcept { return (mStamp); }
+        //!
+        //! @brief Add a key to the filter.
+        //! @param key Variable key.
+        //!
+        void                        insert(std::string_view key) noexcept;
+        //!
+        //! @brief Check if a key may be in the register.
+        //! @param key Variable key.
+        //! @return False if the key is not in the register, true if it may be.
+        //!
+        [[nodiscard]]
+        bool                        mayContain(std::string_view key) const noexcept;
+
+    private:
+        //!
+        //! @brief Hash a key, the bits positions are derived from the hash halves.
+        //! @param key Variable key.
+        //! @return Key hash.
+        //!
+        [[nodiscard]]
+        static std::uint64_t        hash(std::string_view key) noexcept;
+        //!
+        //! @brief Load the filter of a register from the '<register>.filter' file.
+        //! @param path Register location.
+        //! @param stamp Current register stamp.
+        //! @return Register filter, null if the file is missing, invalid or out of date.
+        //!
+        [[nodiscard]]
+        static std::shared_ptr<const KeyFilter> load(const std::string &path, const std::string &stamp) noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_KEY_FILTER_HPP
@@ -0,0 +1,177 @@
+//!
+//! @file KeyIndex.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_KEY_INDEX_HPP
+# define JBR_CREGISTER_REGISTER_KEY_INDEX_HPP
+
+# include <unordered_map>
+# include <optional>
+# include <cstdint>
+# include <chrono>
+# include <memory>
+# include <string>
+# include <vector>
+# include <regex>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @enum Pattern
+    //! @brief Key pattern syntax.
+    //!
+    enum class Pattern : unsigned char
+    {
+        Glob = 0, //!< Whole key match, '*' any characters, '?' one character, '[a-z]' / '[!a-z]' characters class, '\' escape.
+        Regex //!< ECMAScript regular expression, searched into the key (use '^' and '$' to anchor it).
+    };
+
+    //!
+    //! @class KeyMatcher
+    //! @brief Compiled key pattern.
+    //!
+    class KeyMatcher final
+    {
+    private:
+        std::string                 mPattern; //!< Pattern.
+        jbr::reg::Pattern           mSyntax; //!< Pattern syntax.
+        std::optional<std::regex>   mRegex; //!< Compiled regular expression.
+
+    public:
+        //!
+        //! @brief Key matcher constructor.
+        //! @param pattern Pattern.
+        //! @param syntax Pattern syntax.
+        //! @throw Raise if the pattern is invalid.
+        //!
+        KeyMatcher(const char *pattern, jbr::reg::Pattern syntax) noexcept(false);
+
+    public:
+        //!
+        //! @brief Check if a key match the pattern.
+        //! @param key Key to check.
+        //! @return Matching status.
+        //!
+        [[nodiscard]]
+        bool                        match(const std::string &key) const noexcept;
+        //!
+        //! @brief Extract the literal strings every matching key contains, used to select the candidate keys.
+        //! @return Mandatory literals, empty if none can be extracted.
+        //!
+        [[nodiscard]]
+        std::vector<std::string>    literals() const noexcept(false);
+
+    private:
+        //!
+        //! @brief Check if a key match a glob pattern.
+        //! @param pattern Glob pattern.
+        //! @param key Key to check.
+        //! @return Matching status.
+        //!
+        [[nodiscard]]
+        static bool                 glob(const char *pattern, const char *key) noexcept;
+    };
+
+    //!
+    //! @class KeyIndex
+    //! @brief Trigram index of the keys of a register. Each trigram has the sorted list of the keys containing it, a pattern
+    //! search only matches the keys containing all the trigrams of the pattern literals.
+    //! @note The indexes are cached per process and register, and reused while the register stamp does not change.
+    //!
+    class KeyIndex final
+    {
+    public:
+        //!
+        //! @struct Key
+        //! @brief Indexed key.
+        //!
+        struct Key
+        {
+            std::string                                             mKey; //!< Variable key.
+            std::optional<std::chrono::system_clock::time_point>    mExpiration; //!< Variable expiration date.
+        };
+
+    private:
+        static constexpr std::size_t    mCacheSize = 16; //!< Maximum number of cached indexes.
+
+    private:
+        std::string                                                 mStamp; //!< Indexed register stamp.
+        std::vector<Key>                                            mKeys; //!< Keys, in the register order.
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> mTrigrams; //!< Keys positions, by trigram.
+
+    public:
+        //!
+        //! @brief Key index constructor, index the keys.
+        //! @param stamp Indexed register stamp.
+        //! @param keys Keys, in the register order.
+        //!
+        KeyIndex(std::string &&stamp, std::vector<Key> &&keys) noexcept(false);
+
+    public:
+        //!
+        //! @brief Extract the cached index of a register.
+        //! @param path Register location.
+        //! @param stamp Current register stamp.
+        //! @return Cached index, null if there is no index for this register stamp.
+        //!
+        [[nodiscard]]
+        static std::shared_ptr<const KeyIndex>  cached(const std::string &path, const std::string &stamp) noexcept;
+        //!
+        //! @brief Cache the index of a register.
+        //! @param path Register location.
+        //! @param index Register index.
+        //!
+        static void                             cache(const std::string &path, const std::shared_ptr<const KeyIndex> &index) noexcept(false);
+
+    public:
+        //!
+        //! @brief Extract the number of indexed keys.
+        //! @return Number of keys.
+        //!
+        [[nodiscard]]
+        inline std::size_t          size() const noexcept { return (mKeys.size()); }
+        //!
+        //! @brief Extract the indexed register stamp.
+        //! @return Register stamp.
+        //!
+        [[nodiscard]]
+        inline const std::string    &stamp() const noexcept { return (mStamp); }
+        //!
+        //! @brief Find the keys matching a pattern. Expired variables are excluded.
+        //! @param matcher Compiled pattern.
+        //! @return Matching keys, in the register order.
+        //!
+        [[nodiscard]]
+        std::vector<std::string>    find(const jbr::reg::KeyMatcher &matcher) const noexcept(false);
+
+    private:
+        //!
+        //! @brief Extract the candidate keys of a pattern.
+        //! @param matcher Compiled pattern.
+        //! @return Candidate keys positions, std::nullopt if all the keys are candidates.
+        //!
+        [[nodiscard]]
+        std::optional<std::vector<std::uint32_t>>   candidates(const jbr::reg::KeyMatcher &matcher) const noexcept(false);
+        //!
+        //! @brief Pack a trigram.
+        //! @param trigram First character of the trigram.
+        //! @return Packed trigram.
+        //!
+        [[nodiscard]]
+        static constexpr std::uint32_t  pack(const char *trigram) noexcept
+        {
+            return ((static_cast<std::uint32_t>(static_cast<unsigned char>(trigram[0])) << 16) |
+                    (static_cast<std::uint32_t>(static_cast<unsigned char>(trigram[1])) << 8) |
+                    static_cast<std::uint32_t>(static_cast<unsigned char>(trigram[2])));
+        }
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_KEY_INDEX_HPP
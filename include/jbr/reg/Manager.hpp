@@ -8,6 +8,9 @@
 # define JBR_CREGISTER_REGISTER_MANAGER_HPP
 
 # include <jbr/Register.hpp>
+# include <jbr/reg/Metrics.hpp>
+# include <string>
+# include <vector>
 
 //!
 //! @namespace jbr::reg
@@ -15,6 +18,17 @@
 namespace jbr::reg
 {
 
+    //!
+    //! @struct Opened
+    //! @brief Result of a register opened in bulk.
+    //!
+    struct Opened
+    {
+        std::string         mPath; //!< Requested register path.
+        jbr::SharedRegister mRegister; //!< Opened register, null on error.
+        std::string         mError; //!< Error message, empty on success.
+    };
+
     //!
     //! @class Manager
     //! @brief Allow to manage a register.
@@ -39,6 +53,36 @@ namespace jbr::reg
         [[nodiscard]]
         static jbr::Register open(const char *path) noexcept(false);
         //!
+        //! @brief Open a existing register shared through the process. The registers are kept by canonical path while a
+        //! handle is alive, the same instance is returned to all the callers and it is closed with its last handle.
+        //! @param path Register path to open.
+        //! @note The shared instance is constant, its operations are safe between threads. It can't be moved, watched or
+        //! have its blobs settings changed : use a instance of its own, from open(), for these operations.
+        //! @return Shared register, located by its canonical path.
+        //! @throw Raise if impossible to open a register.
+        //!
+        [[nodiscard]]
+        static jbr::SharedRegister  acquire(const char *path) noexcept(false);
+        //!
+        //! @brief Open and check many registers in parallel, shared through the process as by acquire. The files are read
+        //! ahead by the system before the openings.
+        //! @param paths Register paths to open.
+        //! @param threads Number of opening threads, 0 for the number of hardware threads.
+        //! @return Opened registers or errors, in the paths order. A failed opening does not stop the others.
+        //!
+        [[nodiscard]]
+        static std::vector<jbr::reg::Opened>    openAll(const std::vector<std::string> &paths, std::size_t threads = 0) noexcept(false);
+        //!
+        //! @brief Open and check in parallel the registers listed into a manifest, as by openAll.
+        //! @param manifest Manifest path : a register path per line, relative to the manifest directory. The empty lines and
+        //! the lines starting with '#' are ignored.
+        //! @param threads Number of opening threads, 0 for the number of hardware threads.
+        //! @return Opened registers or errors, in the manifest order.
+        //! @throw Raise if the manifest can't be read.
+        //!
+        [[nodiscard]]
+        static std::vector<jbr::reg::Opened>    preload(const char *manifest, std::size_t threads = 0) noexcept(false);
+        //!
         //! @brief Check if a register exist. Only check if the register file exist on system.
         //! @param path Register path.
         //! @return True if exist, false if not.
@@ -52,6 +96,48 @@ namespace jbr::reg
         //! @throw Raise if the register is not destroyable.
         //!
         static void          destroy(jbr::Register &reg) noexcept(false);
+        //!
+        //! @brief Destroy a existing shared register. The target register will be removed definitively on the system.
+        //! @param reg Shared register to destroy, its last handle.
+        //! @throw Raise if the register is not destroyable or if other handles share it.
+        //!
+        static void          destroy(const jbr::SharedRegister &reg) noexcept(false);
+        //!
+        //! @brief Extract the process register metrics : operations and phases latencies, failed operations, bytes read and
+        //! written and caches hits.
+        //! @return Metrics snapshot.
+        //!
+        [[nodiscard]]
+        static jbr::reg::metric::Snapshot   metrics() noexcept(false);
+        //!
+        //! @brief Write the process register metrics into a file, in Prometheus text exposition format. The file is replaced.
+        //! @param path Metrics file path.
+        //! @throw Raise if the file can't be written.
+        //!
+        static void                         dumpMetrics(const char *path) noexcept(false);
+        //!
+        //! @brief Reset the process register metrics.
+        //!
+        static void                         resetMetrics() noexcept;
+        //!
+        //! @brief Start recording the register operations and phases as Chrome trace events. A started recording is discarded.
+        //! @param path Trace file path, written by stopTracing.
+        //! @throw Raise if the path is null or empty or if the tracing has been disabled at compile time (ENABLE_TRACING=OFF).
+        //!
+        static void                         startTracing(const char *path) noexcept(false);
+        //!
+        //! @brief Stop recording and write the trace file, loadable in Perfetto or chrome://tracing.
+        //! @throw Raise if the tracing is not started or if the trace file can't be written.
+        //!
+        static void                         stopTracing() noexcept(false);
+
+    private:
+        //!
+        //! @brief Destroy a existing register instance, its file and its side files removed.
+        //! @param reg Register instance to destroy.
+        //! @throw Raise if the register is not destroyable.
+        //!
+        static void                         destroy(const jbr::reg::Instance &reg) noexcept(false);
     };
 }
 
@@ -0,0 +1,46 @@
+//!
+//! @file MemoryUsage.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_MEMORY_USAGE_HPP
+# define JBR_CREGISTER_REGISTER_MEMORY_USAGE_HPP
+
+# include <cstddef>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @struct MemoryUsage
+    //! @brief Memory held by a loaded register, by category, in bytes.
+    //!
+    struct MemoryUsage
+    {
+        std::size_t mPools = 0; //!< tinyxml2 MemPoolT blocks, holding the elements, attributes, texts and comments nodes.
+        std::size_t mStrings = 0; //!< tinyxml2 parsed text buffer the file is read into, the StrPair names and values point into it.
+        std::size_t mFile = 0; //!< Register file mapping parsed in place instead, backed by the page cache until modified.
+        std::size_t mVariables = 0; //!< jbr::reg::Variable objects and strings, if all the variables are extracted.
+        std::size_t mCount = 0; //!< Number of variables.
+
+        //!
+        //! @brief Extract the memory held while the register is loaded, the variables excluded.
+        //! @return Loaded register bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t  loaded() const noexcept { return (mPools + mStrings + mFile); }
+        //!
+        //! @brief Extract the memory of all the categories.
+        //! @return Total bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t  total() const noexcept { return (loaded() + mVariables); }
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_MEMORY_USAGE_HPP
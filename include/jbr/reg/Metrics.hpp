@@ -0,0 +1,379 @@
+//!
+//! @file Metrics.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_METRICS_HPP
+# define JBR_CREGISTER_REGISTER_METRICS_HPP
+
+# include <ostream>
+# include <cstdint>
+# include <utility>
+# include <chrono>
+# include <atomic>
+# include <vector>
+# include <array>
+
+//!
+//! @namespace jbr::reg::metric
+//!
+namespace jbr::reg::metric
+{
+
+    //!
+    //! @enum Operation
+    //! @brief Measured register operations.
+    //!
+    enum class Operation : std::uint8_t
+    {
+        Create = 0, //!< Manager::create.
+        Open, //!< Manager::open.
+        Destroy, //!< Manager::destroy.
+        Copy, //!< Instance::copy.
+        Move, //!< Instance::move.
+        Get, //!< Instance::get, tryGet and find.
+        Set, //!< Instance::set.
+        Available, //!< Instance::available.
+        Remove, //!< Instance::remove.
+        Update, //!< Instance::increment, fetchAdd, compareAndSet and value streams commits.
+        ForEach, //!< Instance::forEach.
+        FindKeys, //!< Instance::findKeys.
+        KeysWithValue, //!< Instance::keysWithValue.
+        Purge, //!< Expired variables purge.
+        Count //!< Number of operations.
+    };
+
+    //!
+    //! @enum Phase
+    //! @brief Measured operations phases.
+    //!
+    enum class Phase : std::uint8_t
+    {
+        Lock = 0, //!< Register lock wait.
+        Io, //!< Register file read or write.
+        Parse, //!< Register XML parsing.
+        Search, //!< Variables or keys scan.
+        Serialize, //!< Register XML printing.
+        ChunkParse, //!< Register body chunk parsing, by a parallel keys load.
+        Count //!< Number of phases.
+    };
+
+    //!
+    //! @enum Cache
+    //! @brief Measured caches.
+    //!
+    enum class Cache : std::uint8_t
+    {
+        KeyIndex = 0, //!< In process key trigram index (findKeys).
+        ValueIndex, //!< On disk value index (keysWithValue), hit when up to date.
+        Arena, //!< Thread XML documents arena, hit when a kept document is reused.
+        KeyFilter, //!< Register key filter (available), hit when a filter is up to date.
+        Registry, //!< Process shared registers (Manager::acquire), hit when a open register is shared.
+        Count //!< Number of caches.
+    };
+
+    //!
+    //! @brief Extract the name of a operation.
+    //! @param operation Operation.
+    //! @return Operation name.
+    //!
+    [[nodiscard]]
+    const char  *name(Operation operation) noexcept;
+    //!
+    //! @brief Extract the name of a phase.
+    //! @param phase Phase.
+    //! @return Phase name.
+    //!
+    [[nodiscard]]
+    const char  *name(Phase phase) noexcept;
+    //!
+    //! @brief Extract the name of a cache.
+    //! @param cache Cache.
+    //! @return Cache name.
+    //!
+    [[nodiscard]]
+    const char  *name(Cache cache) noexcept;
+
+    //!
+    //! @class Histogram
+    //! @brief Lock free HDR style latency histogram. Values are counted into log-linear buckets, 16 buckets per power of two,
+    //! so any recorded value is known with a relative error below 6.25%.
+    //!
+    class Histogram final
+    {
+    public:
+        //!
+        //! @struct Snapshot
+        //! @brief Histogram content, at a given time.
+        //!
+        struct Snapshot
+        {
+            std::uint64_t                                       mCount = 0; //!< Number of recorded values.
+            std::uint64_t                                       mSum = 0; //!< Sum of the recorded values.
+            std::uint64_t                                       mMin = 0; //!< Minimum recorded value.
+            std::uint64_t                                       mMax = 0; //!< Maximum recorded value.
+            std::vector<std::pair<std::uint64_t, std::uint64_t>> mBuckets; //!< Not empty buckets, highest value and count, ascending.
+
+            //!
+            //! @brief Extract a percentile of the recorded values.
+            //! @param percentile Percentile, between 0 and 100.
+            //! @return Highest value of the bucket holding the percentile (clamped to the maximum), 0 if empty.
+            //!
+            [[nodiscard]]
+            std::uint64_t   percentile(double percentile) const noexcept;
+            //!
+            //! @brief Extract the mean of the recorded values.
+            //! @return Mean value, 0 if empty.
+            //!
+            [[nodiscard]]
+            inline double   mean() const noexcept { return (mCount == 0 ? 0.0 : static_cast<double>(mSum) / static_cast<double>(mCount)); }
+        };
+
+    private:
+        static constexpr std::size_t    mSubBits = 4; //!< Significant bits of a value.
+        static constexpr std::size_t    mSubBuckets = std::size_t(1) << mSubBits; //!< Buckets per power of two.
+        static constexpr std::size_t    mBuckets = (64 - mSubBits + 1) * mSubBuckets; //!< Number of buckets, all the 64 bits values.
+
+    private:
+        std::array<std::atomic<std::uint64_t>, mBuckets>    mCounts; //!< Values count, by bucket.
+        std::atomic<std::uint64_t>                          mCount; //!< Number of recorded values.
+        std::atomic<std::uint64_t>                          mSum; //!< Sum of the recorded values.
+        std::atomic<std::uint64_t>                          mMin; //!< Minimum recorded value.
+        std::atomic<std::uint64_t>                          mMax; //!< Maximum recorded value.
+
+    public:
+        //!
+        //! @brief Empty histogram constructor.
+        //!
+        Histogram() noexcept;
+
+    public:
+        //!
+        //! @brief Record a value.
+        //! @param value Value to record.
+        //!
+        void        record(std::uint64_t value) noexcept;
+        //!
+        //! @brief Remove all the recorded values.
+        //!
+        void        reset() noexcept;
+        //!
+        //! @brief Extract the histogram content.
+        //! @return Histogram snapshot.
+        //!
+        [[nodiscard]]
+        Snapshot    snapshot() const noexcept(false);
+
+    private:
+        //!
+        //! @brief Extract the bucket of a value.
+        //! @param value Value.
+        //! @return Bucket index.
+        //!
+        [[nodiscard]]
+        static std::size_t      bucket(std::uint64_t value) noexcept;
+        //!
+        //! @brief Extract the highest value of a bucket.
+        //! @param bucket Bucket index.
+        //! @return Highest value.
+        //!
+        [[nodiscard]]
+        static std::uint64_t    highest(std::size_t bucket) noexcept;
+    };
+
+    //!
+    //! @struct Snapshot
+    //! @brief Register metrics, at a given time. Latencies are in nanoseconds.
+    //!
+    struct Snapshot
+    {
+        std::array<Histogram::Snapshot, static_cast<std::size_t>(Operation::Count)> mOperations; //!< Latencies, by operation.
+        std::array<std::uint64_t, static_cast<std::size_t>(Operation::Count)>       mErrors{}; //!< Failed operations, by operation.
+        std::array<Histogram::Snapshot, static_cast<std::size_t>(Phase::Count)>     mPhases; //!< Latencies, by phase.
+        std::uint64_t                                                               mBytesRead = 0; //!< Register files and blob chunks bytes read.
+        std::uint64_t                                                               mBytesWritten = 0; //!< Register files and blob chunks bytes written.
+        std::array<std::uint64_t, static_cast<std::size_t>(Cache::Count)>           mHits{}; //!< Cache hits, by cache.
+        std::array<std::uint64_t, static_cast<std::size_t>(Cache::Count)>           mMisses{}; //!< Cache misses, by cache.
+
+        //!
+        //! @brief Extract the latencies of a operation.
+        //! @param operation Operation.
+        //! @return Operation latencies.
+        //!
+        [[nodiscard]]
+        inline const Histogram::Snapshot    &operation(Operation operation) const noexcept { return (mOperations[static_cast<std::size_t>(operation)]); }
+        //!
+        //! @brief Extract the latencies of a phase.
+        //! @param phase Phase.
+        //! @return Phase latencies.
+        //!
+        [[nodiscard]]
+        inline const Histogram::Snapshot    &phase(Phase phase) const noexcept { return (mPhases[static_cast<std::size_t>(phase)]); }
+        //!
+        //! @brief Extract the number of failed calls of a operation.
+        //! @param operation Operation.
+        //! @return Failed calls.
+        //!
+        [[nodiscard]]
+        inline std::uint64_t                errors(Operation operation) const noexcept { return (mErrors[static_cast<std::size_t>(operation)]); }
+        //!
+        //! @brief Extract the hit rate of a cache.
+        //! @param cache Cache.
+        //! @return Hits ratio, between 0 and 1, 0 if the cache has not been used.
+        //!
+        [[nodiscard]]
+        double                              hitRate(Cache cache) const noexcept;
+        //!
+        //! @brief Write the metrics in Prometheus text exposition format. Latencies are exported as summaries, in seconds.
+        //! @param os Output stream.
+        //!
+        void                                prometheus(std::ostream &os) const noexcept(false);
+    };
+
+    //!
+    //! @class Timer
+    //! @brief Scoped operation or phase measure, recorded on destruction. A operation left by a exception is counted as failed.
+    //! The measure is also recorded as a trace event while the jbr::reg::Tracer is started.
+    //!
+    class Timer final
+    {
+    private:
+        std::chrono::steady_clock::time_point   mStart; //!< Measure start.
+        int                                     mExceptions; //!< Uncaught exceptions on start.
+        std::uint8_t                            mId; //!< Measured operation or phase.
+        bool                                    mPhase; //!< Phase measure status.
+        bool                                    mFailed; //!< Operation failure status.
+
+    public:
+        //!
+        //! @brief Start a operation measure.
+        //! @param operation Measured operation.
+        //!
+        explicit Timer(Operation operation) noexcept;
+        //!
+        //! @brief Start a phase measure.
+        //! @param phase Measured phase.
+        //!
+        explicit Timer(Phase phase) noexcept;
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Timer(const Timer &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Timer   &operator=(const Timer &) = delete;
+        //!
+        //! @brief Record the measure.
+        //!
+        ~Timer();
+
+    public:
+        //!
+        //! @brief Count the operation as failed, for operations reporting errors without exception.
+        //!
+        inline void fail() noexcept { mFailed = true; }
+    };
+
+}
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Metrics
+    //! @brief Process wide register metrics : operations latencies and errors, phases latencies, bytes read and written and
+    //! caches hits. All the counters are atomics, recording never blocks.
+    //!
+    class Metrics final
+    {
+    private:
+        std::array<jbr::reg::metric::Histogram, static_cast<std::size_t>(jbr::reg::metric::Operation::Count)>  mOperations; //!< Latencies, by operation.
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(jbr::reg::metric::Operation::Count)>   mErrors; //!< Failed operations, by operation.
+        std::array<jbr::reg::metric::Histogram, static_cast<std::size_t>(jbr::reg::metric::Phase::Count)>      mPhases; //!< Latencies, by phase.
+        std::atomic<std::uint64_t>                                                                              mBytesRead; //!< Bytes read.
+        std::atomic<std::uint64_t>                                                                              mBytesWritten; //!< Bytes written.
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(jbr::reg::metric::Cache::Count)>       mHits; //!< Cache hits, by cache.
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(jbr::reg::metric::Cache::Count)>       mMisses; //!< Cache misses, by cache.
+
+    public:
+        //!
+        //! @brief Extract the process metrics.
+        //! @return Process metrics.
+        //!
+        [[nodiscard]]
+        static Metrics  &get() noexcept;
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Metrics(const Metrics &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Metrics &operator=(const Metrics &) = delete;
+
+    private:
+        //!
+        //! @brief Empty metrics constructor.
+        //!
+        Metrics() noexcept;
+        //!
+        //! @brief Metrics destructor.
+        //!
+        ~Metrics() = default;
+
+    public:
+        //!
+        //! @brief Record a operation.
+        //! @param operation Operation.
+        //! @param duration Operation duration.
+        //! @param failed Operation failure status.
+        //!
+        void    record(jbr::reg::metric::Operation operation, std::chrono::nanoseconds duration, bool failed) noexcept;
+        //!
+        //! @brief Record a phase.
+        //! @param phase Phase.
+        //! @param duration Phase duration.
+        //!
+        void    record(jbr::reg::metric::Phase phase, std::chrono::nanoseconds duration) noexcept;
+        //!
+        //! @brief Count read bytes.
+        //! @param bytes Bytes read.
+        //!
+        inline void read(std::uint64_t bytes) noexcept { mBytesRead.fetch_add(bytes, std::memory_order_relaxed); }
+        //!
+        //! @brief Count written bytes.
+        //! @param bytes Bytes written.
+        //!
+        inline void written(std::uint64_t bytes) noexcept { mBytesWritten.fetch_add(bytes, std::memory_order_relaxed); }
+        //!
+        //! @brief Count a cache lookup.
+        //! @param cache Cache.
+        //! @param hit Cache hit status.
+        //!
+        void    lookup(jbr::reg::metric::Cache cache, bool hit) noexcept;
+        //!
+        //! @brief Extract all the metrics.
+        //! @return Metrics snapshot.
+        //!
+        [[nodiscard]]
+        jbr::reg::metric::Snapshot  snapshot() const noexcept(false);
+        //!
+        //! @brief Reset all the metrics.
+        //!
+        void    reset() noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_METRICS_HPP
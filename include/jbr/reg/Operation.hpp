@@ -0,0 +1,233 @@
+//!
+//! @file Operation.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_OPERATION_HPP
+# define JBR_CREGISTER_REGISTER_OPERATION_HPP
+
+# include <jbr/reg/ThreadPool.hpp>
+# include <jbr/reg/exception.hpp>
+# include <condition_variable>
+# include <type_traits>
+# include <functional>
+# include <exception>
+# include <optional>
+# include <memory>
+# include <mutex>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Operation
+    //! @brief Asynchronous register operation result. The result can be waited with get() or awaited with co_await from a C++20
+    //! coroutine.
+    //! @note The job runs on the pool worker of its affinity, after the jobs previously launched with this affinity. A awaiting
+    //! coroutine is resumed on that worker, unless a executor is given through resumeOn() : it must then not block it. Waiting
+    //! the operation (wait(), get()) from the worker of its affinity would never complete, it raises instead.
+    //! @tparam T Operation result type.
+    //!
+    template <typename T>
+    class Operation final
+    {
+    public:
+        using Executor = std::function<void(std::function<void()> &&resume)>; //!< Run a awaiting coroutine resume.
+
+    private:
+        //!
+        //! @struct State
+        //! @brief Operation state shared with the worker running the operation.
+        //!
+        struct State
+        {
+            std::mutex                                                          mMutex; //!< Protect the state.
+            std::condition_variable                                             mCondition; //!< Notified on completion.
+            bool                                                                mDone = false; //!< Completion status.
+            std::conditional_t<std::is_void_v<T>, bool, std::optional<T>>       mValue; //!< Operation result.
+            std::exception_ptr                                                  mError; //!< Exception raised by the operation.
+            std::function<void()>                                               mContinuation; //!< Awaiting coroutine resume.
+            Executor                                                            mExecutor; //!< Run the resume, inline if empty.
+            jbr::reg::ThreadPool                                                *mPool = nullptr; //!< Pool running the job.
+            std::size_t                                                         mAffinity = 0; //!< Job affinity.
+        };
+
+    private:
+        std::shared_ptr<State>  mState; //!< Operation state.
+
+    public:
+        //!
+        //! @brief Run a job on a pool and extract his operation.
+        //! @param pool Pool running the job.
+        //! @param affinity Job affinity, jobs with the same affinity are run in order.
+        //! @param job Job to run.
+        //! @return Job operation.
+        //!
+        [[nodiscard]]
+        static Operation    launch(jbr::reg::ThreadPool &pool, std::size_t affinity, std::function<T()> &&job) noexcept(false)
+        {
+            Operation   operation;
+
+            operation.mState->mPool = &pool;
+            operation.mState->mAffinity = affinity;
+            pool.post(affinity, [state = operation.mState, job = std::move(job)]() { complete(*state, job); });
+            return (operation);
+        }
+
+    public:
+        //!
+        //! @brief Operation constructor.
+        //!
+        Operation() : mState(std::make_shared<State>()) {}
+
+    public:
+        //!
+        //! @brief Check if the operation is completed.
+        //! @return Completion status.
+        //!
+        [[nodiscard]]
+        bool    ready() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(mState->mMutex);
+
+            return (mState->mDone);
+        }
+        //!
+        //! @brief Block until the operation is completed.
+        //! @throw Raise if called from the worker of the operation affinity while not completed, it would never complete.
+        //!
+        void    wait() const noexcept(false)
+        {
+            std::unique_lock<std::mutex>    lock(mState->mMutex);
+
+            if (!mState->mDone && mState->mPool != nullptr && mState->mPool->runsOn(mState->mAffinity))
+                throw jbr::reg::exception("Impossible to wait a register operation from the worker running it, it must be awaited instead.");
+            mState->mCondition.wait(lock, [this]() { return (mState->mDone); });
+        }
+        //!
+        //! @brief Block until the operation is completed and extract his result.
+        //! @return Operation result.
+        //! @throw Raise the exception raised by the operation, or if called from the worker of the operation affinity while not completed.
+        //!
+        T       get() noexcept(false)
+        {
+            wait();
+            if (mState->mError)
+                std::rethrow_exception(mState->mError);
+            if constexpr (!std::is_void_v<T>)
+                return (std::move(mState->mValue.value()));
+        }
+
+        //!
+        //! @brief Resume the awaiting coroutine through a executor, instead of the worker which completed the operation, even if the
+        //! operation is already completed.
+        //! @param executor Executor running the resume. If it raises, the coroutine is resumed inline.
+        //! @return This operation, to await.
+        //!
+        Operation   &resumeOn(Executor &&executor) noexcept(false)
+        {
+            std::lock_guard<std::mutex> lock(mState->mMutex);
+
+            mState->mExecutor = std::move(executor);
+            return (*this);
+        }
+
+    public:
+        //!
+        //! @brief Awaitable interface, check if the coroutine must be suspended.
+        //! @return True if the operation is already completed and no executor is given.
+        //!
+        [[nodiscard]]
+        bool    await_ready() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(mState->mMutex);
+
+            return (mState->mDone && !mState->mExecutor);
+        }
+        //!
+        //! @brief Awaitable interface, resume the coroutine when the operation is completed.
+        //! @tparam Handle Coroutine handle type.
+        //! @param handle Awaiting coroutine handle.
+        //! @return False if the operation completed meanwhile without executor, or if the executor raised : the coroutine is then
+        //! not suspended.
+        //!
+        template <typename Handle>
+        bool    await_suspend(Handle handle) noexcept(false)
+        {
+            std::unique_lock<std::mutex>    lock(mState->mMutex);
+
+            if (!mState->mDone)
+            {
+                mState->mContinuation = [handle]() mutable { handle.resume(); };
+                return (true);
+            }
+            if (!mState->mExecutor)
+                return (false);
+
+            Executor    executor = std::move(mState->mExecutor);
+
+            lock.unlock();
+            try {
+                executor([handle]() mutable { handle.resume(); });
+            }
+            catch (...) {
+                return (false);
+            }
+            return (true);
+        }
+        //!
+        //! @brief Awaitable interface, extract the operation result.
+        //! @return Operation result.
+        //! @throw Raise the exception raised by the operation.
+        //!
+        T       await_resume() noexcept(false) { return (get()); }
+
+    private:
+        //!
+        //! @brief Run a job, store his result and resume the awaiting coroutine, through its executor if any.
+        //! @param state Operation state.
+        //! @param job Job to run.
+        //!
+        static void complete(State &state, const std::function<T()> &job) noexcept
+        {
+            std::function<void()>   continuation;
+            Executor                executor;
+
+            try {
+                if constexpr (std::is_void_v<T>)
+                    job();
+                else
+                    state.mValue.emplace(job());
+            }
+            catch (...) {
+                state.mError = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(state.mMutex);
+
+                state.mDone = true;
+                continuation = std::move(state.mContinuation);
+                executor = std::move(state.mExecutor);
+            }
+            state.mCondition.notify_all();
+            if (continuation && executor)
+            {
+                try {
+                    executor(std::move(continuation));
+                    return ;
+                }
+                catch (...) {
+                }
+            }
+            if (continuation)
+                continuation();
+        }
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_OPERATION_HPP
@@ -25,13 +25,13 @@ namespace jbr::reg
         //!
         //! @brief Structure initializer. All rights are true by default.
         //!
-        Permission() : mRead(true), mWrite(true) {}
+        constexpr Permission() : mRead(true), mWrite(true) {}
         //!
         //! @brief Structure initializer with custom rights initialization.
         //! @param rd Reading rights.
         //! @param wr Writing rights.
         //!
-        Permission(bool rd, bool wr) :  mRead(rd), mWrite(wr) {}
+        constexpr Permission(bool rd, bool wr) :  mRead(rd), mWrite(wr) {}
     };
 
 }
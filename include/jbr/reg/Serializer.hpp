@@ -0,0 +1,128 @@
+//!
+//! @file Serializer.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_SERIALIZER_HPP
+# define JBR_CREGISTER_REGISTER_SERIALIZER_HPP
+
+# include <tinyxml2.h>
+# include <cstddef>
+# include <cstdio>
+# include <memory>
+# include <string>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Serializer
+    //! @brief Streaming register writer, producing the tinyxml2::XMLPrinter format. The output goes through a large buffer
+    //! written by whole chunks, and the texts not accessed since the parsing are written back as parsed, without escaping.
+    //!
+    class Serializer final : public tinyxml2::XMLVisitor
+    {
+    public:
+        static constexpr std::size_t    mBufferSize = 256 * 1024; //!< Output buffer size, the size of each write.
+
+    private:
+        std::string             mPath; //!< Written file location.
+        std::FILE               *mFile; //!< Written file, not buffered by the C library.
+        std::unique_ptr<char[]> mBuffer; //!< Output buffer.
+        std::size_t             mUsed; //!< Output buffer used bytes.
+        std::size_t             mWritten; //!< Bytes written to the file.
+        bool                    mFailed; //!< Tell if a write has failed.
+        bool                    mProcessEntities; //!< Tell if the texts special characters are escaped.
+        bool                    mElementJustOpened; //!< Tell if the last element start tag is not closed yet.
+        bool                    mFirstElement; //!< Tell if nothing has been written yet.
+        int                     mDepth; //!< Current element depth.
+        int                     mTextDepth; //!< Depth of the element holding the last text, -1 if none.
+
+    public:
+        //!
+        //! @brief Open the file to write.
+        //! @param path File location, truncated.
+        //! @throw Raise if the file can not be opened.
+        //!
+        explicit Serializer(std::string path) noexcept(false);
+        //!
+        //! @brief Close the written file.
+        //!
+        ~Serializer() override;
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Serializer(const Serializer &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Serializer  &operator=(const Serializer &) = delete;
+
+    public:
+        //!
+        //! @brief Write a document, the output buffer is written to the file each time it is full.
+        //! @param document Document to write.
+        //!
+        void                        serialize(const tinyxml2::XMLDocument &document) noexcept;
+        //!
+        //! @brief Write the rest of the output buffer to the file.
+        //! @throw Raise if a write has failed.
+        //!
+        void                        finish() noexcept(false);
+        //!
+        //! @brief Extract the bytes written to the file.
+        //! @return Written bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t          written() const noexcept { return (mWritten); }
+
+    public:
+        bool    VisitEnter(const tinyxml2::XMLDocument &document) override;
+        bool    VisitEnter(const tinyxml2::XMLElement &element, const tinyxml2::XMLAttribute *attribute) override;
+        bool    VisitExit(const tinyxml2::XMLElement &element) override;
+        bool    Visit(const tinyxml2::XMLText &text) override;
+        bool    Visit(const tinyxml2::XMLComment &comment) override;
+        bool    Visit(const tinyxml2::XMLDeclaration &declaration) override;
+        bool    Visit(const tinyxml2::XMLUnknown &unknown) override;
+
+    private:
+        //!
+        //! @brief Append data to the output buffer, written to the file when full.
+        //! @param data Data to append.
+        //! @param size Data size.
+        //!
+        void    write(const char *data, std::size_t size) noexcept;
+        //!
+        //! @brief Append a null terminated string to the output buffer.
+        //! @param data String to append.
+        //!
+        void    write(const char *data) noexcept;
+        //!
+        //! @brief Append a string to the output buffer, its special characters escaped.
+        //! @param data String to append.
+        //! @param attribute Tell if the string is a attribute value, the quotes are then escaped too.
+        //!
+        void    escape(const char *data, bool attribute) noexcept;
+        //!
+        //! @brief Write the output buffer to the file.
+        //!
+        void    flush() noexcept;
+        //!
+        //! @brief Close the last element start tag if still open.
+        //!
+        void    seal() noexcept;
+        //!
+        //! @brief Go to a new line, indented to the current depth.
+        //!
+        void    indent() noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_SERIALIZER_HPP
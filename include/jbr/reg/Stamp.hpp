@@ -0,0 +1,29 @@
+//!
+//! @file Stamp.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_STAMP_HPP
+# define JBR_CREGISTER_REGISTER_STAMP_HPP
+
+# include <string>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @brief Compute the stamp of a register file. Registers are saved by replacing the file, the stamp (file identifier, size
+    //! and modification date) changes on each register save.
+    //! @param path Register location.
+    //! @return Register stamp, empty if the register does not exist.
+    //!
+    [[nodiscard]]
+    std::string stamp(const std::string &path) noexcept;
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_STAMP_HPP
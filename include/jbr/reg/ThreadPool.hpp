@@ -0,0 +1,126 @@
+//!
+//! @file ThreadPool.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_THREAD_POOL_HPP
+# define JBR_CREGISTER_REGISTER_THREAD_POOL_HPP
+
+# include <condition_variable>
+# include <functional>
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <vector>
+# include <deque>
+# include <mutex>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class ThreadPool
+    //! @brief Fixed size worker pool. Each worker owns his queue, jobs posted with the same affinity are run in order by the same worker.
+    //! @note A pool without worker runs the jobs synchronously, into the posting thread.
+    //!
+    class ThreadPool final
+    {
+    private:
+        //!
+        //! @struct Worker
+        //! @brief Worker thread and his jobs queue.
+        //!
+        struct Worker
+        {
+            std::mutex                          mMutex; //!< Protect the jobs queue.
+            std::condition_variable             mCondition; //!< Notified when a job is posted or when the worker must stop.
+            std::deque<std::function<void()>>   mJobs; //!< Pending jobs.
+            bool                                mRunning = true; //!< Worker running status.
+            std::thread                         mThread; //!< Worker thread.
+        };
+
+    private:
+        std::vector<std::unique_ptr<Worker>>    mWorkers; //!< Pool workers.
+        std::atomic<std::size_t>                mNext; //!< Next worker used for jobs without affinity.
+
+    public:
+        //!
+        //! @brief Extract the process register I/O pool.
+        //! @return Process I/O pool.
+        //!
+        [[nodiscard]]
+        static ThreadPool   &io() noexcept;
+        //!
+        //! @brief Extract the process CPU pool, for parallel parsing. Its callers work too, so it has one worker less than hardware threads.
+        //! @return Process CPU pool.
+        //!
+        [[nodiscard]]
+        static ThreadPool   &cpu() noexcept;
+
+    public:
+        //!
+        //! @brief Thread pool constructor. If no thread can be started the pool runs the jobs synchronously.
+        //! @param threads Number of worker threads, 0 to run all jobs synchronously.
+        //!
+        explicit ThreadPool(std::size_t threads) noexcept;
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        ThreadPool(const ThreadPool &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        ThreadPool  &operator=(const ThreadPool &) = delete;
+        //!
+        //! @brief Thread pool destructor. Pending jobs are run before the workers are stopped.
+        //!
+        ~ThreadPool();
+
+    public:
+        //!
+        //! @brief Extract the number of worker threads.
+        //! @return Number of workers, 0 if the jobs are run synchronously.
+        //!
+        [[nodiscard]]
+        inline std::size_t  size() const noexcept { return (mWorkers.size()); }
+        //!
+        //! @brief Post a job on the next worker.
+        //! @param job Job to run. Exceptions raised by the job are ignored.
+        //!
+        void    post(std::function<void()> &&job) noexcept(false);
+        //!
+        //! @brief Post a job on the worker associated to a affinity. Jobs with the same affinity are run in order.
+        //! @param affinity Job affinity, usually a hash of the resource used by the job.
+        //! @param job Job to run. Exceptions raised by the job are ignored.
+        //!
+        void    post(std::size_t affinity, std::function<void()> &&job) noexcept(false);
+        //!
+        //! @brief Check if the current thread is the worker associated to a affinity.
+        //! @param affinity Job affinity.
+        //! @return True if called from the worker running the jobs of this affinity.
+        //!
+        [[nodiscard]]
+        bool    runsOn(std::size_t affinity) const noexcept;
+
+    private:
+        //!
+        //! @brief Worker thread main loop.
+        //! @param worker Worker to run.
+        //!
+        static void run(Worker &worker) noexcept;
+        //!
+        //! @brief Run a job, ignoring exceptions.
+        //! @param job Job to run.
+        //!
+        static void execute(std::function<void()> &job) noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_THREAD_POOL_HPP
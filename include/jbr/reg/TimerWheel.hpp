@@ -0,0 +1,153 @@
+//!
+//! @file TimerWheel.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_TIMER_WHEEL_HPP
+# define JBR_CREGISTER_REGISTER_TIMER_WHEEL_HPP
+
+# include <cstdint>
+# include <utility>
+# include <vector>
+# include <array>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class TimerWheel
+    //! @brief Hierarchical timer wheel. Each level has 64 slots, a slot of level N covers 64^N ticks. Timers are inserted in O(1)
+    //! into the lowest level covering their deadline and are cascaded to the lower levels when the wheel reaches their slot.
+    //! @tparam T Timer payload.
+    //!
+    template <typename T>
+    class TimerWheel final
+    {
+    private:
+        static constexpr std::size_t    mBits = 6; //!< Slots index bits per level.
+        static constexpr std::uint64_t  mSlots = 1u << mBits; //!< Slots per level.
+        static constexpr std::uint64_t  mMask = mSlots - 1; //!< Slot index mask.
+        static constexpr std::size_t    mLevels = 4; //!< Number of levels, the wheel covers 64^4 ticks.
+
+        //!
+        //! @struct Timer
+        //! @brief Scheduled timer.
+        //!
+        struct Timer
+        {
+            std::uint64_t   mDeadline; //!< Deadline tick.
+            T               mPayload; //!< Timer payload.
+        };
+
+    private:
+        std::array<std::array<std::vector<Timer>, mSlots>, mLevels> mWheels; //!< Timers slots, by level.
+        std::uint64_t                                               mCurrent; //!< Next tick to process.
+        std::size_t                                                 mSize; //!< Number of scheduled timers.
+
+    public:
+        //!
+        //! @brief Timer wheel constructor.
+        //! @param current First tick to process.
+        //!
+        explicit TimerWheel(std::uint64_t current = 0) noexcept : mCurrent(current), mSize(0) {}
+
+    public:
+        //!
+        //! @brief Extract the number of scheduled timers.
+        //! @return Number of scheduled timers.
+        //!
+        [[nodiscard]]
+        inline std::size_t      size() const noexcept { return (mSize); }
+        //!
+        //! @brief Extract the next tick to process.
+        //! @return Next tick.
+        //!
+        [[nodiscard]]
+        inline std::uint64_t    current() const noexcept { return (mCurrent); }
+        //!
+        //! @brief Schedule a timer. A deadline already reached expires on the next processed tick.
+        //! @param deadline Deadline tick.
+        //! @param payload Timer payload.
+        //!
+        void    schedule(std::uint64_t deadline, T &&payload) noexcept(false)
+        {
+            insert(Timer{ deadline, std::move(payload) });
+            ++mSize;
+        }
+        //!
+        //! @brief Process all ticks up to a tick (included) and extract the expired timers payloads.
+        //! @param tick Last tick to process.
+        //! @return Expired timers payloads.
+        //!
+        [[nodiscard]]
+        std::vector<T>  advance(std::uint64_t tick) noexcept(false)
+        {
+            std::vector<T>  expired;
+
+            if (mSize == 0 && tick >= mCurrent)
+                mCurrent = tick + 1;
+            for (; mCurrent <= tick && mSize > 0; ++mCurrent)
+            {
+                for (std::size_t level = 1; level < mLevels && index(mCurrent, level - 1) == 0; ++level)
+                    cascade(level);
+
+                std::vector<Timer>  timers = std::move(mWheels[0][index(mCurrent, 0)]);
+
+                mWheels[0][index(mCurrent, 0)].clear();
+                for (Timer &timer : timers)
+                {
+                    expired.push_back(std::move(timer.mPayload));
+                    --mSize;
+                }
+            }
+            if (mSize == 0 && tick >= mCurrent)
+                mCurrent = tick + 1;
+            return (expired);
+        }
+
+    private:
+        //!
+        //! @brief Extract the slot index of a tick into a level.
+        //! @param tick Tick.
+        //! @param level Wheel level.
+        //! @return Slot index.
+        //!
+        [[nodiscard]]
+        static constexpr std::size_t    index(std::uint64_t tick, std::size_t level) noexcept { return ((tick >> (level * mBits)) & mMask); }
+        //!
+        //! @brief Insert a timer into the lowest level covering his deadline.
+        //! @param timer Timer to insert.
+        //!
+        void    insert(Timer &&timer) noexcept(false)
+        {
+            std::uint64_t   deadline = timer.mDeadline < mCurrent ? mCurrent : timer.mDeadline;
+            std::uint64_t   delta = deadline - mCurrent;
+            std::size_t     level = 0;
+
+            while (level < mLevels - 1 && delta >= (std::uint64_t(1) << ((level + 1) * mBits)))
+                ++level;
+            if (delta >= (std::uint64_t(1) << (mLevels * mBits)))
+                deadline = mCurrent + (std::uint64_t(1) << (mLevels * mBits)) - 1; // Re-inserted with his real deadline on cascade.
+            mWheels[level][index(deadline, level)].push_back(std::move(timer));
+        }
+        //!
+        //! @brief Move the timers of the current slot of a level to the lower levels.
+        //! @param level Wheel level.
+        //!
+        void    cascade(std::size_t level) noexcept(false)
+        {
+            std::vector<Timer>  timers = std::move(mWheels[level][index(mCurrent, level)]);
+
+            mWheels[level][index(mCurrent, level)].clear();
+            for (Timer &timer : timers)
+                insert(std::move(timer));
+        }
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_TIMER_WHEEL_HPP
@@ -0,0 +1,120 @@
+//!
+//! @file Tracer.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_TRACER_HPP
+# define JBR_CREGISTER_REGISTER_TRACER_HPP
+
+# include <cstdint>
+# include <chrono>
+# include <string>
+# include <vector>
+# include <atomic>
+# include <mutex>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class Tracer
+    //! @brief Process wide trace recorder. While started, each register operation and phase (lock, I/O, parse, search,
+    //! serialize) is recorded as a Chrome trace event, written as JSON on stop (viewable in Perfetto or chrome://tracing).
+    //! @note When stopped, a measure only costs a atomic load. Building with JBR_REG_NO_TRACING (ENABLE_TRACING=OFF)
+    //! removes the instrumentation entirely, start then raises.
+    //!
+    class Tracer final
+    {
+    public:
+        static constexpr std::size_t    mMaxEvents = 1000000; //!< Maximum number of recorded events, the following are dropped.
+
+    private:
+        //!
+        //! @struct Event
+        //! @brief Complete trace event.
+        //!
+        struct Event
+        {
+            const char                  *mName; //!< Event name.
+            const char                  *mCategory; //!< Event category.
+            std::chrono::nanoseconds    mStart; //!< Event start, since the trace start.
+            std::chrono::nanoseconds    mDuration; //!< Event duration.
+            std::uint32_t               mThread; //!< Event thread.
+            bool                        mFailed; //!< Operation failure status.
+        };
+
+    private:
+        std::atomic<bool>                       mEnabled; //!< Recording status.
+        std::mutex                              mMutex; //!< Protect the events.
+        std::string                             mPath; //!< Trace file path.
+        std::chrono::steady_clock::time_point   mOrigin; //!< Trace start.
+        std::vector<Event>                      mEvents; //!< Recorded events.
+        std::size_t                             mDropped; //!< Dropped events, above the maximum.
+
+    public:
+        //!
+        //! @brief Extract the process tracer.
+        //! @return Process tracer.
+        //!
+        [[nodiscard]]
+        static Tracer   &get() noexcept;
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Tracer(const Tracer &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Tracer  &operator=(const Tracer &) = delete;
+
+    private:
+        //!
+        //! @brief Stopped tracer constructor.
+        //!
+        Tracer() noexcept;
+        //!
+        //! @brief Tracer destructor.
+        //!
+        ~Tracer() = default;
+
+    public:
+        //!
+        //! @brief Check if the tracer records.
+        //! @return Recording status.
+        //!
+        [[nodiscard]]
+        inline bool enabled() const noexcept { return (mEnabled.load(std::memory_order_relaxed)); }
+        //!
+        //! @brief Start recording, the previous recording is discarded.
+        //! @param path Trace file path, written on stop.
+        //! @throw Raise if the path is empty or if the tracing has been removed at compile time.
+        //!
+        void        start(const std::string &path) noexcept(false);
+        //!
+        //! @brief Stop recording and write the trace file, in Chrome trace event JSON format.
+        //! @throw Raise if the tracer is not started or if the trace file can't be written.
+        //!
+        void        stop() noexcept(false);
+        //!
+        //! @brief Record a complete event, ignored if the tracer is stopped.
+        //! @param name Event name, must be a static string.
+        //! @param category Event category, must be a static string.
+        //! @param start Event start.
+        //! @param duration Event duration.
+        //! @param failed Operation failure status.
+        //!
+        void        record(const char *name, const char *category, std::chrono::steady_clock::time_point start,
+                           std::chrono::nanoseconds duration, bool failed) noexcept;
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_TRACER_HPP
@@ -0,0 +1,177 @@
+//!
+//! @file ValueIndex.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_VALUE_INDEX_HPP
+# define JBR_CREGISTER_REGISTER_VALUE_INDEX_HPP
+
+# include <filesystem>
+# include <optional>
+# include <chrono>
+# include <cstdint>
+# include <string>
+# include <vector>
+# include <map>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @class ValueIndex
+    //! @brief Optional reverse index of a register, from the variables values to their keys, stored into the '<register>.index'
+    //! directory. Each value hash (see BlobStore::identify) has his own bucket file listing the keys holding it, with a second
+    //! check digest of their value telling apart the values of a hash collision, a lookup only reads one bucket. The index is
+    //! maintained on each register save while the directory exists, its buckets are replaced atomically.
+    //! @note A stamp of the indexed register file is saved with the index, a index out of date (register changed by a other
+    //! tool) is rebuilt.
+    //!
+    class ValueIndex final
+    {
+    public:
+        static constexpr std::uint64_t  mCheckBasis = 0x9e3779b97f4a7c15ull; //!< Check digest of a empty content.
+
+    public:
+        //!
+        //! @struct Entry
+        //! @brief Indexed variable.
+        //!
+        struct Entry
+        {
+            std::string                                             mKey; //!< Variable key.
+            std::optional<std::chrono::system_clock::time_point>    mExpiration; //!< Variable expiration date.
+            std::uint64_t                                           mCheck; //!< Variable value check digest.
+        };
+
+        //!
+        //! @struct Change
+        //! @brief Variable change to apply on the index.
+        //!
+        struct Change
+        {
+            std::string                                             mKey; //!< Variable key.
+            std::string                                             mFrom; //!< Previous value bucket, empty if the variable was not indexed.
+            std::string                                             mTo; //!< New value bucket, empty if the variable is not indexed anymore.
+            std::optional<std::chrono::system_clock::time_point>    mExpiration; //!< New variable expiration date.
+            std::uint64_t                                           mCheck; //!< New variable value check digest.
+        };
+
+        using Changes = std::vector<Change>; //!< Changes of a register save.
+        using Buckets = std::map<std::string, std::vector<Entry>>; //!< Whole index content, by bucket.
+
+    private:
+        std::string             mRegister; //!< Register location.
+        std::filesystem::path   mDirectory; //!< Index directory.
+
+    public:
+        //!
+        //! @brief Value index constructor.
+        //! @param registerPath Register location, the index is stored into the '<registerPath>.index' directory.
+        //!
+        explicit ValueIndex(const std::string &registerPath) : mRegister(registerPath), mDirectory(registerPath + ".index") {}
+
+    public:
+        //!
+        //! @brief Compute the check digest of a value, independent from its bucket hash. May be chained to digest a value by parts.
+        //! @param data Value data.
+        //! @param size Value size.
+        //! @param hash Check digest of the previous parts.
+        //! @return Check digest.
+        //!
+        [[nodiscard]]
+        static std::uint64_t    check(const char *data, std::size_t size, std::uint64_t hash = mCheckBasis) noexcept;
+
+    public:
+        //!
+        //! @brief Check if the register is indexed.
+        //! @return True if the index directory exist.
+        //!
+        [[nodiscard]]
+        bool                enabled() const noexcept;
+        //!
+        //! @brief Check if the index is up to date with the register file.
+        //! @param readable Filled with the register readable status saved with the index.
+        //! @return Up to date status.
+        //!
+        [[nodiscard]]
+        bool                fresh(bool &readable) const noexcept;
+        //!
+        //! @brief Extract a bucket.
+        //! @param bucket Value bucket.
+        //! @return Indexed variables holding this value, or a other value with the same hash (see Entry::mCheck).
+        //! @throw Raise if the bucket can't be read.
+        //! @warning Must be called under the register lock, shared or exclusive.
+        //!
+        [[nodiscard]]
+        std::vector<Entry>  read(const std::string &bucket) const noexcept(false);
+        //!
+        //! @brief Apply the changes of a register save, then stamp the index.
+        //! @param changes Variables changes.
+        //! @param registerStamp Stamp of the saved register file (see jbr::reg::stamp).
+        //! @param readable Register readable status.
+        //! @throw Raise if a bucket can't be written.
+        //! @warning Must be called under the register lock, before the saved register replaces the locked one.
+        //!
+        void                apply(const Changes &changes, const std::string &registerStamp, bool readable) const noexcept(false);
+        //!
+        //! @brief Replace the whole index content, then stamp the index.
+        //! @param buckets Index content.
+        //! @param registerStamp Stamp of the indexed register file.
+        //! @param readable Register readable status.
+        //! @throw Raise if the index can't be written.
+        //! @warning Must be called under the register lock.
+        //!
+        void                rebuild(const Buckets &buckets, const std::string &registerStamp, bool readable) const noexcept(false);
+        //!
+        //! @brief Create the index directory.
+        //! @throw Raise if the directory can't be created.
+        //!
+        void                create() const noexcept(false);
+        //!
+        //! @brief Copy the index to a other register location. The copy is rebuilt on his first use.
+        //! @param target Target index.
+        //! @throw Raise if the index can't be copied.
+        //!
+        void                copy(const ValueIndex &target) const noexcept(false);
+        //!
+        //! @brief Move the index to a other register location.
+        //! @param target Target index.
+        //! @throw Raise if the index can't be moved.
+        //!
+        void                move(const ValueIndex &target) const noexcept(false);
+        //!
+        //! @brief Remove the index directory.
+        //!
+        void                destroy() const noexcept;
+
+    private:
+        //!
+        //! @brief Save the register stamp into the index.
+        //! @param registerStamp Stamp of the indexed register file.
+        //! @param readable Register readable status.
+        //! @throw Raise if the stamp can't be written.
+        //!
+        void                stamp(const std::string &registerStamp, bool readable) const noexcept(false);
+        //!
+        //! @brief Get a temporary file name of the index, unique to the process and the call.
+        //! @param name Replaced file name.
+        //! @return Temporary file location.
+        //!
+        [[nodiscard]]
+        std::filesystem::path   temporary(const std::string &name) const noexcept(false);
+        //!
+        //! @brief Replace the content of a bucket file through a temporary file, the file is removed if the bucket is empty.
+        //! @param bucket Value bucket.
+        //! @param entries Bucket content.
+        //! @throw Raise if the bucket can't be written.
+        //!
+        void                write(const std::string &bucket, const std::vector<Entry> &entries) const noexcept(false);
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_VALUE_INDEX_HPP
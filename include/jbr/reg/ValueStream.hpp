@@ -0,0 +1,225 @@
+//!
+//! @file ValueStream.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_VALUE_STREAM_HPP
+# define JBR_CREGISTER_REGISTER_VALUE_STREAM_HPP
+
+# include <jbr/reg/BlobStore.hpp>
+# include <istream>
+# include <ostream>
+# include <utility>
+# include <string>
+# include <vector>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+    //!
+    //! @class Instance
+    //! @note Forward declaration
+    //!
+    class Instance;
+
+    //!
+    //! @class ValueReader
+    //! @brief Input stream on a register variable value. Values stored out of line are read chunk by chunk, only one chunk is
+    //! held in memory.
+    //! @note The stream goes bad if the value is replaced and his chunks collected while reading, after the blob collect delay.
+    //!
+    class ValueReader final : public std::istream
+    {
+        friend jbr::reg::Instance; //!< Register instance is allow to create value readers.
+
+    private:
+        //!
+        //! @class Buffer
+        //! @brief Stream buffer loading the chunks on demand.
+        //!
+        class Buffer final : public std::streambuf
+        {
+        private:
+            jbr::reg::BlobStore         mStore; //!< Register chunks store.
+            std::vector<std::string>    mChunks; //!< Value chunks identifiers.
+            std::size_t                 mNext; //!< Next chunk to load.
+            std::string                 mCurrent; //!< Chunk currently read.
+
+        public:
+            //!
+            //! @brief Buffer constructor.
+            //! @param store Register chunks store.
+            //! @param chunks Value chunks identifiers.
+            //! @param value Inline value, read before the chunks.
+            //!
+            Buffer(jbr::reg::BlobStore &&store, std::vector<std::string> &&chunks, std::string &&value) noexcept;
+
+        protected:
+            //!
+            //! @brief Load the next chunk.
+            //! @return Next character, eof at the end of the value.
+            //! @throw Raise if the chunk can't be read.
+            //!
+            int_type    underflow() override;
+        };
+
+    private:
+        Buffer      mBuffer; //!< Stream buffer.
+        std::size_t mSize; //!< Value size, in bytes.
+
+    private:
+        //!
+        //! @brief Value reader constructor.
+        //! @param store Register chunks store.
+        //! @param chunks Value chunks identifiers, empty for inline values.
+        //! @param value Inline value.
+        //! @param size Value size, in bytes.
+        //!
+        ValueReader(jbr::reg::BlobStore &&store, std::vector<std::string> &&chunks, std::string &&value, std::size_t size) noexcept;
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        ValueReader(const ValueReader &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        ValueReader &operator=(const ValueReader &) = delete;
+
+    public:
+        //!
+        //! @brief Extract the value size.
+        //! @return Value size, in bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t  size() const noexcept { return (mSize); }
+    };
+
+    //!
+    //! @class ValueWriter
+    //! @brief Output stream replacing a register variable value. Written data are cut into chunks staged on disk as soon as a
+    //! chunk is full, only one chunk is held in memory. The register is updated by commit().
+    //! @warning The writer must not outlive the register instance which created it.
+    //!
+    class ValueWriter final : public std::ostream
+    {
+        friend jbr::reg::Instance; //!< Register instance is allow to create value writers.
+
+    public:
+        using Staged = std::vector<std::pair<std::string, std::filesystem::path>>; //!< Staged chunks, identifier and pending file.
+
+    private:
+        //!
+        //! @class Buffer
+        //! @brief Stream buffer staging full chunks.
+        //!
+        class Buffer final : public std::streambuf
+        {
+        private:
+            jbr::reg::BlobStore mStore; //!< Register chunks store.
+            std::vector<char>   mData; //!< Chunk currently written.
+            Staged              mStaged; //!< Staged chunks.
+            std::size_t         mSize; //!< Written size, in bytes.
+
+        public:
+            //!
+            //! @brief Buffer constructor.
+            //! @param store Register chunks store.
+            //!
+            explicit Buffer(jbr::reg::BlobStore &&store) noexcept(false);
+            //!
+            //! @brief Buffer destructor, discard the staged chunks.
+            //!
+            ~Buffer() override { discard(); }
+
+        public:
+            //!
+            //! @brief Extract the written size.
+            //! @return Written size, in bytes.
+            //!
+            [[nodiscard]]
+            inline std::size_t  size() const noexcept { return (mSize + static_cast<std::size_t>(pptr() - pbase())); }
+            //!
+            //! @brief Extract the staged chunks.
+            //! @return Staged chunks.
+            //!
+            [[nodiscard]]
+            inline const Staged &staged() const noexcept { return (mStaged); }
+            //!
+            //! @brief Extract the data not staged yet.
+            //! @return Pending data.
+            //!
+            [[nodiscard]]
+            inline std::string  pending() const noexcept(false) { return (std::string(pbase(), pptr())); }
+            //!
+            //! @brief Stage the data currently written, if any.
+            //! @throw Raise if the chunk can't be staged.
+            //!
+            void                stage() noexcept(false);
+            //!
+            //! @brief Forget the written data and the staged chunks, they have been committed.
+            //!
+            void                release() noexcept;
+            //!
+            //! @brief Remove the staged chunks.
+            //!
+            void                discard() noexcept;
+
+        protected:
+            //!
+            //! @brief Stage the full chunk and start a new one.
+            //! @param character Character to write.
+            //! @return Written character, eof on error.
+            //!
+            int_type    overflow(int_type character) override;
+        };
+
+    private:
+        const jbr::reg::Instance    &mInstance; //!< Register instance.
+        std::string                 mKey; //!< Variable key.
+        Buffer                      mBuffer; //!< Stream buffer.
+
+    private:
+        //!
+        //! @brief Value writer constructor.
+        //! @param instance Register instance.
+        //! @param key Variable key.
+        //!
+        ValueWriter(const jbr::reg::Instance &instance, std::string &&key) noexcept(false);
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        ValueWriter(const ValueWriter &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        ValueWriter &operator=(const ValueWriter &) = delete;
+
+    public:
+        //!
+        //! @brief Extract the written size.
+        //! @return Written size, in bytes.
+        //!
+        [[nodiscard]]
+        inline std::size_t  size() const noexcept { return (mBuffer.size()); }
+        //!
+        //! @brief Replace the variable value by the written data, with a single register load and save under the register lock.
+        //! Data smaller than the register blob threshold are stored inline. A missing variable is created with the default rights.
+        //! @throw Raise if the register can't be updated or if the variable is not readable and updatable.
+        //!
+        void                commit() noexcept(false);
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_VALUE_STREAM_HPP
@@ -8,8 +8,10 @@
 # define JBR_CREGISTER_REGISTER_VARIABLE_HPP
 
 # include <jbr/reg/var/perm/Rights.hpp>
+# include <jbr/reg/var/perm/Mask.hpp>
 # include <jbr/reg/exception.hpp>
 # include <optional>
+# include <chrono>
 
 //!
 //! @namespace jbr::reg
@@ -24,9 +26,10 @@ namespace jbr::reg
     class   Variable final
     {
     private:
-        std::string                 mName; //!< Register variable name.
-        std::string                 mValue; //!< Register variable value.
-        jbr::reg::var::perm::Rights mRights; //!< Register variable rights associated.
+        std::string                                             mName; //!< Register variable name.
+        std::string                                             mValue; //!< Register variable value.
+        jbr::reg::var::perm::Rights                             mRights; //!< Register variable rights associated.
+        std::optional<std::chrono::system_clock::time_point>    mExpiration; //!< Register variable expiration date, never expire if not set.
 
     public:
         //!
@@ -39,8 +42,10 @@ namespace jbr::reg
         //! @param name Register variable name.
         //! @param value Register variable value.
         //! @param rights Register variable rights associated.
+        //! @param expiration Register variable expiration date, never expire if not set.
         //!
-        explicit Variable(std::string &&name, std::string &&value = "", const std::optional<jbr::reg::var::perm::Rights> &rights = std::nullopt);
+        explicit Variable(std::string &&name, std::string &&value = "", const std::optional<jbr::reg::var::perm::Rights> &rights = std::nullopt,
+                          const std::optional<std::chrono::system_clock::time_point> &expiration = std::nullopt);
         //!
         //! @brief Copy constructor.
         //!
@@ -94,6 +99,30 @@ namespace jbr::reg
         //! @throw Raise if current read does not allow it.
         //!
         void    reaccess(const jbr::reg::var::perm::Rights &rights) noexcept(false);
+        //!
+        //! @brief Extract the variable expiration date.
+        //! @return Expiration date, std::nullopt if the variable never expire.
+        //!
+        [[nodiscard]]
+        inline const std::optional<std::chrono::system_clock::time_point>   &expiration() const noexcept { return (mExpiration); }
+        //!
+        //! @brief Set the variable expiration date. A expired variable is not available anymore and is purged from his register.
+        //! @param expiration Expiration date, std::nullopt to never expire.
+        //! @throw Raise if the variable does not have to rights.
+        //!
+        void    expireAt(const std::optional<std::chrono::system_clock::time_point> &expiration) noexcept(false);
+        //!
+        //! @brief Set the variable expiration date relatively to now.
+        //! @param duration Variable time to live.
+        //! @throw Raise if the variable does not have to rights.
+        //!
+        inline void expireIn(std::chrono::system_clock::duration duration) noexcept(false) { expireAt(std::chrono::system_clock::now() + duration); }
+        //!
+        //! @brief Check if the variable is expired.
+        //! @return Expired status.
+        //!
+        [[nodiscard]]
+        inline bool isExpired() const noexcept { return (mExpiration != std::nullopt && mExpiration.value() <= std::chrono::system_clock::now()); }
 
     public:
         //!
@@ -102,42 +131,42 @@ namespace jbr::reg
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isReadable() const noexcept { return (mRights.mRead); }
+        inline bool isReadable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isReadable()); }
         //!
         //! @brief Check if the variable is writable. The variable is not writable if the fields write from register/body/variable/rights nodes is false.
         //! @return Writable status.
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isWritable() const noexcept { return (mRights.mWrite); }
+        inline bool isWritable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isWritable()); }
         //!
         //! @brief Check if the variable is updatable. The variable is not updatable if the fields write or update from register/body/variable/rights nodes is false.
         //! @return Updatable status.
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isUpdatable() const noexcept { return (mRights.mWrite && mRights.mUpdate); }
+        inline bool isUpdatable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isUpdatable()); }
         //!
         //! @brief Check if the variable is renamable. The variable is not renamable if the fields write, update or rename from register/body/variable/rights nodes is false.
         //! @return Renamable status.
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isRenamable() const noexcept { return (mRights.mWrite && mRights.mUpdate && mRights.mRename); }
+        inline bool isRenamable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isRenamable()); }
         //!
         //! @brief Check if the variable is copyable. The variable is not copyable if the fields read or copy from register/body/variable/rights nodes is false.
         //! @return Copyable status.
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isCopyable() const noexcept { return (mRights.mRead && mRights.mCopy); }
+        inline bool isCopyable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isCopyable()); }
         //!
         //! @brief Check if the variable is removable. The variable is not removable if the fields read or remove from register/body/variable/rights nodes is false.
         //! @return Removable status.
         //! @throw Raise if impossible to extract the rights data from the variable.
         //!
         [[nodiscard]]
-        inline bool isRemovable() const noexcept { return (mRights.mRead && mRights.mRemove); }
+        inline bool isRemovable() const noexcept { return (jbr::reg::var::perm::Mask(mRights).isRemovable()); }
     };
 
 }
@@ -0,0 +1,42 @@
+//!
+//! @file VariableView.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_VARIABLE_VIEW_HPP
+# define JBR_CREGISTER_REGISTER_VARIABLE_VIEW_HPP
+
+# include <jbr/reg/var/perm/Rights.hpp>
+# include <string_view>
+# include <functional>
+# include <optional>
+# include <chrono>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @struct VariableView
+    //! @brief Lightweight view of a register variable, pointing into the loaded register.
+    //! @warning The view is only valid during the visitor call, copy the data to keep them.
+    //!
+    struct VariableView
+    {
+        std::string_view                                        mKey; //!< Variable key.
+        std::string_view                                        mValue; //!< Variable value, empty if the variable is not readable.
+        jbr::reg::var::perm::Rights                             mRights; //!< Variable rights.
+        std::optional<std::chrono::system_clock::time_point>    mExpiration; //!< Variable expiration date, std::nullopt if the variable never expire.
+    };
+
+    //!
+    //! @brief Variables visitor, return false to stop the iteration.
+    //!
+    using Visitor = std::function<bool(const jbr::reg::VariableView &variable)>;
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_VARIABLE_VIEW_HPP
@@ -0,0 +1,195 @@
+//!
+//! @file Watcher.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_WATCHER_HPP
+# define JBR_CREGISTER_REGISTER_WATCHER_HPP
+
+# include <jbr/reg/Variable.hpp>
+# include <filesystem>
+# include <functional>
+# include <atomic>
+# include <thread>
+# include <vector>
+# include <mutex>
+# include <map>
+# include <set>
+
+//!
+//! @namespace jbr::reg
+//!
+namespace jbr::reg
+{
+
+    //!
+    //! @brief Watch subscription identifier.
+    //!
+    using WatchId = std::size_t;
+    //!
+    //! @brief Watch callback. Called with the changed variable key and his new state, std::nullopt if the variable has been removed.
+    //!
+    using WatchCallback = std::function<void(const char *key, const std::optional<jbr::reg::Variable> &variable)>;
+
+    //!
+    //! @class Watcher
+    //! @brief Process wide register change notifier. A single thread detects register files modification (inotify on linux, polling
+    //! on other systems), reloads the register once, diffs the old and new bodies and calls the subscribers of the changed keys.
+    //! @warning Callbacks are called from the watcher thread. Exceptions raised by callbacks are ignored.
+    //!
+    class Watcher final
+    {
+    private:
+        //!
+        //! @struct Entry
+        //! @brief Variable state kept to detect changes.
+        //!
+        struct Entry
+        {
+            std::string                 mValue; //!< Variable value, empty for the values stored out of line.
+            std::vector<std::string>    mChunks; //!< Value chunks identifiers, content addressed, empty for inline values.
+            jbr::reg::var::perm::Rights mRights; //!< Variable rights.
+        };
+        //!
+        //! @brief Register body, variables entries sorted by key.
+        //!
+        using Body = std::map<std::string, Entry>;
+        //!
+        //! @struct Subscription
+        //! @brief Subscriber information's.
+        //!
+        struct Subscription
+        {
+            std::string                 mPath; //!< Watched register location.
+            std::optional<std::string>  mKey; //!< Watched variable key, all variables are watched if not set.
+            jbr::reg::WatchCallback     mCallback; //!< Subscriber callback.
+        };
+        //!
+        //! @struct Target
+        //! @brief Watched register information's.
+        //!
+        struct Target
+        {
+            Body                            mBody; //!< Last known register body.
+            std::filesystem::file_time_type mStamp; //!< Last known register modification time.
+            int                             mDirectory; //!< Parent directory watch descriptor, -1 if polling.
+            std::string                     mFileName; //!< Register file name into his parent directory.
+            std::size_t                     mSubscribers; //!< Number of subscriptions on this register.
+        };
+
+    private:
+        std::mutex                              mMutex; //!< Protect subscriptions and targets.
+        std::map<jbr::reg::WatchId, Subscription> mSubscriptions; //!< All subscriptions.
+        std::map<std::string, Target>           mTargets; //!< Watched registers, by location.
+        std::map<int, std::size_t>              mDirectories; //!< Watched directories references count, by watch descriptor.
+        jbr::reg::WatchId                       mNextId; //!< Next subscription identifier.
+        int                                     mNotifier; //!< Inotify file descriptor, -1 if polling.
+        std::atomic<bool>                       mRunning; //!< Watcher thread running status.
+        std::thread                             mThread; //!< Watcher thread.
+
+    public:
+        //!
+        //! @brief Extract the process watcher.
+        //! @return Process watcher.
+        //!
+        [[nodiscard]]
+        static Watcher  &get() noexcept;
+
+    public:
+        //!
+        //! @brief Copy constructor.
+        //! @warning Not usable.
+        //!
+        Watcher(const Watcher &) = delete;
+        //!
+        //! @brief Equal overload operator.
+        //! @warning Not usable.
+        //!
+        Watcher &operator=(const Watcher &) = delete;
+
+    private:
+        //!
+        //! @brief Watcher constructor. The watcher thread is started on the first subscription.
+        //!
+        Watcher() noexcept;
+        //!
+        //! @brief Watcher destructor, stop the watcher thread.
+        //!
+        ~Watcher();
+
+    public:
+        //!
+        //! @brief Subscribe to a register changes.
+        //! @param path Register location.
+        //! @param key Variable key to watch, all variables are watched if not set.
+        //! @param callback Callback called on changes.
+        //! @return Subscription identifier.
+        //! @throw Raise if the register can't be loaded.
+        //!
+        [[nodiscard]]
+        jbr::reg::WatchId   subscribe(const std::string &path, std::optional<std::string> &&key, jbr::reg::WatchCallback &&callback) noexcept(false);
+        //!
+        //! @brief Remove a subscription. Nothing is done if the subscription does not exist.
+        //! @param id Subscription identifier.
+        //!
+        void                unsubscribe(jbr::reg::WatchId id) noexcept;
+        //!
+        //! @brief Move a subscription to a new register location, used when a register is moved.
+        //! @param id Subscription identifier.
+        //! @param path New register location.
+        //! @throw Raise if the register can't be loaded.
+        //!
+        void                relocate(jbr::reg::WatchId id, const std::string &path) noexcept(false);
+
+    private:
+        //!
+        //! @brief Add a subscription reference on a register, start to watch it if needed.
+        //! @param path Register location.
+        //! @warning Must be called with the mutex locked.
+        //! @throw Raise if the register can't be loaded.
+        //!
+        void    attach(const std::string &path) noexcept(false);
+        //!
+        //! @brief Remove a subscription reference on a register, stop to watch it if no more referenced.
+        //! @param path Register location.
+        //! @warning Must be called with the mutex locked.
+        //!
+        void    detach(const std::string &path) noexcept;
+        //!
+        //! @brief Watcher thread main loop.
+        //!
+        void    run() noexcept;
+        //!
+        //! @brief Extract the registers updated since the last check.
+        //! @return Updated registers locations.
+        //!
+        [[nodiscard]]
+        std::set<std::string>   poll() noexcept;
+        //!
+        //! @brief Reload a register, diff his body and call subscribers of the changed keys.
+        //! @param path Register location.
+        //!
+        void    refresh(const std::string &path) noexcept;
+        //!
+        //! @brief Load a register body. The values stored out of line are not read, their chunks identify them.
+        //! @param path Register location.
+        //! @return Register body.
+        //! @throw Raise if the register can't be loaded.
+        //!
+        [[nodiscard]]
+        static Body         load(const std::string &path) noexcept(false);
+        //!
+        //! @brief Read the value of a register body entry, from its chunks if stored out of line.
+        //! @param path Register location.
+        //! @param entry Register body entry.
+        //! @return Variable value.
+        //! @throw Raise if a chunk can't be read.
+        //!
+        [[nodiscard]]
+        static std::string  readValue(const std::string &path, const Entry &entry) noexcept(false);
+    };
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_WATCHER_HPP
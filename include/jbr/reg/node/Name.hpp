@@ -8,23 +8,76 @@
 #ifndef JBR_CREGISTER_REGISTER_NODE_NAME_HPP
 # define JBR_CREGISTER_REGISTER_NODE_NAME_HPP
 
+# include <cstddef>
+# include <string_view>
+
+//!
+//! @namespace jbr::reg::node
+//!
+namespace jbr::reg::node
+{
+
+    //!
+    //! @class Name
+    //! @brief Register node name, its length computed at compile time. Passed to the length aware tinyxml2 lookups, the
+    //! siblings names are compared by length before their characters.
+    //!
+    class Name final
+    {
+    private:
+        std::string_view    mView; //!< Node name, null terminated.
+
+    public:
+        //!
+        //! @brief Build a node name from a string literal.
+        //! @param literal Node name.
+        //!
+        template<std::size_t N>
+        constexpr Name(const char (&literal)[N]) noexcept : mView(literal, N - 1) {}
+
+    public:
+        //!
+        //! @brief Extract the node name characters.
+        //! @return Null terminated node name.
+        //!
+        [[nodiscard]]
+        constexpr const char        *data() const noexcept { return (mView.data()); }
+        //!
+        //! @brief Extract the node name length.
+        //! @return Node name length.
+        //!
+        [[nodiscard]]
+        constexpr std::size_t       size() const noexcept { return (mView.size()); }
+        //!
+        //! @brief Extract the node name.
+        //! @return Node name.
+        //!
+        [[nodiscard]]
+        constexpr std::string_view  view() const noexcept { return (mView); }
+        //!
+        //! @brief Convert to the null terminated node name, for the tinyxml2 functions not aware of the length.
+        //! @return Null terminated node name.
+        //!
+        constexpr operator const char *() const noexcept { return (mView.data()); }
+    };
+
+}
+
 //!
 //! @namespace jbr::reg::node::name
 //!
 namespace jbr::reg::node::name
 {
     //!
-    //! @static
     //! @def reg
     //! @brief 'register' main node from a register file.
     //!
-    static const char *reg = "register";
+    inline constexpr jbr::reg::node::Name reg = "register";
     //!
-    //! @static
     //! @def header
     //! @brief 'register/header' node from a register file.
     //!
-    static const char *header = "header";
+    inline constexpr jbr::reg::node::Name header = "header";
 
     //!
     //! @namespace jbr::reg::node::name::_header
@@ -32,66 +85,57 @@ namespace jbr::reg::node::name
     namespace _header
     {
         //!
-        //! @static
         //! @def version
         //! @brief 'register/header/version' field from a register file.
         //!
-        static const char *version = "version";
+        inline constexpr jbr::reg::node::Name version = "version";
         //!
-        //! @static
         //! @def rights
         //! @brief 'register/header/rights' node from a register file.
         //!
-        static const char *rights = "rights";
+        inline constexpr jbr::reg::node::Name rights = "rights";
         //!
         //! @namespace jbr::reg::node::name::_header::_rights
         //!
         namespace _rights
         {
             //!
-            //! @static
             //! @def read
             //! @brief 'register/header/rights/read' field from a register file.
             //!
-            static const char *read = "read";
+            inline constexpr jbr::reg::node::Name read = "read";
             //!
-            //! @static
             //! @def write
             //! @brief 'register/header/rights/write' field from a register file.
             //!
-            static const char *write = "write";
+            inline constexpr jbr::reg::node::Name write = "write";
             //!
-            //! @static
             //! @def open
             //! @brief 'register/header/rights/open' field from a register file.
             //!
-            static const char *open = "open";
+            inline constexpr jbr::reg::node::Name open = "open";
             //!
-            //! @static
             //! @def copy
             //! @brief 'register/header/rights/copy' field from a register file.
             //!
-            static const char *copy = "copy";
+            inline constexpr jbr::reg::node::Name copy = "copy";
             //!
-            //! @static
             //! @def move
             //! @brief 'register/header/rights/move' field from a register file.
             //!
-            static const char *move = "move";
+            inline constexpr jbr::reg::node::Name move = "move";
             //!
-            //! @static
             //! @def destroy
             //! @brief 'register/header/rights/destroy' field from a register file.
             //!
-            static const char *destroy = "destroy";
+            inline constexpr jbr::reg::node::Name destroy = "destroy";
         }
     }
     //!
-    //! @static
     //! @def body
     //! @brief 'register/body' node from a register file.
     //!
-    static const char *body = "body";
+    inline constexpr jbr::reg::node::Name body = "body";
 
     //!
     //! @namespace jbr::reg::node::name::_body
@@ -99,11 +143,10 @@ namespace jbr::reg::node::name
     namespace _body
     {
         //!
-        //! @static
         //! @def variable
         //! @brief 'register/body/variable' field from a register file.
         //!
-        static const char *variable = "variable";
+        inline constexpr jbr::reg::node::Name variable = "variable";
 
         //!
         //! @namespace jbr::reg::node::name::_body::_variable
@@ -111,64 +154,81 @@ namespace jbr::reg::node::name
         namespace _variable
         {
             //!
-            //! @static
             //! @def key
             //! @brief 'register/body/variable/key' field from a register file.
             //!
-            static const char *key = "key";
+            inline constexpr jbr::reg::node::Name key = "key";
             //!
-            //! @static
             //! @def value
             //! @brief 'register/body/variable/value' field from a register file.
             //!
-            static const char *value = "value";
+            inline constexpr jbr::reg::node::Name value = "value";
             //!
-            //! @static
             //! @def value
             //! @brief 'register/body/variable/rights' field from a register file.
             //!
-            static const char *rights = "rights";
+            inline constexpr jbr::reg::node::Name rights = "rights";
+            //!
+            //! @def expiration
+            //! @brief 'register/body/variable/expiration' field from a register file, expiration date in milliseconds since epoch.
+            //!
+            inline constexpr jbr::reg::node::Name expiration = "expiration";
+            //!
+            //! @def blob
+            //! @brief 'register/body/variable/blob' node from a register file, value stored out of line into chunks.
+            //!
+            inline constexpr jbr::reg::node::Name blob = "blob";
+            //!
+            //! @namespace jbr::reg::node::name::_body::_variable::_blob
+            //!
+            namespace _blob
+            {
+                //!
+                //! @def size
+                //! @brief 'register/body/variable/blob/size' field from a register file, value size in bytes.
+                //!
+                inline constexpr jbr::reg::node::Name size = "size";
+                //!
+                //! @def chunk
+                //! @brief 'register/body/variable/blob/chunk' field from a register file, chunk identifier. Chunks are read in order.
+                //!
+                inline constexpr jbr::reg::node::Name chunk = "chunk";
+            }
             //!
             //! @namespace jbr::reg::node::name::_body::_variable::_rights
             //!
             namespace _rights
             {
                 //!
-                //! @static
                 //! @def read
                 //! @brief 'register/body/variable/rights/read' field from a register file.
                 //!
-                static const char *read = "read";
+                inline constexpr jbr::reg::node::Name read = "read";
                 //!
-                //! @static
                 //! @def write
                 //! @brief 'register/body/variable/rights/write' field from a register file.
                 //!
-                static const char *write = "write";
+                inline constexpr jbr::reg::node::Name write = "write";
                 //!
-                //! @static
                 //! @def open
                 //! @brief 'register/body/variable/rights/update' field from a register file.
                 //!
-                static const char *update = "update";
+                inline constexpr jbr::reg::node::Name update = "update";
                 //!
-                //! @static
                 //! @def copy
                 //! @brief 'register/body/variable/rights/rename' field from a register file.
                 //!
-                static const char *rename = "rename";
+                inline constexpr jbr::reg::node::Name rename = "rename";
                 //!
-                //! @static
                 //! @def move
                 //! @brief 'register/body/variable/rights/copy' field from a register file.
                 //!
-                static const char *copy = "copy";
+                inline constexpr jbr::reg::node::Name copy = "copy";
                 //!
-                //! @static
                 //! @def destroy
                 //! @brief 'register/body/variable/rights/remove' field from a register file.
                 //!
-                static const char *remove = "remove";
+                inline constexpr jbr::reg::node::Name remove = "remove";
             }
         }
     }
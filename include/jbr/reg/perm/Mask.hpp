@@ -0,0 +1,146 @@
+//!
+//! @file Mask.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_PERM_MASK_HPP
+# define JBR_CREGISTER_REGISTER_PERM_MASK_HPP
+
+# include <jbr/reg/perm/Rights.hpp>
+# include <cstdint>
+
+//!
+//! @namespace jbr::reg::perm
+//!
+namespace jbr::reg::perm
+{
+
+    //!
+    //! @class Mask
+    //! @brief All register rights packed into one byte, a bit per right.
+    //!
+    class Mask final
+    {
+    public:
+        //!
+        //! @enum Bit
+        //! @brief Register rights bits.
+        //!
+        enum Bit : std::uint8_t
+        {
+            Read = 1 << 0, //!< Reading rights.
+            Write = 1 << 1, //!< Writing rights.
+            Open = 1 << 2, //!< Allow to open a register.
+            Copy = 1 << 3, //!< Allow to copy a register.
+            Move = 1 << 4, //!< Allow to move a register.
+            Destroy = 1 << 5, //!< Allow to destroy a register.
+            All = Read | Write | Open | Copy | Move | Destroy //!< All rights.
+        };
+
+    private:
+        std::uint8_t    mBits; //!< Rights bits.
+
+    public:
+        //!
+        //! @brief Mask initializer. All rights are set by default.
+        //!
+        constexpr Mask() noexcept : mBits(All) {}
+        //!
+        //! @brief Mask initializer from rights bits.
+        //! @param bits Rights bits, the unknown ones are ignored.
+        //!
+        constexpr explicit Mask(std::uint8_t bits) noexcept : mBits(bits & All) {}
+        //!
+        //! @brief Mask initializer from the rights structure.
+        //! @param rights Register rights.
+        //!
+        constexpr explicit Mask(const jbr::reg::perm::Rights &rights) noexcept : mBits((rights.mRead ? Read : 0) | (rights.mWrite ? Write : 0) |
+                                                                                       (rights.mOpen ? Open : 0) | (rights.mCopy ? Copy : 0) |
+                                                                                       (rights.mMove ? Move : 0) | (rights.mDestroy ? Destroy : 0)) {}
+
+    public:
+        //!
+        //! @brief Extract the rights bits.
+        //! @return Rights bits.
+        //!
+        [[nodiscard]]
+        constexpr std::uint8_t              bits() const noexcept { return (mBits); }
+        //!
+        //! @brief Check if all the given rights are set.
+        //! @param bits Rights bits to check.
+        //! @return Set status.
+        //!
+        [[nodiscard]]
+        constexpr bool                      has(std::uint8_t bits) const noexcept { return ((mBits & bits) == bits); }
+        //!
+        //! @brief Set or clear rights.
+        //! @param bits Rights bits to change.
+        //! @param status Tell if the rights are set or cleared.
+        //!
+        constexpr void                      set(std::uint8_t bits, bool status) noexcept { mBits = static_cast<std::uint8_t>(status ? (mBits | (bits & All)) : (mBits & ~bits)); }
+        //!
+        //! @brief Convert to the rights structure.
+        //! @return Register rights.
+        //!
+        [[nodiscard]]
+        constexpr jbr::reg::perm::Rights    rights() const noexcept { return (jbr::reg::perm::Rights(has(Read), has(Write), has(Open), has(Copy), has(Move), has(Destroy))); }
+
+    public:
+        //!
+        //! @brief Check if a register is readable, read right set.
+        //! @return Readable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isReadable() const noexcept { return (has(Read)); }
+        //!
+        //! @brief Check if a register is openable, read and open rights set.
+        //! @return Openable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isOpenable() const noexcept { return (has(Read | Open)); }
+        //!
+        //! @brief Check if a register is writable, write right set.
+        //! @return Writable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isWritable() const noexcept { return (has(Write)); }
+        //!
+        //! @brief Check if a register is copyable, read and copy rights set.
+        //! @return Copyable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isCopyable() const noexcept { return (has(Read | Copy)); }
+        //!
+        //! @brief Check if a register is movable, read, write and move rights set.
+        //! @return Movable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isMovable() const noexcept { return (has(Read | Write | Move)); }
+        //!
+        //! @brief Check if a register is destroyable, read and destroy rights set.
+        //! @return Destroyable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isDestroyable() const noexcept { return (has(Read | Destroy)); }
+
+    public:
+        //!
+        //! @brief Equality overload operator.
+        //! @param mask Mask to check.
+        //! @return Status if rights are equals.
+        //!
+        constexpr bool  operator==(const Mask &mask) const noexcept { return (mBits == mask.mBits); }
+        //!
+        //! @brief Difference overload operator.
+        //! @param mask Mask to check.
+        //! @return Status if rights are different.
+        //!
+        constexpr bool  operator!=(const Mask &mask) const noexcept { return (mBits != mask.mBits); }
+    };
+
+    static_assert(sizeof(Mask) == 1, "Register rights mask must fit into one byte.");
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_PERM_MASK_HPP
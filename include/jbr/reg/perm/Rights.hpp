@@ -28,7 +28,7 @@ namespace jbr::reg::perm
         //!
         //! @brief Structure initializer. All rights are true by default.
         //!
-        Rights() : jbr::reg::Permission(), mOpen(true), mCopy(true), mMove(true), mDestroy(true) {}
+        constexpr Rights() : jbr::reg::Permission(), mOpen(true), mCopy(true), mMove(true), mDestroy(true) {}
         //!
         //! @brief Structure initializer with custom rights initialization.
         //! @param rd Reading rights.
@@ -38,7 +38,7 @@ namespace jbr::reg::perm
         //! @param mv Allow to move a register.
         //! @param ds Allow to destroy a register.
         //!
-        explicit Rights(bool rd, bool wr, bool op, bool cp, bool mv, bool ds) : jbr::reg::Permission(rd, wr), mOpen(op),
+        constexpr explicit Rights(bool rd, bool wr, bool op, bool cp, bool mv, bool ds) : jbr::reg::Permission(rd, wr), mOpen(op),
                                                                                 mCopy(cp), mMove(mv), mDestroy(ds) {}
     };
 }
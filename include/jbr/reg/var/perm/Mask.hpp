@@ -0,0 +1,146 @@
+//!
+//! @file jbr/reg/var/perm/Mask.hpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#ifndef JBR_CREGISTER_REGISTER_VAR_PERM_MASK_HPP
+# define JBR_CREGISTER_REGISTER_VAR_PERM_MASK_HPP
+
+# include <jbr/reg/var/perm/Rights.hpp>
+# include <cstdint>
+
+//!
+//! @namespace jbr::reg::var::perm
+//!
+namespace jbr::reg::var::perm
+{
+
+    //!
+    //! @class Mask
+    //! @brief All variables rights packed into one byte, a bit per right.
+    //!
+    class Mask final
+    {
+    public:
+        //!
+        //! @enum Bit
+        //! @brief Variables rights bits.
+        //!
+        enum Bit : std::uint8_t
+        {
+            Read = 1 << 0, //!< Reading rights.
+            Write = 1 << 1, //!< Writing rights.
+            Update = 1 << 2, //!< Allow to update a variable.
+            Rename = 1 << 3, //!< Allow to rename a variable.
+            Copy = 1 << 4, //!< Allow to copy a variable.
+            Remove = 1 << 5, //!< Allow to remove a variable.
+            All = Read | Write | Update | Rename | Copy | Remove //!< All rights.
+        };
+
+    private:
+        std::uint8_t    mBits; //!< Rights bits.
+
+    public:
+        //!
+        //! @brief Mask initializer. All rights are set by default.
+        //!
+        constexpr Mask() noexcept : mBits(All) {}
+        //!
+        //! @brief Mask initializer from rights bits.
+        //! @param bits Rights bits, the unknown ones are ignored.
+        //!
+        constexpr explicit Mask(std::uint8_t bits) noexcept : mBits(bits & All) {}
+        //!
+        //! @brief Mask initializer from the rights structure.
+        //! @param rights Variable rights.
+        //!
+        constexpr explicit Mask(const jbr::reg::var::perm::Rights &rights) noexcept : mBits((rights.mRead ? Read : 0) | (rights.mWrite ? Write : 0) |
+                                                                                            (rights.mUpdate ? Update : 0) | (rights.mRename ? Rename : 0) |
+                                                                                            (rights.mCopy ? Copy : 0) | (rights.mRemove ? Remove : 0)) {}
+
+    public:
+        //!
+        //! @brief Extract the rights bits.
+        //! @return Rights bits.
+        //!
+        [[nodiscard]]
+        constexpr std::uint8_t                  bits() const noexcept { return (mBits); }
+        //!
+        //! @brief Check if all the given rights are set.
+        //! @param bits Rights bits to check.
+        //! @return Set status.
+        //!
+        [[nodiscard]]
+        constexpr bool                          has(std::uint8_t bits) const noexcept { return ((mBits & bits) == bits); }
+        //!
+        //! @brief Set or clear rights.
+        //! @param bits Rights bits to change.
+        //! @param status Tell if the rights are set or cleared.
+        //!
+        constexpr void                          set(std::uint8_t bits, bool status) noexcept { mBits = static_cast<std::uint8_t>(status ? (mBits | (bits & All)) : (mBits & ~bits)); }
+        //!
+        //! @brief Convert to the rights structure.
+        //! @return Variable rights.
+        //!
+        [[nodiscard]]
+        constexpr jbr::reg::var::perm::Rights   rights() const noexcept { return (jbr::reg::var::perm::Rights(has(Read), has(Write), has(Update), has(Rename), has(Copy), has(Remove))); }
+
+    public:
+        //!
+        //! @brief Check if a variable is readable, read right set.
+        //! @return Readable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isReadable() const noexcept { return (has(Read)); }
+        //!
+        //! @brief Check if a variable is writable, write right set.
+        //! @return Writable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isWritable() const noexcept { return (has(Write)); }
+        //!
+        //! @brief Check if a variable is updatable, write and update rights set.
+        //! @return Updatable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isUpdatable() const noexcept { return (has(Write | Update)); }
+        //!
+        //! @brief Check if a variable is renamable, write, update and rename rights set.
+        //! @return Renamable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isRenamable() const noexcept { return (has(Write | Update | Rename)); }
+        //!
+        //! @brief Check if a variable is copyable, read and copy rights set.
+        //! @return Copyable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isCopyable() const noexcept { return (has(Read | Copy)); }
+        //!
+        //! @brief Check if a variable is removable, read and remove rights set.
+        //! @return Removable status.
+        //!
+        [[nodiscard]]
+        constexpr bool  isRemovable() const noexcept { return (has(Read | Remove)); }
+
+    public:
+        //!
+        //! @brief Equality overload operator.
+        //! @param mask Mask to check.
+        //! @return Status if rights are equals.
+        //!
+        constexpr bool  operator==(const Mask &mask) const noexcept { return (mBits == mask.mBits); }
+        //!
+        //! @brief Difference overload operator.
+        //! @param mask Mask to check.
+        //! @return Status if rights are different.
+        //!
+        constexpr bool  operator!=(const Mask &mask) const noexcept { return (mBits != mask.mBits); }
+    };
+
+    static_assert(sizeof(Mask) == 1, "Variables rights mask must fit into one byte.");
+
+}
+
+#endif //JBR_CREGISTER_REGISTER_VAR_PERM_MASK_HPP
@@ -29,7 +29,7 @@ namespace jbr::reg::var::perm
         //!
         //! @brief Structure initializer. All rights are true by default.
         //!
-        Rights() : jbr::reg::Permission(), mUpdate(true), mRename(true), mCopy(true), mRemove(true) {}
+        constexpr Rights() : jbr::reg::Permission(), mUpdate(true), mRename(true), mCopy(true), mRemove(true) {}
         //!
         //! @brief Structure initializer with custom rights initialization.
         //! @param rd Reading rights.
@@ -39,35 +39,31 @@ namespace jbr::reg::var::perm
         //! @param cp Allow to copy a variable.
         //! @param rm Allow to remove a variable.
         //!
-        explicit Rights(bool rd, bool wr, bool up, bool rn, bool cp, bool rm) : jbr::reg::Permission(rd, wr), mUpdate(up),
+        constexpr explicit Rights(bool rd, bool wr, bool up, bool rn, bool cp, bool rm) : jbr::reg::Permission(rd, wr), mUpdate(up),
                                                                                 mRename(rn), mCopy(cp), mRemove(rm) {}
         //!
+        //! @brief Copy constructor.
+        //! @param rights Rights to copy.
+        //!
+        constexpr Rights(const jbr::reg::var::perm::Rights &rights) noexcept = default;
+        //!
         //! @brief Equal operator overload.
         //! @param rights New rights to overload.
         //! @return New rights structure.
         //!
-        Rights  &operator=(const jbr::reg::var::perm::Rights &rights) noexcept
-        {
-            mRead = rights.mRead;
-            mWrite = rights.mWrite;
-            mUpdate = rights.mUpdate;
-            mRename = rights.mRename;
-            mCopy = rights.mCopy;
-            mRemove = rights.mRemove;
-            return (*this);
-        }
+        constexpr Rights    &operator=(const jbr::reg::var::perm::Rights &rights) noexcept = default;
 
         //!
         //! @brief Equality overload operator.
         //! @param rights Rights to check.
         //! @return Status if rights are equals.
         //!
-        inline bool operator==(const jbr::reg::var::perm::Rights &rights) noexcept { return (mRead == rights.mRead &&
-                                                                                            mWrite == rights.mWrite &&
-                                                                                            mUpdate == rights.mUpdate &&
-                                                                                            mRename == rights.mRename &&
-                                                                                            mCopy == rights.mCopy &&
-                                                                                            mRemove == rights.mRemove); }
+        inline bool operator==(const jbr::reg::var::perm::Rights &rights) const noexcept { return (mRead == rights.mRead &&
+                                                                                                  mWrite == rights.mWrite &&
+                                                                                                  mUpdate == rights.mUpdate &&
+                                                                                                  mRename == rights.mRename &&
+                                                                                                  mCopy == rights.mCopy &&
+                                                                                                  mRemove == rights.mRemove); }
     };
 
 }
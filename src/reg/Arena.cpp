@@ -0,0 +1,85 @@
+//!
+//! @file Arena.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Arena.hpp"
+#include "jbr/reg/Metrics.hpp"
+#include <memory>
+#include <vector>
+
+namespace jbr::reg
+{
+
+    std::atomic<std::size_t>    Arena::mBlockSize(Arena::mDefaultBlockSize);
+    std::atomic<std::size_t>    Arena::mMaxRetained(Arena::mDefaultMaxRetained);
+
+    //!
+    //! @brief Extract the documents kept by the calling thread.
+    //! @return Kept documents, the last one is leased first.
+    //!
+    static std::vector<std::unique_ptr<tinyxml2::XMLDocument>>  &documents() noexcept
+    {
+        thread_local std::vector<std::unique_ptr<tinyxml2::XMLDocument>>   kept;
+
+        return (kept);
+    }
+
+    Arena::Lease::Lease() noexcept(false) : Lease(std::nothrow)
+    {
+        if (mDocument == nullptr)
+            throw std::bad_alloc();
+    }
+
+    Arena::Lease::Lease(const std::nothrow_t &) noexcept : mDocument(nullptr)
+    {
+        std::vector<std::unique_ptr<tinyxml2::XMLDocument>> &kept = documents();
+
+        jbr::reg::Metrics::get().lookup(jbr::reg::metric::Cache::Arena, !kept.empty());
+        if (kept.empty())
+            mDocument = new (std::nothrow) tinyxml2::XMLDocument();
+        else
+        {
+            mDocument = kept.back().release();
+            kept.pop_back();
+        }
+        if (mDocument != nullptr)
+            mDocument->SetPoolBlockSize(Arena::blockSize());
+    }
+
+    Arena::Lease::~Lease()
+    {
+        std::vector<std::unique_ptr<tinyxml2::XMLDocument>> &kept = documents();
+
+        if (mDocument == nullptr)
+            return;
+        mDocument->Clear();
+        mDocument->SetBOM(false);
+        if (mDocument->PoolBytes() + mDocument->CharBufferBytes() > Arena::maxRetained())
+            mDocument->ReleaseMemory();
+        if (kept.size() >= Arena::mMaxDocuments)
+        {
+            delete mDocument;
+            return;
+        }
+        try {
+            kept.emplace_back(mDocument);
+        }
+        catch (const std::bad_alloc &) {
+            delete mDocument;
+        }
+    }
+
+    void    Arena::configure(std::size_t blockSize, std::size_t maxRetained) noexcept
+    {
+        mBlockSize.store(blockSize, std::memory_order_relaxed);
+        mMaxRetained.store(maxRetained, std::memory_order_relaxed);
+    }
+
+    void    Arena::release() noexcept
+    {
+        documents().clear();
+    }
+
+}
@@ -0,0 +1,205 @@
+//!
+//! @file BlobStore.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/BlobStore.hpp"
+#include "jbr/reg/exception.hpp"
+#include "jbr/reg/Metrics.hpp"
+#include <sstream>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <cstdint>
+#include <cstdio>
+#ifndef _WIN32
+# include <unistd.h>
+#else
+# include <process.h>
+# define getpid _getpid
+#endif
+
+namespace jbr::reg
+{
+
+    std::string BlobStore::identify(const char *data, std::size_t size) noexcept(false)
+    {
+        return (identify(digest(data, size), size));
+    }
+
+    std::string BlobStore::identify(std::uint64_t hash, std::size_t size) noexcept(false)
+    {
+        char    hex[17] = {};
+
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+        return (std::string(hex) + '-' + std::to_string(size));
+    }
+
+    std::uint64_t   BlobStore::digest(const char *data, std::size_t size, std::uint64_t hash) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+        return (hash);
+    }
+
+    std::filesystem::path   BlobStore::stage(const char *data, std::size_t size) const noexcept(false)
+    {
+        static std::atomic<std::size_t> counter(0);
+        std::error_code                 err;
+        std::filesystem::path           pending = mDirectory / (std::to_string(getpid()) + '.' + std::to_string(counter++) + ".pending");
+
+        std::filesystem::create_directories(mDirectory, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to create the blobs directory " + mDirectory.string() + " : " + err.message() + '.');
+
+        std::ofstream   ofs(pending, std::ios::binary | std::ios::trunc);
+
+        if (!ofs.write(data, static_cast<std::streamsize>(size)) || !ofs.flush())
+        {
+            ofs.close();
+            discard(pending);
+            throw jbr::reg::exception("Impossible to write the blob chunk " + pending.string() + '.');
+        }
+        jbr::reg::Metrics::get().written(size);
+        return (pending);
+    }
+
+    void    BlobStore::publish(const std::filesystem::path &pending, const std::string &chunk) const noexcept(false)
+    {
+        std::error_code         err;
+        std::filesystem::path   target = mDirectory / chunk;
+
+        if (std::filesystem::exists(target, err))
+        {
+            std::string stored = read(chunk);
+            std::string staged;
+
+            {
+                std::ifstream   ifs(pending, std::ios::binary);
+
+                staged.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            }
+            discard(pending);
+            if (stored != staged)
+                throw jbr::reg::exception("Blob chunk collision on " + target.string() + '.');
+            return ;
+        }
+        std::filesystem::rename(pending, target, err);
+        if (err)
+        {
+            discard(pending);
+            throw jbr::reg::exception("Impossible to publish the blob chunk " + target.string() + " : " + err.message() + '.');
+        }
+    }
+
+    void    BlobStore::discard(const std::filesystem::path &pending) const noexcept
+    {
+        std::error_code err;
+
+        std::filesystem::remove(pending, err);
+    }
+
+    std::string BlobStore::put(const char *data, std::size_t size) const noexcept(false)
+    {
+        std::string chunk = identify(data, size);
+
+        publish(stage(data, size), chunk);
+        return (chunk);
+    }
+
+    std::string BlobStore::read(const std::string &chunk) const noexcept(false)
+    {
+        std::filesystem::path   location = mDirectory / chunk;
+        std::ifstream           ifs(location, std::ios::binary);
+        std::string             content;
+
+        if (!ifs)
+            throw jbr::reg::exception("Register corrupted. The blob chunk " + location.string() + " does not exist.");
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        jbr::reg::Metrics::get().read(content.size());
+        return (content);
+    }
+
+    void    BlobStore::collect(const std::set<std::string> &referenced, std::chrono::seconds delay) const noexcept
+    {
+        using Clock = std::chrono::system_clock;
+
+        std::error_code                     err;
+        std::map<std::string, std::int64_t> unreferenced;
+        std::int64_t                        now = std::chrono::duration_cast<std::chrono::seconds>(Clock::now().time_since_epoch()).count();
+        std::filesystem::path               journal = mDirectory / mJournal;
+        std::string                         chunk;
+        std::int64_t                        since = 0;
+        std::ostringstream                  kept;
+
+        if (!std::filesystem::is_directory(mDirectory, err))
+            return ;
+        {
+            std::ifstream   ifs(journal);
+
+            while (ifs >> chunk >> since)
+                unreferenced.emplace(chunk, since);
+        }
+        for (std::filesystem::directory_iterator it(mDirectory, err), end; !err && it != end; it.increment(err))
+        {
+            std::string     name = it->path().filename().string();
+            std::error_code removeErr;
+
+            if (name.find('.') != std::string::npos || referenced.count(name) != 0)
+                continue;
+            since = unreferenced.count(name) != 0 ? unreferenced[name] : now;
+            if (now - since >= delay.count())
+                std::filesystem::remove(it->path(), removeErr);
+            else
+                kept << name << ' ' << since << '\n';
+        }
+        if (kept.tellp() <= 0)
+        {
+            std::filesystem::remove(journal, err);
+            return ;
+        }
+        try {
+            std::filesystem::path   pending = stage(kept.str().data(), kept.str().size());
+
+            std::filesystem::rename(pending, journal, err);
+            if (err)
+                discard(pending);
+        }
+        catch (...) {} // Chunks not journaled are found unreferenced again, and removed later.
+    }
+
+    void    BlobStore::copy(const BlobStore &target) const noexcept(false)
+    {
+        std::error_code err;
+
+        if (!std::filesystem::is_directory(mDirectory, err))
+            return ;
+        std::filesystem::create_directories(target.mDirectory, err);
+        for (std::filesystem::directory_iterator it(mDirectory, err), end; !err && it != end; it.increment(err))
+            if (it->path().filename().string().find('.') == std::string::npos)
+                std::filesystem::copy_file(it->path(), target.mDirectory / it->path().filename(),
+                                           std::filesystem::copy_options::skip_existing, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to copy the blobs directory " + mDirectory.string() + " : " + err.message() + '.');
+    }
+
+    void    BlobStore::move(const BlobStore &target) const noexcept(false)
+    {
+        std::error_code err;
+
+        if (!std::filesystem::is_directory(mDirectory, err))
+            return ;
+        std::filesystem::rename(mDirectory, target.mDirectory, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to move the blobs directory " + mDirectory.string() + " : " + err.message() + '.');
+    }
+
+    void    BlobStore::destroy() const noexcept
+    {
+        std::error_code err;
+
+        std::filesystem::remove_all(mDirectory, err);
+    }
+
+}
@@ -0,0 +1,103 @@
+//!
+//! @file Expirer.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Expirer.hpp"
+#include "jbr/reg/Instance.hpp"
+#include <map>
+#include <set>
+
+namespace jbr::reg
+{
+
+    Expirer &Expirer::get() noexcept
+    {
+        static Expirer  expirer;
+
+        return (expirer);
+    }
+
+    Expirer::Expirer() noexcept : mWheel(tick(std::chrono::system_clock::now())), mRunning(false) {}
+
+    Expirer::~Expirer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mRunning = false;
+        }
+        mCondition.notify_one();
+        if (mThread.joinable())
+            mThread.join();
+    }
+
+    void    Expirer::schedule(const std::string &path, const std::string &key, std::chrono::system_clock::time_point expiration) noexcept(false)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::uint64_t               deadline = tick(expiration) + 1;
+        auto                        pending = mPending.find(std::make_pair(path, key));
+
+        if (pending != mPending.end() && pending->second == deadline)
+            return ; // Read again while expired.
+        mWheel.schedule(deadline, std::make_pair(path, key));
+        mPending[std::make_pair(path, key)] = deadline;
+        if (!mThread.joinable())
+        {
+            mRunning = true;
+            mThread = std::thread(&Expirer::run, this);
+        }
+    }
+
+    std::size_t Expirer::scheduled() noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return (mWheel.size());
+    }
+
+    void    Expirer::run() noexcept
+    {
+        std::unique_lock<std::mutex>    lock(mMutex);
+
+        while (mRunning)
+        {
+            std::map<std::string, std::set<std::string>>    expired;
+
+            mCondition.wait_for(lock, mResolution);
+            try {
+                std::uint64_t   now = tick(std::chrono::system_clock::now());
+
+                for (auto &[path, key] : mWheel.advance(now))
+                {
+                    auto    pending = mPending.find(std::make_pair(path, key));
+
+                    if (pending != mPending.end() && pending->second <= now)
+                        mPending.erase(pending);
+                    expired[path].insert(std::move(key));
+                }
+            }
+            catch (...) {
+                continue;
+            }
+            lock.unlock();
+            for (const auto &[path, keys] : expired)
+            {
+                try {
+                    jbr::reg::Instance{std::string(path)}.purge(keys);
+                }
+                catch (...) {} // Register removed, moved or not writable anymore.
+            }
+            lock.lock();
+        }
+    }
+
+    std::uint64_t   Expirer::tick(std::chrono::system_clock::time_point date) noexcept
+    {
+        auto    ticks = std::chrono::duration_cast<std::chrono::milliseconds>(date.time_since_epoch()) / mResolution;
+
+        return (ticks < 0 ? 0 : static_cast<std::uint64_t>(ticks));
+    }
+
+}
@@ -0,0 +1,103 @@
+//!
+//! @file FileLock.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/FileLock.hpp"
+#include "jbr/reg/exception.hpp"
+#include "jbr/reg/Metrics.hpp"
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/file.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+namespace jbr::reg
+{
+
+#ifdef _WIN32
+
+    FileLock::FileLock(const std::string &path, bool shared) noexcept(false) : mHandle(nullptr)
+    {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Phase::Lock);
+        OVERLAPPED              overlapped = {};
+        HANDLE      handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                         nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            if (GetLastError() == ERROR_FILE_NOT_FOUND || GetLastError() == ERROR_PATH_NOT_FOUND)
+                return ;
+            throw jbr::reg::exception("Impossible to lock the register " + path + ", error code : " + std::to_string(GetLastError()) + '.');
+        }
+        if (!LockFileEx(handle, shared ? 0 : LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
+        {
+            CloseHandle(handle);
+            throw jbr::reg::exception("Impossible to lock the register " + path + ", error code : " + std::to_string(GetLastError()) + '.');
+        }
+        mHandle = handle;
+    }
+
+    FileLock::~FileLock()
+    {
+        OVERLAPPED  overlapped = {};
+
+        if (mHandle == nullptr)
+            return ;
+        UnlockFileEx(mHandle, 0, MAXDWORD, MAXDWORD, &overlapped);
+        CloseHandle(mHandle);
+    }
+
+#else
+
+    FileLock::FileLock(const std::string &path, bool shared) noexcept(false) : mDescriptor(-1)
+    {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Phase::Lock);
+
+        while (true)
+        {
+            struct stat locked = {};
+            struct stat current = {};
+            int         descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (descriptor < 0)
+            {
+                if (errno == ENOENT)
+                    return ;
+                throw jbr::reg::exception("Impossible to lock the register " + path + " : " + std::strerror(errno) + '.');
+            }
+            if (flock(descriptor, shared ? LOCK_SH : LOCK_EX) != 0)
+            {
+                int error = errno;
+
+                close(descriptor);
+                throw jbr::reg::exception("Impossible to lock the register " + path + " : " + std::strerror(error) + '.');
+            }
+            if (fstat(descriptor, &locked) != 0 || stat(path.c_str(), &current) != 0 ||
+                (locked.st_ino == current.st_ino && locked.st_dev == current.st_dev))
+            {
+                mDescriptor = descriptor;
+                return ;
+            }
+            close(descriptor); // The register has been replaced while waiting for the lock.
+        }
+    }
+
+    FileLock::~FileLock()
+    {
+        if (mDescriptor < 0)
+            return ;
+        flock(mDescriptor, LOCK_UN);
+        close(mDescriptor);
+    }
+
+#endif
+
+}
@@ -5,22 +5,131 @@
 //!
 
 #include "jbr/reg/Manager.hpp"
+#include "jbr/reg/Arena.hpp"
+#include "jbr/reg/KeyFilter.hpp"
+#include "jbr/reg/Expirer.hpp"
+#include "jbr/reg/FileLock.hpp"
+#include "jbr/reg/Stamp.hpp"
+#include "jbr/reg/Metrics.hpp"
+#include "jbr/reg/Serializer.hpp"
+#include "jbr/reg/ThreadPool.hpp"
 #include "jbr/reg/node/Name.hpp"
+#include <condition_variable>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+#ifdef __linux__
+# include <sys/ioctl.h>
+# include <sys/stat.h>
+# include <linux/fs.h>
+# include <fcntl.h>
+#endif
 
 namespace jbr::reg
 {
 
-    Instance::Instance(const char *path)
+    namespace
+    {
+
+        //!
+        //! @brief Copy a file through the kernel : extents shared with the source (reflink) when the file system allows it, else
+        //! copied in kernel (copy_file_range) without user space buffer, else a regular copy.
+        //! @param from Source file.
+        //! @param to Target file, must not exist.
+        //! @param err Copy error.
+        //! @return Bytes written through the regular copy, 0 if copied by the kernel.
+        //!
+        std::uintmax_t  copyFile(const std::string &from, const char *to, std::error_code &err) noexcept
+        {
+#ifdef __linux__
+            int             in = ::open(from.c_str(), O_RDONLY | O_CLOEXEC);
+            int             out = -1;
+            struct stat     st{};
+            off_t           copied = 0;
+            bool            done = false;
+            bool            fallback = false;
+            std::error_code removeErr;
+
+            err.clear();
+            if (in < 0 || ::fstat(in, &st) != 0 || (out = ::open(to, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, st.st_mode & 07777)) < 0)
+            {
+                err = std::error_code(errno, std::generic_category());
+                if (in >= 0)
+                    ::close(in);
+                return (0);
+            }
+            (void)::fchmod(out, st.st_mode & 07777);
+# ifdef FICLONE
+            done = ::ioctl(out, FICLONE, in) == 0;
+            copied = done ? st.st_size : 0;
+# endif
+            while (!done)
+            {
+                ssize_t chunk = ::copy_file_range(in, nullptr, out, nullptr, 1 << 30, 0);
+
+                if (chunk < 0 && copied == 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP || errno == EPERM))
+                    fallback = true; // Not supported between these files.
+                else if (chunk < 0)
+                    err = std::error_code(errno, std::generic_category());
+                done = chunk <= 0;
+                copied += chunk > 0 ? chunk : 0;
+            }
+            fallback = fallback || (!err && copied != st.st_size); // Some file systems report a early end of file.
+            ::close(in);
+            if (::close(out) != 0 && !err)
+                err = std::error_code(errno, std::generic_category());
+            if (!fallback && !err)
+                return (0);
+            std::filesystem::remove(to, removeErr);
+            if (!fallback)
+                return (0);
+            err.clear();
+#endif
+            if (!std::filesystem::copy_file(from, to, err))
+                return (0);
+
+            std::error_code sizeErr;
+            std::uintmax_t  written = std::filesystem::file_size(to, sizeErr);
+
+            return (sizeErr ? 0 : written);
+        }
+
+    }
+
+    Instance::Instance(const char *path) : mAsync(false), mBlobThreshold(mDefaultBlobThreshold), mBlobCollectDelay(mDefaultBlobCollectDelay)
     {
         if (path == nullptr)
             throw jbr::reg::exception("The register path is null. It must not be null or empty.");
         mPath = path;
+        mAffinity = std::hash<std::string>{}(mPath);
+        checkPathValidity();
+    }
+
+    Instance::Instance(std::string &&path, std::size_t blobThreshold, std::chrono::seconds blobCollectDelay) noexcept(false)
+        : mPath(std::move(path)), mAsync(false), mBlobThreshold(blobThreshold), mBlobCollectDelay(blobCollectDelay),
+          mAffinity(std::hash<std::string>{}(mPath))
+    {
         checkPathValidity();
     }
 
+    Instance::~Instance()
+    {
+        if (mAsync && !jbr::reg::ThreadPool::io().runsOn(mAffinity))
+            asyncFlush().wait();
+        for (jbr::reg::WatchId id : mWatches)
+            jbr::reg::Watcher::get().unsubscribe(id);
+    }
+
     void    Instance::verify() const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
 
         loadXMLFile(reg);
         verify(reg);
@@ -39,29 +148,44 @@ namespace jbr::reg
 
     void    Instance::copy(const char *pathTo) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Copy);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         std::error_code         err;
 
         if (pathTo == nullptr || !pathTo[0])
             throw jbr::reg::exception("To copy a register the new register path must not be empty.");
         if (jbr::reg::Manager::exist(pathTo))
             throw jbr::reg::exception("Impossible to copy the register " + mPath + ". Target path already have a register existing : " + pathTo + ".");
-        loadXMLFile(reg);
+        if (std::filesystem::file_size(mPath, err) < mHeaderCopyThreshold || err || !loadXMLHeader(reg))
+            loadXMLFile(reg);
         verify(reg);
         if (!isCopyable(reg))
             throw jbr::reg::exception("Impossible to copy the register '" + mPath + "' without copy and read right.");
-        std::filesystem::copy_file(mPath, pathTo, err);
+
+        std::uintmax_t  size = std::filesystem::file_size(mPath, err);
+        std::uintmax_t  written = copyFile(mPath, pathTo, err);
+
         if (err)
             throw jbr::reg::exception(err.message());
+        jbr::reg::Metrics::get().read(size == static_cast<std::uintmax_t>(-1) ? 0 : size);
+        jbr::reg::Metrics::get().written(written);
+        jbr::reg::BlobStore(mPath).copy(jbr::reg::BlobStore(pathTo));
+        jbr::reg::ValueIndex(mPath).copy(jbr::reg::ValueIndex(pathTo));
+        jbr::reg::KeyFilter::copy(mPath, pathTo);
     }
 
     void    Instance::move(const char *pathTo) noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Move);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         std::error_code         err;
 
         if (pathTo == nullptr || !pathTo[0])
             throw jbr::reg::exception("To move a register the new register path must not be empty.");
+        if (mAsync && !jbr::reg::ThreadPool::io().runsOn(mAffinity))
+            asyncFlush().wait(); // The operations launched before are run on the previous location.
         if (jbr::reg::Manager::exist(pathTo))
             throw jbr::reg::exception("Impossible to move the register " + mPath + ". Target path already have a register existing : " + pathTo + ".");
         loadXMLFile(reg);
@@ -71,12 +195,24 @@ namespace jbr::reg
         std::filesystem::rename(mPath, pathTo, err);
         if (err)
             throw jbr::reg::exception(err.message());
+        try {
+            jbr::reg::BlobStore(mPath).move(jbr::reg::BlobStore(pathTo));
+            jbr::reg::ValueIndex(mPath).move(jbr::reg::ValueIndex(pathTo));
+            jbr::reg::KeyFilter::move(mPath, pathTo);
+        }
+        catch (...) {
+            std::filesystem::rename(pathTo, mPath, err);
+            throw;
+        }
         mPath = pathTo;
+        for (jbr::reg::WatchId id : mWatches)
+            jbr::reg::Watcher::get().relocate(id, mPath);
     }
 
     jbr::reg::perm::Rights  Instance::rights() const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
 
         loadXMLFile(reg);
         return (rights(reg));
@@ -86,24 +222,19 @@ namespace jbr::reg
     {
         verify(xmlDocument);
 
-        tinyxml2::XMLNode   *nodeRights = getSubXMLElement(getSubXMLElement(&xmlDocument, jbr::reg::node::name::reg),
-                                                           jbr::reg::node::name::header)->FirstChildElement("rights");
-        jbr::reg::perm::Rights  rights;
+        const tinyxml2::XMLElement  *nodeRights = findSubXMLElement(getSubXMLElement(getSubXMLElement(&xmlDocument, jbr::reg::node::name::reg),
+                                                                                     jbr::reg::node::name::header), jbr::reg::node::name::_header::rights);
+        std::uint8_t                bits = jbr::reg::perm::Mask::All;
 
-        if (nodeRights == nullptr)
-            return (rights);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::read), &rights.mRead);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::write), &rights.mWrite);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::open), &rights.mOpen);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::copy), &rights.mCopy);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::move), &rights.mMove);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_header::_rights::destroy), &rights.mDestroy);
-        return (rights);
+        queryRightsToXMLElement(nodeRights, mRightsFields, bits);
+        return (jbr::reg::perm::Mask(bits).rights());
     }
 
     void    Instance::applyRights(const jbr::reg::perm::Rights &rights) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::FileLock      lock(mPath);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
 
         loadXMLFile(reg);
         verify(reg);
@@ -119,106 +250,746 @@ namespace jbr::reg
 
     void    Instance::set(const jbr::reg::Variable &variable, bool replaceIfExist) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Set);
+        jbr::reg::FileLock      lock(mPath);
+        std::string             stamp = jbr::reg::stamp(mPath);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
-        tinyxml2::XMLElement    *variableNode = newXMLElement(&reg, jbr::reg::node::name::_body::variable);
-        tinyxml2::XMLElement    *keyNode = newXMLElement(&reg, jbr::reg::node::name::_body::_variable::key);
-        tinyxml2::XMLElement    *valueNode = newXMLElement(&reg, jbr::reg::node::name::_body::_variable::value);
 
-        if (overrideVariable(reg, variable, body, replaceIfExist))
+        jbr::reg::ValueIndex::Changes   changes;
+        std::string                     saved;
+
+        if (overrideVariable(reg, variable, body, replaceIfExist, saved))
+        {
+            updateKeyFilter(stamp, saved, variable.key());
             return ;
+        }
+
+        tinyxml2::XMLElement    *variableElement = insertVariable(reg, body, variable);
+
+        if (jbr::reg::ValueIndex(mPath).enabled())
+            changes.push_back(indexChange(variableElement, std::string()));
+        saved = saveXMLFile(reg, changes);
+        updateKeyFilter(stamp, saved, variable.key());
+        if (variable.expiration() != std::nullopt)
+            jbr::reg::Expirer::get().schedule(mPath, variable.key(), variable.expiration().value());
+    }
+
+    tinyxml2::XMLElement    *Instance::insertVariable(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *body, const jbr::reg::Variable &variable) const noexcept(false)
+    {
+        tinyxml2::XMLElement    *variableNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::variable);
+        tinyxml2::XMLElement    *keyNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::_variable::key);
+        tinyxml2::XMLElement    *valueNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::_variable::value);
+
         body->InsertFirstChild(variableNode);
         keyNode->SetText(variable.key());
-        valueNode->SetText(variable.read());
         variableNode->InsertFirstChild(keyNode);
         variableNode->InsertAfterChild(keyNode, valueNode);
-        writeRights(&reg, variableNode, valueNode, variable.rights());
-        saveXMLFile(reg);
+        writeRights(&xmlDocument, variableNode, valueNode, variable.rights());
+        writeExpiration(&xmlDocument, variableNode, variable.expiration());
+        writeValue(xmlDocument, variableNode, variable.read());
+        return (variableNode);
     }
 
-    bool    Instance::overrideVariable(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::Variable &variable,
-                                        tinyxml2::XMLElement *body, bool replaceIfExist) const noexcept(false)
+    std::int64_t    Instance::increment(const char *key, std::int64_t delta) const noexcept(false)
+    {
+        return (fetchAdd(key, delta) + delta);
+    }
+
+    std::int64_t    Instance::fetchAdd(const char *key, std::int64_t delta) const noexcept(false)
+    {
+        std::int64_t    previous = 0;
+
+        modify(key, [this, key, delta, &previous](const char *value) {
+            previous = value == nullptr ? 0 : toInteger(key, value);
+            if ((delta > 0 && previous > std::numeric_limits<std::int64_t>::max() - delta) ||
+                (delta < 0 && previous < std::numeric_limits<std::int64_t>::min() - delta))
+                throw jbr::reg::exception("Impossible to increment the variable '" + std::string(key) + "' from " + mPath + " register, integer overflow.");
+            return (std::optional<std::string>(std::to_string(previous + delta)));
+        });
+        return (previous);
+    }
+
+    bool    Instance::compareAndSet(const char *key, const char *expected, const char *desired) const noexcept(false)
+    {
+        bool    swapped = false;
+
+        if (expected == nullptr || desired == nullptr)
+            throw jbr::reg::exception("Impossible to compare and set a variable with a null expected or desired value.");
+        modify(key, [expected, desired, &swapped](const char *value) {
+            swapped = value != nullptr && std::strcmp(value, expected) == 0;
+            return (swapped ? std::optional<std::string>(desired) : std::nullopt);
+        });
+        return (swapped);
+    }
+
+    void    Instance::update(const char *key, const std::function<bool(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement,
+                                                                        bool existing)> &updater) const noexcept(false)
+    {
+        jbr::reg::metric::Timer         timer(jbr::reg::metric::Operation::Update);
+        jbr::reg::FileLock              lock(mPath);
+        jbr::reg::Arena::Lease          lease;
+        tinyxml2::XMLDocument           &reg = *lease;
+        tinyxml2::XMLElement            *body = getBodyXMLElement(reg);
+        bool                            indexed = jbr::reg::ValueIndex(mPath).enabled();
+        jbr::reg::ValueIndex::Changes   changes;
+        std::string                     from;
+
+        if (key == nullptr || std::strlen(key) == 0)
+            throw jbr::reg::exception("Impossible to update a null or empty variable.");
+
+        tinyxml2::XMLElement    *variableElement = findVariableElement(body, key);
+
+        if (variableElement != nullptr)
+        {
+            if (indexed)
+                from = indexBucket(variableElement);
+            if (isExpired(variableElement))
+            {
+                body->DeleteChild(variableElement);
+                variableElement = nullptr;
+            }
+        }
+        if (variableElement != nullptr)
+        {
+            jbr::reg::var::perm::Mask   rights = getVariableMaskFromNode(findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights));
+
+            if (!rights.has(jbr::reg::var::perm::Mask::Read | jbr::reg::var::perm::Mask::Write | jbr::reg::var::perm::Mask::Update))
+                throw jbr::reg::exception("Impossible to update a variable without read, write and update rights.");
+            if (!updater(reg, variableElement, true))
+                return ;
+        }
+        else
+        {
+            variableElement = insertVariable(reg, body, jbr::reg::Variable(key, ""));
+            if (!updater(reg, variableElement, false))
+                return ;
+        }
+        if (indexed)
+            changes.push_back(indexChange(variableElement, std::move(from)));
+        saveXMLFile(reg, changes);
+        collectBlobs(reg);
+    }
+
+    void    Instance::modify(const char *key, const std::function<std::optional<std::string>(const char *value)> &modifier) const noexcept(false)
+    {
+        update(key, [this, &modifier](tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement, bool existing) {
+            std::optional<std::string>  value = modifier(existing ? readValue(variableElement).c_str() : nullptr);
+
+            if (value == std::nullopt)
+                return (false);
+            writeValue(xmlDocument, variableElement, value->c_str());
+            return (true);
+        });
+    }
+
+    void    Instance::writeBlob(const char *key, const jbr::reg::ValueWriter::Staged &staged, std::size_t size) const noexcept(false)
     {
+        update(key, [this, &staged, size](tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement, bool) {
+            jbr::reg::BlobStore         store(mPath);
+            std::vector<std::string>    chunks;
+
+            for (const auto &[chunk, pending] : staged)
+            {
+                store.publish(pending, chunk);
+                chunks.push_back(chunk);
+            }
+            getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value)->SetText("");
+            writeBlobNode(xmlDocument, variableElement, chunks, size);
+            return (true);
+        });
+    }
+
+    std::string Instance::readValue(const tinyxml2::XMLElement *variableElement) const noexcept(false)
+    {
+        const tinyxml2::XMLElement  *valueNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value);
+        const tinyxml2::XMLElement  *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+        std::size_t                 size = 0;
+        std::string                 value;
+
+        if (valueNode == nullptr)
+            throw jbr::reg::exception("Error while extract the sub node, the result is null. The sub node " +
+                                      std::string(jbr::reg::node::name::_body::_variable::value) + " does not exist.");
+        if (blobNode == nullptr)
+            return (valueNode->GetText() == nullptr ? "" : valueNode->GetText());
+
+        jbr::reg::BlobStore         store(mPath);
+        std::vector<std::string>    chunks = getBlobChunksFromNode(blobNode, size);
+
+        value.reserve(size);
+        for (const std::string &chunk : chunks)
+            value += store.read(chunk);
+        if (value.size() != size)
+            throw jbr::reg::exception("Register corrupted. Chunks from register/body/variable/blob nodes does not match the value size.");
+        return (value);
+    }
+
+    void    Instance::writeValue(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement, const char *value) const noexcept(false)
+    {
+        tinyxml2::XMLElement    *valueNode = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value);
+        tinyxml2::XMLElement    *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+        std::size_t             size = std::strlen(value);
+
+        if (size <= mBlobThreshold)
+        {
+            valueNode->SetText(value);
+            if (blobNode != nullptr)
+                variableElement->DeleteChild(blobNode);
+            return ;
+        }
+
+        jbr::reg::BlobStore         store(mPath);
+        std::vector<std::string>    chunks;
+
+        for (std::size_t offset = 0; offset < size; offset += jbr::reg::BlobStore::mChunkSize)
+            chunks.push_back(store.put(value + offset, std::min(jbr::reg::BlobStore::mChunkSize, size - offset)));
+        valueNode->SetText("");
+        writeBlobNode(xmlDocument, variableElement, chunks, size);
+    }
+
+    void    Instance::writeBlobNode(tinyxml2::XMLDocument &xmlDocument, tinyxml2::XMLElement *variableElement,
+                                    const std::vector<std::string> &chunks, std::size_t size) const noexcept(false)
+    {
+        tinyxml2::XMLElement    *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+        tinyxml2::XMLElement    *sizeNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::_variable::_blob::size);
+
+        if (blobNode != nullptr)
+            variableElement->DeleteChild(blobNode);
+        blobNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::_variable::blob);
+        variableElement->InsertAfterChild(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value), blobNode);
+        sizeNode->SetText(static_cast<int64_t>(size));
+        blobNode->InsertEndChild(sizeNode);
+        for (const std::string &chunk : chunks)
+        {
+            tinyxml2::XMLElement    *chunkNode = newXMLElement(&xmlDocument, jbr::reg::node::name::_body::_variable::_blob::chunk);
+
+            chunkNode->SetText(chunk.c_str());
+            blobNode->InsertEndChild(chunkNode);
+        }
+    }
+
+    std::vector<std::string>    Instance::getBlobChunksFromNode(const tinyxml2::XMLElement *blobNode, std::size_t &size) const noexcept(false)
+    {
+        const tinyxml2::XMLElement  *sizeNode = findSubXMLElement(blobNode, jbr::reg::node::name::_body::_variable::_blob::size);
+        int64_t                     bytes = 0;
+        std::vector<std::string>    chunks;
+
+        if (sizeNode == nullptr || sizeNode->QueryInt64Text(&bytes) != tinyxml2::XMLError::XML_SUCCESS || bytes < 0)
+            throw jbr::reg::exception("Register corrupted. Field size from register/body/variable/blob nodes not set or invalid.");
+        for (const tinyxml2::XMLElement *chunkNode = findSubXMLElement(blobNode, jbr::reg::node::name::_body::_variable::_blob::chunk);
+             chunkNode != nullptr; chunkNode = chunkNode->NextSiblingElement(jbr::reg::node::name::_body::_variable::_blob::chunk.data(), jbr::reg::node::name::_body::_variable::_blob::chunk.size()))
+        {
+            if (chunkNode->GetText() == nullptr)
+                throw jbr::reg::exception("Register corrupted. Field chunk from register/body/variable/blob nodes not set.");
+            chunks.emplace_back(chunkNode->GetText());
+        }
+        size = static_cast<std::size_t>(bytes);
+        return (chunks);
+    }
+
+    void    Instance::collectBlobs(tinyxml2::XMLDocument &xmlDocument) const noexcept(false)
+    {
+        jbr::reg::BlobStore     store(mPath);
+        std::error_code         err;
+        std::set<std::string>   referenced;
+
+        if (!std::filesystem::is_directory(store.directory(), err))
+            return ;
+        for (const tinyxml2::XMLElement *variableElement = getSubXMLElement(getSubXMLElement(&xmlDocument, jbr::reg::node::name::reg), jbr::reg::node::name::body)->FirstChildElement();
+             variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            const tinyxml2::XMLElement  *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+
+            for (const tinyxml2::XMLElement *chunkNode = blobNode == nullptr ? nullptr : findSubXMLElement(blobNode, jbr::reg::node::name::_body::_variable::_blob::chunk);
+                 chunkNode != nullptr; chunkNode = chunkNode->NextSiblingElement(jbr::reg::node::name::_body::_variable::_blob::chunk.data(), jbr::reg::node::name::_body::_variable::_blob::chunk.size()))
+                if (chunkNode->GetText() != nullptr)
+                    referenced.insert(chunkNode->GetText());
+        }
+        store.collect(referenced, mBlobCollectDelay);
+    }
+
+    jbr::reg::ValueReader   Instance::openValueStream(const char *key) const noexcept(false)
+    {
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
+        tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
+
+        if (key == nullptr || std::strlen(key) == 0)
+            throw jbr::reg::exception("Impossible to extract a null or empty variable.");
         for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
-            if (std::strcmp(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText(), variable.key()) == 0)
+            if (std::strcmp(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText(), key) == 0)
             {
-                if (!replaceIfExist)
-                    throw jbr::reg::exception("Cannot replace the already existing variable '" + std::string(variable.read()) + "' from " + mPath + " register.");
+                if (isExpired(variableElement))
+                    break;
+                if (!getVariableMaskFromNode(findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)).isReadable())
+                    throw jbr::reg::exception("Impossible to read a register variable, right must be set to true.");
 
-                tinyxml2::XMLElement    *valueNode = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value);
+                const tinyxml2::XMLElement  *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+                std::size_t                 size = 0;
 
-                valueNode->SetText(variable.read());
-                updateRights(&xmlDocument, variableElement, valueNode, variable.rights());
-                saveXMLFile(xmlDocument);
-                return (true);
+                if (blobNode == nullptr)
+                {
+                    std::string value = readValue(variableElement);
+
+                    size = value.size();
+                    return (jbr::reg::ValueReader(jbr::reg::BlobStore(mPath), {}, std::move(value), size));
+                }
+
+                std::vector<std::string>    chunks = getBlobChunksFromNode(blobNode, size);
+
+                return (jbr::reg::ValueReader(jbr::reg::BlobStore(mPath), std::move(chunks), std::string(), size));
             }
-        return (false);
+        throw jbr::reg::exception("No variable named '" + std::string(key) + "' were found into the register '" + mPath + "'.");
+    }
+
+    jbr::reg::ValueWriter   Instance::writeValueStream(const char *key) const noexcept(false)
+    {
+        if (key == nullptr || std::strlen(key) == 0)
+            throw jbr::reg::exception("Impossible to update a null or empty variable.");
+        return (jbr::reg::ValueWriter(*this, std::string(key)));
     }
 
-    jbr::reg::var::perm::Rights Instance::getVariableRightsFromNode(tinyxml2::XMLNode *nodeRights) const noexcept(false)
+    std::int64_t    Instance::toInteger(const char *key, const char *value) const noexcept(false)
     {
-        jbr::reg::var::perm::Rights rights;
+        std::int64_t    integer = 0;
+        const char      *end = value + std::strlen(value);
 
-        if (nodeRights == nullptr)
-            return (rights);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::read), &rights.mRead);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::write), &rights.mWrite);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::update), &rights.mUpdate);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::rename), &rights.mRename);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::copy), &rights.mCopy);
-        queryRightToXMLElement(nodeRights->FirstChildElement(jbr::reg::node::name::_body::_variable::_rights::remove), &rights.mRemove);
-        return (rights);
+        if (value == end)
+            return (0);
+
+        std::from_chars_result  result = std::from_chars(value, end, integer);
+
+        if (result.ec != std::errc() || result.ptr != end)
+            throw jbr::reg::exception("Impossible to increment the variable '" + std::string(key) + "' from " + mPath + " register, value '" +
+                                      value + "' is not a integer.");
+        return (integer);
+    }
+
+    bool    Instance::overrideVariable(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::Variable &variable,
+                                        tinyxml2::XMLElement *body, bool replaceIfExist, std::string &saved) const noexcept(false)
+    {
+        tinyxml2::XMLElement    *variableElement = findVariableElement(body, variable.key());
+
+        if (variableElement == nullptr)
+            return (false);
+
+        bool                            expired = isExpired(variableElement);
+
+        if (!expired && !replaceIfExist)
+            throw jbr::reg::exception("Cannot replace the already existing variable '" + std::string(variable.read()) + "' from " + mPath + " register.");
+
+        bool                            indexed = jbr::reg::ValueIndex(mPath).enabled();
+        std::string                     from = indexed ? indexBucket(variableElement) : std::string();
+        jbr::reg::ValueIndex::Changes   changes;
+
+        if (expired) // Not purged yet, the variable is absent : inserted again, the rights of the expired one don't apply.
+        {
+            body->DeleteChild(variableElement);
+            variableElement = insertVariable(xmlDocument, body, variable);
+        }
+        else
+        {
+            tinyxml2::XMLElement    *valueNode = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value);
+
+            updateRights(&xmlDocument, variableElement, valueNode, variable.rights());
+            writeExpiration(&xmlDocument, variableElement, variable.expiration());
+            writeValue(xmlDocument, variableElement, variable.read());
+        }
+        if (indexed)
+            changes.push_back(indexChange(variableElement, std::move(from)));
+        saved = saveXMLFile(xmlDocument, changes);
+        collectBlobs(xmlDocument);
+        if (variable.expiration() != std::nullopt)
+            jbr::reg::Expirer::get().schedule(mPath, variable.key(), variable.expiration().value());
+        return (true);
+    }
+
+    tinyxml2::XMLElement    *Instance::findVariableElement(tinyxml2::XMLElement *body, const char *key) const noexcept(false)
+    {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Phase::Search);
+
+        for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            const char  *keyText = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+
+            if (keyText != nullptr && std::strcmp(keyText, key) == 0)
+                return (variableElement);
+        }
+        return (nullptr);
+    }
+
+    jbr::reg::var::perm::Rights Instance::getVariableRightsFromNode(const tinyxml2::XMLElement *nodeRights) const noexcept(false)
+    {
+        return (getVariableMaskFromNode(nodeRights).rights());
+    }
+
+    jbr::reg::var::perm::Mask   Instance::getVariableMaskFromNode(const tinyxml2::XMLElement *nodeRights) const noexcept(false)
+    {
+        std::uint8_t    bits = jbr::reg::var::perm::Mask::All;
+
+        queryRightsToXMLElement(nodeRights, mVariableRightsFields, bits);
+        return (jbr::reg::var::perm::Mask(bits));
     }
 
     bool    Instance::available(const char *key) const  noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer                     timer(jbr::reg::metric::Operation::Available);
+        std::string                                 stamp = jbr::reg::stamp(mPath);
+        std::shared_ptr<const jbr::reg::KeyFilter>  filter = jbr::reg::KeyFilter::cached(mPath, stamp);
+
+        jbr::reg::Metrics::get().lookup(jbr::reg::metric::Cache::KeyFilter, filter != nullptr);
+        if (filter != nullptr && key != nullptr && key[0] != '\0' && !filter->mayContain(key))
+            return (false); // The filter is only built from a readable register, for this stamp.
+
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
 
+        if (filter == nullptr)
+            buildKeyFilter(body, std::move(stamp));
         if (key == nullptr || std::strlen(key) == 0)
             return (false);
+
+        tinyxml2::XMLElement    *variableElement = findVariableElement(body, key);
+
+        return (variableElement != nullptr && !isExpired(variableElement));
+    }
+
+    std::size_t Instance::forEach(const jbr::reg::Visitor &visitor) const noexcept(false)
+    {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::ForEach);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
+        tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
+        std::size_t             visited = 0;
+        std::string             blob;
+
         for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
-            if (std::strcmp(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText(), key) == 0)
-                return (true);
-        return (false);
+        {
+            const char              *key = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+            jbr::reg::VariableView  view{ key == nullptr ? "" : key, {},
+                                          getVariableRightsFromNode(findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)),
+                                          getVariableExpirationFromNode(variableElement) };
+
+            if (view.mExpiration != std::nullopt && isExpired(variableElement))
+                continue;
+            if (view.mRights.mRead)
+            {
+                const char  *value = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value)->GetText();
+
+                if (findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob) != nullptr)
+                {
+                    blob = readValue(variableElement);
+                    view.mValue = blob;
+                }
+                else if (value != nullptr)
+                    view.mValue = value;
+            }
+            ++visited;
+            if (!visitor(view))
+                break;
+        }
+        return (visited);
     }
 
     jbr::reg::Variable  Instance::get(const char *key) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Get);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
 
         if (key == nullptr || std::strlen(key) == 0)
             throw jbr::reg::exception("Impossible to extract a null or empty variable.");
-        for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
-            if (std::strcmp(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText(), key) == 0)
+
+        tinyxml2::XMLElement    *variableElement = findVariableElement(body, key);
+
+        if (variableElement == nullptr || isExpired(variableElement))
+            throw jbr::reg::exception("No variable named '" + std::string(key) + "' were found into the register '" + mPath + "'.");
+        return (jbr::reg::Variable(key,
+                                   readValue(variableElement),
+                                   jbr::reg::var::perm::Rights(getVariableRightsFromNode(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights))),
+                                   getVariableExpirationFromNode(variableElement)));
+    }
+
+    jbr::reg::Error Instance::tryGet(const char *key, std::optional<jbr::reg::Variable> &variable) const noexcept
+    {
+        jbr::reg::metric::Timer                                 timer(jbr::reg::metric::Operation::Get);
+        jbr::reg::Arena::Lease                                  lease(std::nothrow);
+        tinyxml2::XMLElement                                    *variableElement = nullptr;
+        jbr::reg::var::perm::Rights                             rights;
+        std::optional<std::chrono::system_clock::time_point>    expiration;
+        jbr::reg::Error                                         err = lease ? lookupVariable(*lease, key, &variableElement) : jbr::reg::Error::Allocation;
+
+        variable.reset();
+        if (err != jbr::reg::Error::None)
+        {
+            timer.fail();
+            return (err);
+        }
+
+        const tinyxml2::XMLElement  *valueNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value);
+
+        if (valueNode == nullptr)
+            err = jbr::reg::Error::Corrupted;
+        if (err == jbr::reg::Error::None)
+            err = queryVariableRights(findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights), rights);
+        if (err == jbr::reg::Error::None)
+            err = queryVariableExpiration(variableElement, expiration);
+        if (err == jbr::reg::Error::None)
+        {
+            try {
+                variable.emplace(key, readValue(variableElement), rights, expiration);
+            }
+            catch (const jbr::reg::exception &) {
+                err = jbr::reg::Error::Corrupted;
+            }
+            catch (...) {
+                err = jbr::reg::Error::Allocation;
+            }
+        }
+        if (err != jbr::reg::Error::None)
+            timer.fail();
+        return (err);
+    }
+
+    std::optional<jbr::reg::Variable>   Instance::find(const char *key) const noexcept
+    {
+        std::optional<jbr::reg::Variable>   variable;
+
+        (void)tryGet(key, variable);
+        return (variable);
+    }
+
+    jbr::reg::Error Instance::lookupVariable(tinyxml2::XMLDocument &xmlDocument, const char *key,
+                                             tinyxml2::XMLElement **variableElement) const noexcept
+    {
+        std::error_code err;
+        bool            readable = true;
+
+        if (key == nullptr || !key[0])
+            return (jbr::reg::Error::InvalidKey);
+        if (!std::filesystem::exists(mPath, err))
+            return (jbr::reg::Error::NotExisting);
+        if (readXMLFile(xmlDocument) != tinyxml2::XMLError::XML_SUCCESS)
+            return (jbr::reg::Error::Parsing);
+
+        tinyxml2::XMLElement        *nodeReg = findSubXMLElement(&xmlDocument, jbr::reg::node::name::reg);
+        tinyxml2::XMLElement        *nodeHeader = nodeReg == nullptr ? nullptr : findSubXMLElement(nodeReg, jbr::reg::node::name::header);
+        tinyxml2::XMLElement        *body = nodeReg == nullptr ? nullptr : findSubXMLElement(nodeReg, jbr::reg::node::name::body);
+        const tinyxml2::XMLElement  *version = nodeHeader == nullptr ? nullptr : findSubXMLElement(nodeHeader, jbr::reg::node::name::_header::version);
+
+        if (body == nullptr || version == nullptr || version->GetText() == nullptr)
+            return (jbr::reg::Error::Corrupted);
+
+        const tinyxml2::XMLElement  *nodeRights = findSubXMLElement(nodeHeader, jbr::reg::node::name::_header::rights);
+        const tinyxml2::XMLElement  *readElement = nodeRights == nullptr ? nullptr : findSubXMLElement(nodeRights, jbr::reg::node::name::_header::_rights::read);
+
+        if (readElement != nullptr && readElement->QueryBoolText(&readable) != tinyxml2::XMLError::XML_SUCCESS)
+            return (jbr::reg::Error::Corrupted);
+        if (!readable)
+            return (jbr::reg::Error::NotReadable);
+
+        jbr::reg::metric::Timer search(jbr::reg::metric::Phase::Search);
+
+        for (tinyxml2::XMLElement *element = body->FirstChildElement(); element != nullptr; element = element->NextSiblingElement())
+        {
+            const tinyxml2::XMLElement  *keyNode = findSubXMLElement(element, jbr::reg::node::name::_body::_variable::key);
+
+            if (keyNode == nullptr)
+                return (jbr::reg::Error::Corrupted);
+
+            const char  *keyText = keyNode->GetText();
+
+            if (keyText != nullptr && std::strcmp(keyText, key) == 0)
             {
-                const char *textValue = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value)->GetText();
+                std::optional<std::chrono::system_clock::time_point>    expiration;
 
-                return (jbr::reg::Variable(key,
-                                           textValue == nullptr ? "" : textValue,
-                                           jbr::reg::var::perm::Rights(getVariableRightsFromNode(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)))));
+                if (queryVariableExpiration(element, expiration) != jbr::reg::Error::None)
+                    return (jbr::reg::Error::Corrupted);
+                if (expiration != std::nullopt && expiration.value() <= std::chrono::system_clock::now())
+                {
+                    try {
+                        jbr::reg::Expirer::get().schedule(mPath, key, expiration.value());
+                    }
+                    catch (...) {}
+                    return (jbr::reg::Error::NotFound);
+                }
+                *variableElement = element;
+                return (jbr::reg::Error::None);
             }
-        throw jbr::reg::exception("No variable named '" + std::string(key) + "' were found into the register '" + mPath + "'.");
+        }
+        return (jbr::reg::Error::NotFound);
+    }
+
+    jbr::reg::Error Instance::queryVariableRights(const tinyxml2::XMLElement *nodeRights, jbr::reg::var::perm::Rights &rights) const noexcept
+    {
+        std::uint8_t    bits = jbr::reg::var::perm::Mask(rights).bits();
+
+        if (queryRightsBits(nodeRights, mVariableRightsFields, bits) != nullptr)
+            return (jbr::reg::Error::Corrupted);
+        rights = jbr::reg::var::perm::Mask(bits).rights();
+        return (jbr::reg::Error::None);
+    }
+
+    jbr::reg::Error Instance::queryVariableExpiration(const tinyxml2::XMLElement *variableElement,
+                                                      std::optional<std::chrono::system_clock::time_point> &expiration) const noexcept
+    {
+        const tinyxml2::XMLElement  *expirationNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::expiration);
+        int64_t                     milliseconds = 0;
+
+        expiration.reset();
+        if (expirationNode == nullptr)
+            return (jbr::reg::Error::None);
+        if (expirationNode->QueryInt64Text(&milliseconds) != tinyxml2::XMLError::XML_SUCCESS)
+            return (jbr::reg::Error::Corrupted);
+        expiration = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(milliseconds)));
+        return (jbr::reg::Error::None);
+    }
+
+    std::optional<std::chrono::system_clock::time_point>    Instance::getVariableExpirationFromNode(const tinyxml2::XMLElement *variableElement) const noexcept(false)
+    {
+        std::optional<std::chrono::system_clock::time_point>    expiration;
+
+        if (queryVariableExpiration(variableElement, expiration) != jbr::reg::Error::None)
+            throw jbr::reg::exception("Register corrupted. Field expiration from register/body/variable nodes is invalid.");
+        return (expiration);
+    }
+
+    bool    Instance::isExpired(const tinyxml2::XMLElement *variableElement) const noexcept(false)
+    {
+        std::optional<std::chrono::system_clock::time_point>    expiration = getVariableExpirationFromNode(variableElement);
+
+        if (expiration == std::nullopt || expiration.value() > std::chrono::system_clock::now())
+            return (false);
+        jbr::reg::Expirer::get().schedule(mPath, getSubXMLElement(const_cast<tinyxml2::XMLElement *>(variableElement),
+                                                                  jbr::reg::node::name::_body::_variable::key)->GetText(), expiration.value());
+        return (true);
+    }
+
+    void    Instance::purge(const std::set<std::string> &keys) const noexcept(false)
+    {
+        jbr::reg::metric::Timer         timer(jbr::reg::metric::Operation::Purge);
+        jbr::reg::FileLock              lock(mPath);
+        jbr::reg::Arena::Lease          lease;
+        tinyxml2::XMLDocument           &reg = *lease;
+        tinyxml2::XMLElement            *body = getBodyXMLElement(reg);
+        tinyxml2::XMLElement            *next = nullptr;
+        bool                            indexed = jbr::reg::ValueIndex(mPath).enabled();
+        jbr::reg::ValueIndex::Changes   changes;
+
+        if (!isWritable(reg))
+            throw jbr::reg::exception("The register " + mPath + " is not writable. Please check the register rights, write must be allow.");
+        for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = next)
+        {
+            const char  *key = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+
+            next = variableElement->NextSiblingElement();
+            if (key != nullptr && keys.count(key) > 0 && isExpired(variableElement))
+            {
+                changes.push_back(jbr::reg::ValueIndex::Change{ key, indexed ? indexBucket(variableElement) : std::string(), std::string(), std::nullopt, 0 });
+                body->DeleteChild(variableElement);
+            }
+        }
+        if (changes.empty())
+            return ;
+        saveXMLFile(reg, changes);
+        collectBlobs(reg);
+    }
+
+    void    Instance::open() const noexcept(false)
+    {
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
+
+        loadXMLFile(reg);
+        if (!isOpenable(reg))
+            throw jbr::reg::exception("The register '" + mPath + "' is not openable. Please check the register rights, read and open must be allowed.");
+        scheduleExpirations(getSubXMLElement(getSubXMLElement(&reg, jbr::reg::node::name::reg), jbr::reg::node::name::body));
+    }
+
+    void    Instance::scheduleExpirations(const tinyxml2::XMLElement *body) const noexcept(false)
+    {
+        for (const tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            std::optional<std::chrono::system_clock::time_point>    expiration;
+            const tinyxml2::XMLElement                              *keyNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key);
+
+            if (keyNode != nullptr && keyNode->GetText() != nullptr &&
+                queryVariableExpiration(variableElement, expiration) == jbr::reg::Error::None && expiration != std::nullopt)
+                jbr::reg::Expirer::get().schedule(mPath, keyNode->GetText(), expiration.value());
+        }
     }
 
     void    Instance::remove(const char *key) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Remove);
+        jbr::reg::FileLock      lock(mPath);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
 
         if (key == nullptr || std::strlen(key) == 0)
             throw jbr::reg::exception("Impossible to remove a null or empty variable.");
-        for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
-            if (std::strcmp(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText(), key) == 0)
-            {
-                if (!getVariableRightsFromNode(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)).mRemove)
-                    throw jbr::reg::exception("Impossible to remove the variable, no remove rights set.");
-                body->DeleteChild(variableElement);
-                saveXMLFile(reg);
-                return ;
-            }
-        throw jbr::reg::exception("No variable named '" + std::string(key) + "' were found into the register '" + mPath + "'.");
+
+        tinyxml2::XMLElement            *variableElement = findVariableElement(body, key);
+        jbr::reg::ValueIndex::Changes   changes;
+
+        if (variableElement == nullptr)
+            throw jbr::reg::exception("No variable named '" + std::string(key) + "' were found into the register '" + mPath + "'.");
+        if (!getVariableMaskFromNode(getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)).has(jbr::reg::var::perm::Mask::Remove))
+            throw jbr::reg::exception("Impossible to remove the variable, no remove rights set.");
+        if (jbr::reg::ValueIndex(mPath).enabled())
+            changes.push_back(jbr::reg::ValueIndex::Change{ key, indexBucket(variableElement), std::string(), std::nullopt, 0 });
+        body->DeleteChild(variableElement);
+        saveXMLFile(reg, changes);
+        collectBlobs(reg);
+    }
+
+    jbr::reg::Operation<jbr::reg::Variable> Instance::asyncGet(const char *key) const noexcept(false)
+    {
+        if (key == nullptr || std::strlen(key) == 0)
+            throw jbr::reg::exception("Impossible to extract a null or empty variable.");
+        return (launch<jbr::reg::Variable>([path = mPath, key = std::string(key)]() mutable {
+            return (jbr::reg::Instance(std::move(path)).get(key.c_str()));
+        }));
+    }
+
+    jbr::reg::Operation<void>   Instance::asyncSet(const jbr::reg::Variable &variable, bool replaceIfExist) const noexcept(false)
+    {
+        return (launch<void>([path = mPath, threshold = mBlobThreshold, delay = mBlobCollectDelay, variable, replaceIfExist]() mutable {
+            jbr::reg::Instance(std::move(path), threshold, delay).set(variable, replaceIfExist);
+        }));
+    }
+
+    jbr::reg::Operation<void>   Instance::asyncFlush() const noexcept(false)
+    {
+        return (launch<void>([]() {}));
+    }
+
+    jbr::reg::WatchId   Instance::watch(jbr::reg::WatchCallback &&callback) noexcept(false)
+    {
+        mWatches.push_back(jbr::reg::Watcher::get().subscribe(mPath, std::nullopt, std::move(callback)));
+        return (mWatches.back());
+    }
+
+    jbr::reg::WatchId   Instance::watch(const char *key, jbr::reg::WatchCallback &&callback) noexcept(false)
+    {
+        if (key == nullptr || !key[0])
+            throw jbr::reg::exception("Impossible to watch a null or empty variable.");
+        mWatches.push_back(jbr::reg::Watcher::get().subscribe(mPath, std::string(key), std::move(callback)));
+        return (mWatches.back());
+    }
+
+    void    Instance::unwatch(jbr::reg::WatchId id) noexcept
+    {
+        auto    watch = std::find(mWatches.begin(), mWatches.end(), id);
+
+        if (watch == mWatches.end())
+            return ;
+        jbr::reg::Watcher::get().unsubscribe(id);
+        mWatches.erase(watch);
     }
 
     void    Instance::checkPathValidity() const noexcept(false)
@@ -241,20 +1012,28 @@ namespace jbr::reg
         return (newElement);
     }
 
-    tinyxml2::XMLElement    *Instance::getSubXMLElement(tinyxml2::XMLNode *node, const char *subNodeName) const noexcept(false)
+    tinyxml2::XMLElement    *Instance::getSubXMLElement(tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) const noexcept(false)
     {
         if (node == nullptr)
             throw jbr::reg::exception("Error while extracting sub node, the parent node is null.");
-        if (subNodeName == nullptr)
-            throw jbr::reg::exception("The sub node name to extract is null.");
 
-        tinyxml2::XMLElement    *subNode = node->FirstChildElement(subNodeName);
+        tinyxml2::XMLElement    *subNode = findSubXMLElement(node, subNodeName);
 
         if (subNode == nullptr)
             throw jbr::reg::exception("Error while extract the sub node, the result is null. The sub node " + std::string(subNodeName) + " does not exist.");
         return (subNode);
     }
 
+    tinyxml2::XMLElement    *Instance::findSubXMLElement(tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) noexcept
+    {
+        return (node->FirstChildElement(subNodeName.data(), subNodeName.size()));
+    }
+
+    const tinyxml2::XMLElement  *Instance::findSubXMLElement(const tinyxml2::XMLNode *node, const jbr::reg::node::Name &subNodeName) noexcept
+    {
+        return (node->FirstChildElement(subNodeName.data(), subNodeName.size()));
+    }
+
     tinyxml2::XMLElement    *Instance::getBodyXMLElement(tinyxml2::XMLDocument &xmlDocument) const noexcept(false)
     {
         loadXMLFile(xmlDocument);
@@ -264,12 +1043,455 @@ namespace jbr::reg
         return (getSubXMLElement(getSubXMLElement(&xmlDocument, jbr::reg::node::name::reg), jbr::reg::node::name::body));
     }
 
-    void    Instance::saveXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept(false)
+    std::string Instance::saveXMLFile(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::ValueIndex::Changes &changes) const noexcept(false)
     {
-        tinyxml2::XMLError      err = xmlDocument.SaveFile(mPath.c_str());
+#ifdef _WIN32
+        writeXMLFile(xmlDocument, mPath);
 
-        if (err != tinyxml2::XMLError::XML_SUCCESS)
-            throw jbr::reg::exception("Error while saving the register content, error code : " + std::to_string(err) + ".");
+        std::string                     saved = jbr::reg::stamp(mPath);
+
+        saveIndex(xmlDocument, changes, saved);
+#else
+        static std::atomic<std::size_t> counter(0);
+        std::error_code                 errCode;
+        std::string                     target = std::filesystem::weakly_canonical(mPath, errCode).string(); // A link is kept, its target replaced.
+        struct stat                     st{};
+        bool                            exists = false;
+
+        if (errCode || target.empty())
+            target = mPath;
+        exists = ::stat(target.c_str(), &st) == 0;
+
+        std::string                     temporary = target + '.' + std::to_string(getpid()) + '.' + std::to_string(counter++) + ".tmp";
+        std::string                     saved;
+
+        try {
+            writeXMLFile(xmlDocument, temporary);
+            if (exists)
+            {
+                (void)::chown(temporary.c_str(), st.st_uid, st.st_gid); // Only allowed to the owner groups, unless privileged.
+                (void)::chmod(temporary.c_str(), st.st_mode & 07777);
+            }
+            // The rename keeps the stamp of the saved file. The index is updated while the replaced register is locked, a writer
+            // locking the new one comes after.
+            saved = jbr::reg::stamp(temporary);
+            saveIndex(xmlDocument, changes, saved);
+        }
+        catch (...) {
+            std::filesystem::remove(temporary, errCode);
+            throw;
+        }
+        // Readers never see a partially written register, a mapped register is never truncated under them. The other hard links
+        // of the register keep its previous content.
+        std::filesystem::rename(temporary, target, errCode);
+        if (errCode)
+        {
+            std::filesystem::remove(temporary, errCode);
+            throw jbr::reg::exception("Error while saving the register content : " + errCode.message() + ".");
+        }
+#endif
+        return (saved);
+    }
+
+    void    Instance::saveIndex(tinyxml2::XMLDocument &xmlDocument, const jbr::reg::ValueIndex::Changes &changes, const std::string &stamp) const noexcept(false)
+    {
+        jbr::reg::ValueIndex    index(mPath);
+        bool                    readable = false;
+
+        if (!index.enabled())
+            return ;
+        if (index.fresh(readable))
+            index.apply(changes, stamp, isReadable(xmlDocument));
+        else
+            rebuildIndex(xmlDocument, stamp);
+    }
+
+    void    Instance::writeXMLFile(tinyxml2::XMLDocument &xmlDocument, const std::string &path) const noexcept(false)
+    {
+        jbr::reg::Serializer    serializer(path);
+
+        {
+            jbr::reg::metric::Timer serialize(jbr::reg::metric::Phase::Serialize); // The full buffers are written on the way.
+
+            serializer.serialize(xmlDocument);
+        }
+
+        jbr::reg::metric::Timer io(jbr::reg::metric::Phase::Io);
+
+        serializer.finish();
+        jbr::reg::Metrics::get().written(serializer.written());
+    }
+
+    std::string Instance::indexBucket(const tinyxml2::XMLElement *variableElement, std::uint64_t *check) const noexcept(false)
+    {
+        const tinyxml2::XMLElement  *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+        std::size_t                 size = 0;
+        std::uint64_t               hash = jbr::reg::BlobStore::mDigestBasis;
+        std::uint64_t               valueCheck = jbr::reg::ValueIndex::mCheckBasis;
+
+        if (!getVariableMaskFromNode(findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)).isReadable())
+            return (std::string());
+        if (blobNode == nullptr)
+        {
+            std::string value = readValue(variableElement);
+
+            if (check != nullptr)
+                *check = jbr::reg::ValueIndex::check(value.data(), value.size());
+            return (jbr::reg::BlobStore::identify(value.data(), value.size()));
+        }
+
+        jbr::reg::BlobStore store(mPath);
+
+        for (const std::string &chunk : getBlobChunksFromNode(blobNode, size))
+        {
+            std::string content = store.read(chunk);
+
+            hash = jbr::reg::BlobStore::digest(content.data(), content.size(), hash);
+            valueCheck = jbr::reg::ValueIndex::check(content.data(), content.size(), valueCheck);
+        }
+        if (check != nullptr)
+            *check = valueCheck;
+        return (jbr::reg::BlobStore::identify(hash, size));
+    }
+
+    jbr::reg::ValueIndex::Change    Instance::indexChange(const tinyxml2::XMLElement *variableElement, std::string &&from) const noexcept(false)
+    {
+        std::uint64_t   check = 0;
+        std::string     to = indexBucket(variableElement, &check);
+
+        return (jbr::reg::ValueIndex::Change{ getSubXMLElement(const_cast<tinyxml2::XMLElement *>(variableElement), jbr::reg::node::name::_body::_variable::key)->GetText(),
+                                              std::move(from), std::move(to), getVariableExpirationFromNode(variableElement), check });
+    }
+
+    void    Instance::rebuildIndex(tinyxml2::XMLDocument &xmlDocument, const std::string &stamp) const noexcept(false)
+    {
+        jbr::reg::ValueIndex::Buckets   buckets;
+
+        for (const tinyxml2::XMLElement *variableElement = getSubXMLElement(getSubXMLElement(&xmlDocument, jbr::reg::node::name::reg), jbr::reg::node::name::body)->FirstChildElement();
+             variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            jbr::reg::ValueIndex::Change    change = indexChange(variableElement, std::string());
+
+            if (!change.mTo.empty())
+                buckets[change.mTo].push_back(jbr::reg::ValueIndex::Entry{ std::move(change.mKey), change.mExpiration, change.mCheck });
+        }
+        jbr::reg::ValueIndex(mPath).rebuild(buckets, stamp, isReadable(xmlDocument));
+    }
+
+    void    Instance::enableValueIndex() const noexcept(false)
+    {
+        jbr::reg::FileLock      lock(mPath);
+        std::string             stamp = jbr::reg::stamp(mPath);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
+
+        loadXMLFile(reg);
+        verify(reg);
+        rebuildIndex(reg, stamp);
+    }
+
+    void    Instance::disableValueIndex() const noexcept(false)
+    {
+        jbr::reg::FileLock  lock(mPath);
+
+        jbr::reg::ValueIndex(mPath).destroy();
+    }
+
+    void    Instance::enableKeyFilter() const noexcept(false)
+    {
+        jbr::reg::FileLock      lock(mPath);
+        std::string             stamp = jbr::reg::stamp(mPath);
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
+
+        jbr::reg::KeyFilter::save(mPath, *buildKeyFilter(getBodyXMLElement(reg), std::move(stamp)));
+    }
+
+    void    Instance::disableKeyFilter() const noexcept(false)
+    {
+        jbr::reg::FileLock  lock(mPath);
+
+        jbr::reg::KeyFilter::destroy(mPath);
+    }
+
+    std::shared_ptr<const jbr::reg::KeyFilter>  Instance::buildKeyFilter(const tinyxml2::XMLElement *body, std::string &&stamp) const noexcept(false)
+    {
+        std::size_t count = 0;
+
+        for (const tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+            ++count;
+
+        auto    filter = std::make_shared<jbr::reg::KeyFilter>(std::move(stamp), count);
+
+        for (const tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            const tinyxml2::XMLElement  *keyNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key);
+
+            if (keyNode != nullptr && keyNode->GetText() != nullptr)
+                filter->insert(keyNode->GetText());
+        }
+        if (!filter->stamp().empty() && filter->stamp() == jbr::reg::stamp(mPath)) // Not replaced while loaded.
+            jbr::reg::KeyFilter::cache(mPath, filter);
+        return (filter);
+    }
+
+    void    Instance::updateKeyFilter(const std::string &stamp, const std::string &saved, const char *key) const noexcept
+    {
+        try {
+            std::shared_ptr<const jbr::reg::KeyFilter>  filter = jbr::reg::KeyFilter::cached(mPath, stamp);
+
+            if (filter == nullptr)
+                return ;
+
+            auto    updated = std::make_shared<jbr::reg::KeyFilter>(std::string(saved), *filter); // Not the current stamp, a other writer may have replaced it.
+
+            updated->insert(key);
+            if (!updated->stamp().empty())
+                jbr::reg::KeyFilter::cache(mPath, updated);
+        }
+        catch (...) { // The filter of the previous stamp is not used anymore, it is rebuilt on the next lookup.
+        }
+    }
+
+    std::vector<std::string>    Instance::keysWithValue(const char *value) const noexcept(false)
+    {
+        jbr::reg::metric::Timer                 timer(jbr::reg::metric::Operation::KeysWithValue);
+        jbr::reg::ValueIndex                    index(mPath);
+        bool                                    readable = false;
+        std::vector<std::string>                keys;
+        std::chrono::system_clock::time_point   now = std::chrono::system_clock::now();
+
+        if (value == nullptr)
+            throw jbr::reg::exception("Impossible to search the keys of a null value.");
+        if (!index.enabled())
+        {
+            (void)forEach([value, &keys](const jbr::reg::VariableView &variable) {
+                if (variable.mRights.mRead && variable.mValue == value)
+                    keys.emplace_back(variable.mKey);
+                return (true);
+            });
+            return (keys);
+        }
+        bool    fresh = index.fresh(readable);
+
+        jbr::reg::Metrics::get().lookup(jbr::reg::metric::Cache::ValueIndex, fresh);
+        if (!fresh)
+        {
+            jbr::reg::FileLock      lock(mPath);
+            jbr::reg::Arena::Lease  lease;
+            tinyxml2::XMLDocument   &reg = *lease;
+
+            if (!index.fresh(readable))
+            {
+                loadXMLFile(reg);
+                verify(reg);
+                rebuildIndex(reg, jbr::reg::stamp(mPath));
+                readable = isReadable(reg);
+            }
+        }
+        if (!readable)
+            throw jbr::reg::exception("The register " + mPath + " is not readable. Please check the register rights, read must be allow.");
+
+        jbr::reg::FileLock  lock(mPath, true); // Buckets are consistent with the register while its writers are excluded.
+        std::size_t         size = std::strlen(value);
+        std::uint64_t       check = jbr::reg::ValueIndex::check(value, size);
+
+        for (jbr::reg::ValueIndex::Entry &entry : index.read(jbr::reg::BlobStore::identify(value, size)))
+            if (entry.mCheck == check && (entry.mExpiration == std::nullopt || entry.mExpiration.value() > now))
+                keys.push_back(std::move(entry.mKey)); // A other value of the same hash is told apart by its check.
+        return (keys);
+    }
+
+    std::vector<std::string>    Instance::findKeys(const char *pattern, jbr::reg::Pattern syntax) const noexcept(false)
+    {
+        jbr::reg::metric::Timer                     timer(jbr::reg::metric::Operation::FindKeys);
+        jbr::reg::KeyMatcher                        matcher(pattern, syntax);
+        std::string                                 stamp = jbr::reg::stamp(mPath);
+        std::shared_ptr<const jbr::reg::KeyIndex>   index = jbr::reg::KeyIndex::cached(mPath, stamp);
+
+        jbr::reg::Metrics::get().lookup(jbr::reg::metric::Cache::KeyIndex, index != nullptr);
+        if (index == nullptr)
+        {
+            std::vector<jbr::reg::KeyIndex::Key>    keys;
+            std::error_code                         err;
+
+            if (std::filesystem::file_size(mPath, err) < mParallelParseThreshold || err || !loadKeysParallel(keys))
+            {
+                jbr::reg::Arena::Lease  lease;
+                tinyxml2::XMLDocument   &reg = *lease;
+                tinyxml2::XMLElement    *body = getBodyXMLElement(reg);
+
+                keys.clear();
+                for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+                {
+                    const char  *key = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+
+                    keys.push_back(jbr::reg::KeyIndex::Key{ key == nullptr ? "" : key, getVariableExpirationFromNode(variableElement) });
+                }
+            }
+            index = std::make_shared<const jbr::reg::KeyIndex>(std::move(stamp), std::move(keys));
+            if (!index->stamp().empty())
+                jbr::reg::KeyIndex::cache(mPath, index);
+        }
+
+        jbr::reg::metric::Timer search(jbr::reg::metric::Phase::Search);
+
+        return (index->find(matcher));
+    }
+
+    bool    Instance::loadKeysParallel(std::vector<jbr::reg::KeyIndex::Key> &keys) const noexcept(false)
+    {
+        //!
+        //! @struct Chunks
+        //! @brief Body chunks parsed by the workers and the calling thread.
+        //!
+        struct Chunks
+        {
+            std::vector<std::pair<std::size_t, std::size_t>>    mBounds; //!< Chunks begin and end offsets into the register content.
+            std::vector<std::vector<jbr::reg::KeyIndex::Key>>   mKeys; //!< Keys of each chunk.
+            std::atomic<std::size_t>                            mNext{0}; //!< Next chunk to parse.
+            std::atomic<std::size_t>                            mDone{0}; //!< Number of chunks parsed.
+            std::atomic<bool>                                   mFailed{false}; //!< Tell if a chunk can't be parsed.
+            std::mutex                                          mMutex; //!< Protect the completion notification.
+            std::condition_variable                             mCondition; //!< Notified once all the chunks are parsed.
+        };
+
+        std::string             content;
+        jbr::reg::ThreadPool    &pool = jbr::reg::ThreadPool::cpu();
+        auto                    chunks = std::make_shared<Chunks>();
+
+        {
+            jbr::reg::metric::Timer io(jbr::reg::metric::Phase::Io);
+            std::ifstream           ifs(mPath, std::ios::binary | std::ios::ate);
+
+            if (!ifs)
+                return (false);
+            content.resize(static_cast<std::size_t>(ifs.tellg()));
+            if (!ifs.seekg(0) || !ifs.read(content.data(), static_cast<std::streamsize>(content.size())))
+                return (false);
+        }
+        jbr::reg::Metrics::get().read(content.size());
+
+        jbr::reg::metric::Timer parse(jbr::reg::metric::Phase::Parse);
+        std::size_t             bodyBegin = content.find("<body>");
+        std::size_t             bodyEnd = content.rfind("</body>");
+
+        // The variables boundaries are found by text, the values being escaped. Comments, CDATA or DTD could hide tags.
+        if (bodyBegin == std::string::npos || bodyEnd == std::string::npos || bodyEnd < bodyBegin || content.find("<!") != std::string::npos)
+            return (false);
+        bodyBegin += std::strlen("<body>");
+        {
+            jbr::reg::Arena::Lease  lease;
+            std::string             header = content.substr(0, bodyBegin) + "</body></register>";
+
+            if (lease->Parse(header.data(), header.size()) != tinyxml2::XML_SUCCESS)
+                return (false);
+            try {
+                verify(*lease);
+            }
+            catch (const jbr::reg::exception &) {
+                return (false);
+            }
+            if (!isReadable(*lease))
+                return (false);
+        }
+
+        std::size_t count = (pool.size() + 1) * 4;
+        std::size_t begin = bodyBegin;
+
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            std::size_t split = content.find("<variable>", std::max(begin + 1, bodyBegin + (bodyEnd - bodyBegin) / count * i));
+
+            if (split >= bodyEnd)
+                break;
+            chunks->mBounds.emplace_back(begin, split);
+            begin = split;
+        }
+        chunks->mBounds.emplace_back(begin, bodyEnd);
+        chunks->mKeys.resize(chunks->mBounds.size());
+
+        auto    work = [this, chunks, &content]() {
+            for (std::size_t i = chunks->mNext++; i < chunks->mBounds.size(); i = chunks->mNext++)
+            {
+                try {
+                    jbr::reg::metric::Timer chunkParse(jbr::reg::metric::Phase::ChunkParse);
+                    jbr::reg::Arena::Lease  lease;
+                    tinyxml2::XMLError      err = lease->Parse(content.data() + chunks->mBounds[i].first, chunks->mBounds[i].second - chunks->mBounds[i].first);
+
+                    if (chunks->mFailed || (err != tinyxml2::XML_SUCCESS && err != tinyxml2::XML_ERROR_EMPTY_DOCUMENT))
+                        chunks->mFailed = true;
+                    else
+                        for (tinyxml2::XMLElement *variableElement = lease->FirstChildElement(); variableElement != nullptr && !chunks->mFailed;
+                             variableElement = variableElement->NextSiblingElement())
+                        {
+                            if (std::strcmp(variableElement->Name(), jbr::reg::node::name::_body::variable) != 0)
+                                throw jbr::reg::exception("Unexpected register body element.");
+
+                            const char  *key = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+
+                            chunks->mKeys[i].push_back(jbr::reg::KeyIndex::Key{ key == nullptr ? "" : key, getVariableExpirationFromNode(variableElement) });
+                        }
+                }
+                catch (...) {
+                    chunks->mFailed = true;
+                }
+                if (++chunks->mDone == chunks->mBounds.size())
+                {
+                    std::lock_guard<std::mutex> lock(chunks->mMutex);
+
+                    chunks->mCondition.notify_all();
+                }
+            }
+        };
+
+        try {
+            for (std::size_t i = 0; i < pool.size() && i + 1 < chunks->mBounds.size(); ++i)
+                pool.post(work);
+        }
+        catch (...) {} // The chunks not taken by a worker are parsed by the calling thread.
+        work();
+        {
+            std::unique_lock<std::mutex>    lock(chunks->mMutex);
+
+            chunks->mCondition.wait(lock, [&chunks]() { return (chunks->mDone == chunks->mBounds.size()); });
+        }
+        if (chunks->mFailed)
+            return (false);
+        for (std::vector<jbr::reg::KeyIndex::Key> &chunk : chunks->mKeys)
+            std::move(chunk.begin(), chunk.end(), std::back_inserter(keys));
+        return (true);
+    }
+
+    jbr::reg::MemoryUsage   Instance::memoryUsage() const noexcept(false)
+    {
+        tinyxml2::XMLDocument   reg;
+        tinyxml2::XMLElement    *body = nullptr;
+        std::size_t             sso = std::string().capacity();
+        auto                    heap = [sso](std::size_t length) { return (length > sso ? length + 1 : 0); };
+        jbr::reg::MemoryUsage   usage;
+
+        reg.SetPoolBlockSize(jbr::reg::Arena::blockSize()); // Same blocks than the leased documents, counted exactly.
+        body = getBodyXMLElement(reg);
+        usage.mPools = reg.PoolBytes();
+        if (reg.Mapped())
+            usage.mFile = reg.MappedFileSize();
+        else
+            usage.mStrings = reg.CharBufferBytes();
+        for (tinyxml2::XMLElement *variableElement = body->FirstChildElement(); variableElement != nullptr; variableElement = variableElement->NextSiblingElement())
+        {
+            const char                  *key = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+            const tinyxml2::XMLElement  *blobNode = findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+            std::size_t                 size = 0;
+
+            if (blobNode != nullptr)
+                (void)getBlobChunksFromNode(blobNode, size);
+            else if (const char *value = getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::value)->GetText(); value != nullptr)
+                size = std::strlen(value);
+            usage.mVariables += sizeof(jbr::reg::Variable) + heap(key == nullptr ? 0 : std::strlen(key)) + heap(size);
+            ++usage.mCount;
+        }
+        return (usage);
     }
 
     void    Instance::loadXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept(false)
@@ -277,15 +1499,61 @@ namespace jbr::reg
         if (!exist())
             throw jbr::reg::exception("Impossible to load a not existing xml file : " + mPath + '.');
 
-        tinyxml2::XMLError      err = xmlDocument.LoadFile(mPath.c_str());
+        tinyxml2::XMLError      err = readXMLFile(xmlDocument);
 
         if (err != tinyxml2::XMLError::XML_SUCCESS)
             throw jbr::reg::exception("Parsing error while loading the register file, error code : " + std::to_string(err) + '.');
     }
 
+    bool    Instance::loadXMLHeader(tinyxml2::XMLDocument &xmlDocument) const noexcept
+    {
+        try {
+            jbr::reg::metric::Timer io(jbr::reg::metric::Phase::Io);
+            std::ifstream           ifs(mPath, std::ios::binary);
+            std::string             header;
+            std::size_t             bodyBegin = std::string::npos;
+            char                    buffer[4096];
+
+            while (bodyBegin == std::string::npos && header.size() < mHeaderReadLimit && ifs.read(buffer, sizeof(buffer)).gcount() > 0)
+            {
+                header.append(buffer, static_cast<std::size_t>(ifs.gcount()));
+                bodyBegin = header.find("<body>");
+            }
+            jbr::reg::Metrics::get().read(header.size());
+            // As for the parallel parsing, comments, CDATA or DTD could hide the body tag.
+            if (bodyBegin == std::string::npos || header.find("<!") < bodyBegin)
+                return (false);
+            header.resize(bodyBegin + std::strlen("<body>"));
+            header += "</body></register>";
+
+            jbr::reg::metric::Timer parse(jbr::reg::metric::Phase::Parse);
+
+            return (xmlDocument.Parse(header.data(), header.size()) == tinyxml2::XML_SUCCESS);
+        }
+        catch (...) {
+            return (false);
+        }
+    }
+
+    tinyxml2::XMLError  Instance::readXMLFile(tinyxml2::XMLDocument &xmlDocument) const noexcept
+    {
+        {
+            jbr::reg::metric::Timer io(jbr::reg::metric::Phase::Io);
+
+            if (xmlDocument.MapFile(mPath.c_str(), mMapThreshold) != tinyxml2::XMLError::XML_SUCCESS)
+                return (xmlDocument.ErrorID());
+        }
+        jbr::reg::Metrics::get().read(xmlDocument.MappedFileSize());
+
+        jbr::reg::metric::Timer parse(jbr::reg::metric::Phase::Parse);
+
+        return (xmlDocument.ParseMapped());
+    }
+
     void    Instance::createHeader(const std::optional<jbr::reg::perm::Rights> &rights) const noexcept(false)
     {
-        tinyxml2::XMLDocument   reg;
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &reg = *lease;
         tinyxml2::XMLNode       *nodeReg = newXMLElement(&reg, jbr::reg::node::name::reg);
         tinyxml2::XMLNode       *nodeHeader = newXMLElement(&reg, jbr::reg::node::name::header);
         tinyxml2::XMLElement    *version = newXMLElement(&reg, jbr::reg::node::name::_header::version);
@@ -306,27 +1574,12 @@ namespace jbr::reg
         if (reg == nullptr || nodeHeader == nullptr || version == nullptr)
             throw jbr::reg::exception("Pointers must not be null during writing rights process.");
 
-        tinyxml2::XMLNode       *nodeRights = newXMLElement(reg, "rights");
-        tinyxml2::XMLElement    *readElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::read);
-        tinyxml2::XMLElement    *writeElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::write);
-        tinyxml2::XMLElement    *openElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::open);
-        tinyxml2::XMLElement    *copyElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::copy);
-        tinyxml2::XMLElement    *moveElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::move);
-        tinyxml2::XMLElement    *destroyElement = newXMLElement(reg, jbr::reg::node::name::_header::_rights::destroy);
+        tinyxml2::XMLNode       *nodeRights = newXMLElement(reg, jbr::reg::node::name::_header::rights);
+        jbr::reg::perm::Mask    mask(rights);
 
         nodeHeader->InsertAfterChild(version, nodeRights);
-        readElement->SetText(rights.mRead);
-        writeElement->SetText(rights.mWrite);
-        openElement->SetText(rights.mOpen);
-        copyElement->SetText(rights.mCopy);
-        moveElement->SetText(rights.mMove);
-        destroyElement->SetText(rights.mDestroy);
-        nodeRights->InsertFirstChild(readElement);
-        nodeRights->InsertAfterChild(readElement, writeElement);
-        nodeRights->InsertAfterChild(writeElement, openElement);
-        nodeRights->InsertAfterChild(openElement, copyElement);
-        nodeRights->InsertAfterChild(copyElement, moveElement);
-        nodeRights->InsertAfterChild(moveElement, destroyElement);
+        for (const RightsField &field : mRightsFields)
+            nodeRights->InsertEndChild(newXMLElement(reg, field.first))->ToElement()->SetText(mask.has(field.second));
     }
 
     void    Instance::writeRights(tinyxml2::XMLDocument *reg, tinyxml2::XMLNode *nodeVariable,
@@ -335,27 +1588,12 @@ namespace jbr::reg
         if (reg == nullptr || nodeVariable == nullptr || variableValue == nullptr)
             throw jbr::reg::exception("Pointers must not be null during writing rights process.");
 
-        tinyxml2::XMLNode       *nodeRights = newXMLElement(reg, jbr::reg::node::name::_body::_variable::rights);
-        tinyxml2::XMLElement    *readElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::read);
-        tinyxml2::XMLElement    *writeElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::write);
-        tinyxml2::XMLElement    *updateElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::update);
-        tinyxml2::XMLElement    *renameElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::rename);
-        tinyxml2::XMLElement    *copyElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::copy);
-        tinyxml2::XMLElement    *removeElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::_rights::remove);
+        tinyxml2::XMLNode           *nodeRights = newXMLElement(reg, jbr::reg::node::name::_body::_variable::rights);
+        jbr::reg::var::perm::Mask   mask(rights);
 
         nodeVariable->InsertAfterChild(variableValue, nodeRights);
-        readElement->SetText(rights.mRead);
-        writeElement->SetText(rights.mWrite);
-        updateElement->SetText(rights.mUpdate);
-        renameElement->SetText(rights.mRename);
-        copyElement->SetText(rights.mCopy);
-        removeElement->SetText(rights.mRemove);
-        nodeRights->InsertFirstChild(readElement);
-        nodeRights->InsertAfterChild(readElement, writeElement);
-        nodeRights->InsertAfterChild(writeElement, updateElement);
-        nodeRights->InsertAfterChild(updateElement, renameElement);
-        nodeRights->InsertAfterChild(renameElement, copyElement);
-        nodeRights->InsertAfterChild(copyElement, removeElement);
+        for (const RightsField &field : mVariableRightsFields)
+            nodeRights->InsertEndChild(newXMLElement(reg, field.first))->ToElement()->SetText(mask.has(field.second));
     }
 
     void    Instance::updateRights(tinyxml2::XMLDocument *reg, tinyxml2::XMLNode *nodeVariable,
@@ -364,33 +1602,81 @@ namespace jbr::reg
         if (reg == nullptr || nodeVariable == nullptr || variableValue == nullptr)
             throw jbr::reg::exception("Pointers must not be null during writing rights process.");
 
-        tinyxml2::XMLNode       *nodeRights = getSubXMLElement(nodeVariable, jbr::reg::node::name::_body::_variable::rights);
-        tinyxml2::XMLElement    *readElement = getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::read);
-        tinyxml2::XMLElement    *writeElement = getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::write);
-        tinyxml2::XMLElement    *updateElement = getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::update);
+        tinyxml2::XMLElement        *nodeRights = getSubXMLElement(nodeVariable, jbr::reg::node::name::_body::_variable::rights);
+        jbr::reg::var::perm::Mask   mask(rights);
 
-        if (std::strcmp(readElement->GetText(), "true") != 0 || std::strcmp(writeElement->GetText(), "true") != 0 ||
-            std::strcmp(updateElement->GetText(), "true") != 0)
+        if (!getVariableMaskFromNode(nodeRights).has(jbr::reg::var::perm::Mask::Read | jbr::reg::var::perm::Mask::Write | jbr::reg::var::perm::Mask::Update))
             throw jbr::reg::exception("Impossible to update a variable without read, write and update rights.");
-        readElement->SetText(rights.mRead);
-        writeElement->SetText(rights.mWrite);
-        updateElement->SetText(rights.mUpdate);
-        getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::rename)->SetText(rights.mRename);
-        getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::copy)->SetText(rights.mCopy);
-        getSubXMLElement(nodeRights, jbr::reg::node::name::_body::_variable::_rights::remove)->SetText(rights.mRemove);
+        for (const RightsField &field : mVariableRightsFields)
+            getSubXMLElement(nodeRights, field.first)->SetText(mask.has(field.second));
     }
 
-    void    Instance::queryRightToXMLElement(const tinyxml2::XMLElement *xmlElement, bool *status) const noexcept(false)
+    void    Instance::writeExpiration(tinyxml2::XMLDocument *reg, tinyxml2::XMLNode *nodeVariable,
+                                      const std::optional<std::chrono::system_clock::time_point> &expiration) const noexcept(false)
     {
-        tinyxml2::XMLError      err;
+        if (reg == nullptr || nodeVariable == nullptr)
+            throw jbr::reg::exception("Pointers must not be null during writing expiration process.");
+
+        tinyxml2::XMLElement    *expirationElement = findSubXMLElement(nodeVariable, jbr::reg::node::name::_body::_variable::expiration);
 
-        if (xmlElement != nullptr)
+        if (expiration == std::nullopt)
         {
-            err = xmlElement->QueryBoolText(status);
-            if (err != tinyxml2::XMLError::XML_SUCCESS)
-                throw jbr::reg::exception("Register corrupted. Field " + std::string(xmlElement->Name()) +
-                                            " from register/header/rights nodes is invalid, error code : " + std::to_string(err) + '.');
+            if (expirationElement != nullptr)
+                nodeVariable->DeleteChild(expirationElement);
+            return ;
+        }
+        if (expirationElement == nullptr)
+        {
+            expirationElement = newXMLElement(reg, jbr::reg::node::name::_body::_variable::expiration);
+            nodeVariable->InsertEndChild(expirationElement);
+        }
+        expirationElement->SetText(static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(expiration.value().time_since_epoch()).count()));
+    }
+
+    void    Instance::queryRightsToXMLElement(const tinyxml2::XMLElement *nodeRights, const RightsFields &fields, std::uint8_t &bits) const noexcept(false)
+    {
+        tinyxml2::XMLError          err = tinyxml2::XMLError::XML_SUCCESS;
+        const tinyxml2::XMLElement  *invalid = queryRightsBits(nodeRights, fields, bits, &err);
+
+        if (invalid != nullptr)
+            throw jbr::reg::exception("Register corrupted. Field " + std::string(invalid->Name()) +
+                                      " from register/header/rights nodes is invalid, error code : " + std::to_string(err) + '.');
+    }
+
+    const tinyxml2::XMLElement  *Instance::queryRightsBits(const tinyxml2::XMLElement *nodeRights, const RightsFields &fields, std::uint8_t &bits,
+                                                           tinyxml2::XMLError *err) noexcept
+    {
+        std::uint8_t    seen = 0;
+
+        if (nodeRights == nullptr)
+            return (nullptr);
+        for (const tinyxml2::XMLElement *element = nodeRights->FirstChildElement(); element != nullptr; element = element->NextSiblingElement())
+        {
+            std::string_view    name(element->Name());
+            std::uint8_t        bit = 0;
+            bool                status = true;
+
+            for (const RightsField &field : fields)
+                if (field.first.view() == name)
+                {
+                    bit = field.second;
+                    break;
+                }
+            if (bit == 0 || (seen & bit) != 0) // Unknown field or duplicate, the first occurrence applies.
+                continue;
+            seen |= bit;
+
+            tinyxml2::XMLError  query = element->QueryBoolText(&status);
+
+            if (query != tinyxml2::XMLError::XML_SUCCESS)
+            {
+                if (err != nullptr)
+                    *err = query;
+                return (element);
+            }
+            bits = static_cast<std::uint8_t>(status ? bits | bit : bits & ~bit);
         }
+        return (nullptr);
     }
 
 }
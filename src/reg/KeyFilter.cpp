@@ -0,0 +1,214 @@
+//!
+//! @file KeyFilter.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/KeyFilter.hpp"
+#include "jbr/reg/exception.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <mutex>
+#include <map>
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+
+namespace jbr::reg
+{
+
+    static const char   *extension = ".filter"; //!< Filter file extension, appended to the register location.
+
+    KeyFilter::KeyFilter(std::string &&stamp, std::size_t keys) noexcept(false) : mStamp(std::move(stamp)),
+                                                                                  mBits(std::max<std::size_t>((keys * mBitsPerKey + 63) / 64, 1), 0)
+    {
+    }
+
+    namespace
+    {
+
+        //!
+        //! @brief Extract the process key filters cache.
+        //! @return Cached filters, by register location, and the cache mutex.
+        //!
+        std::pair<std::map<std::string, std::shared_ptr<const KeyFilter>>, std::mutex>  &filters() noexcept
+        {
+            static std::pair<std::map<std::string, std::shared_ptr<const KeyFilter>>, std::mutex> filters;
+
+            return (filters);
+        }
+
+    }
+
+    std::shared_ptr<const KeyFilter>    KeyFilter::cached(const std::string &path, const std::string &stamp) noexcept
+    {
+        {
+            auto                        &[cache, mutex] = filters();
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        filter = cache.find(path);
+
+            if (stamp.empty())
+                return (nullptr);
+            if (filter != cache.end() && filter->second->stamp() == stamp)
+                return (filter->second);
+        }
+
+        std::shared_ptr<const KeyFilter>    filter = load(path, stamp);
+
+        if (filter != nullptr)
+        {
+            auto                        &[cache, mutex] = filters();
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (cache.size() < mCacheSize || cache.find(path) != cache.end())
+                cache[path] = filter;
+        }
+        return (filter);
+    }
+
+    void    KeyFilter::cache(const std::string &path, const std::shared_ptr<const KeyFilter> &filter) noexcept(false)
+    {
+        {
+            auto                        &[cache, mutex] = filters();
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (cache.size() >= mCacheSize && cache.find(path) == cache.end())
+                cache.erase(cache.begin());
+            cache[path] = filter;
+        }
+        if (enabled(path))
+            save(path, *filter);
+    }
+
+    bool    KeyFilter::enabled(const std::string &path) noexcept
+    {
+        std::error_code err;
+
+        return (std::filesystem::is_regular_file(path + extension, err));
+    }
+
+    void    KeyFilter::save(const std::string &path, const KeyFilter &filter) noexcept(false)
+    {
+        static std::atomic<std::size_t> counter(0);
+#ifdef _WIN32
+        std::string                     temporary = path + extension + '.' + std::to_string(counter++) + ".tmp";
+#else
+        std::string                     temporary = path + extension + '.' + std::to_string(getpid()) + '.' + std::to_string(counter++) + ".tmp";
+#endif
+        std::error_code                 err;
+
+        {
+            std::ofstream   ofs(temporary, std::ios::binary | std::ios::trunc);
+
+            ofs << filter.mStamp << '\n' << mHashes << ' ' << filter.mBits.size() << '\n';
+            ofs.write(reinterpret_cast<const char *>(filter.mBits.data()), static_cast<std::streamsize>(filter.mBits.size() * sizeof(std::uint64_t)));
+            if (!ofs.flush())
+            {
+                ofs.close();
+                std::filesystem::remove(temporary, err);
+                throw jbr::reg::exception("Impossible to write the key filter " + temporary + '.');
+            }
+        }
+        std::filesystem::rename(temporary, path + extension, err); // Readers never see a partially written filter.
+        if (err)
+        {
+            std::filesystem::remove(temporary, err);
+            throw jbr::reg::exception("Impossible to write the key filter " + path + extension + '.');
+        }
+    }
+
+    void    KeyFilter::copy(const std::string &from, const std::string &to) noexcept(false)
+    {
+        std::error_code err;
+
+        if (!enabled(from))
+            return ;
+        std::filesystem::copy_file(from + extension, to + extension, std::filesystem::copy_options::overwrite_existing, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to copy the key filter " + from + extension + " : " + err.message() + '.');
+    }
+
+    void    KeyFilter::move(const std::string &from, const std::string &to) noexcept(false)
+    {
+        std::error_code err;
+
+        if (!enabled(from))
+            return ;
+        std::filesystem::rename(from + extension, to + extension, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to move the key filter " + from + extension + " : " + err.message() + '.');
+        destroy(from);
+    }
+
+    void    KeyFilter::destroy(const std::string &path) noexcept
+    {
+        auto            &[cache, mutex] = filters();
+        std::error_code err;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            cache.erase(path);
+        }
+        std::filesystem::remove(path + extension, err);
+    }
+
+    void    KeyFilter::insert(std::string_view key) noexcept
+    {
+        std::uint64_t   h = hash(key);
+        std::uint64_t   step = (h >> 32) | 1;
+        std::uint64_t   size = mBits.size() * 64;
+
+        for (std::size_t i = 0; i < mHashes; ++i, h += step)
+            mBits[(h % size) / 64] |= std::uint64_t(1) << (h % 64);
+    }
+
+    bool    KeyFilter::mayContain(std::string_view key) const noexcept
+    {
+        std::uint64_t   h = hash(key);
+        std::uint64_t   step = (h >> 32) | 1;
+        std::uint64_t   size = mBits.size() * 64;
+
+        for (std::size_t i = 0; i < mHashes; ++i, h += step)
+            if ((mBits[(h % size) / 64] & (std::uint64_t(1) << (h % 64))) == 0)
+                return (false);
+        return (true);
+    }
+
+    std::uint64_t   KeyFilter::hash(std::string_view key) noexcept
+    {
+        std::uint64_t   h = 0xcbf29ce484222325ULL; // FNV-1a, then the splitmix64 finalizer to spread the short keys.
+
+        for (char c : key)
+            h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return (h ^ (h >> 31));
+    }
+
+    std::shared_ptr<const KeyFilter>    KeyFilter::load(const std::string &path, const std::string &stamp) noexcept
+    {
+        try {
+            std::ifstream   ifs(path + extension, std::ios::binary);
+            std::string     saved;
+            std::size_t     hashes = 0;
+            std::size_t     words = 0;
+
+            if (!std::getline(ifs, saved) || saved != stamp || !(ifs >> hashes >> words) || hashes != mHashes || words == 0 || ifs.get() != '\n')
+                return (nullptr);
+
+            auto    filter = std::make_shared<KeyFilter>(std::string(stamp), 0);
+
+            filter->mBits.resize(words);
+            if (!ifs.read(reinterpret_cast<char *>(filter->mBits.data()), static_cast<std::streamsize>(words * sizeof(std::uint64_t))))
+                return (nullptr);
+            return (filter);
+        }
+        catch (...) {
+            return (nullptr);
+        }
+    }
+
+}
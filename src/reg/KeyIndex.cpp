@@ -0,0 +1,283 @@
+//!
+//! @file KeyIndex.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/KeyIndex.hpp"
+#include "jbr/reg/exception.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <mutex>
+#include <map>
+
+namespace jbr::reg
+{
+
+    KeyMatcher::KeyMatcher(const char *pattern, jbr::reg::Pattern syntax) noexcept(false) : mSyntax(syntax)
+    {
+        if (pattern == nullptr)
+            throw jbr::reg::exception("Impossible to search the keys matching a null pattern.");
+        mPattern = pattern;
+        if (syntax != jbr::reg::Pattern::Regex)
+            return ;
+        try {
+            mRegex.emplace(mPattern, std::regex::ECMAScript | std::regex::optimize);
+        }
+        catch (const std::regex_error &e) {
+            throw jbr::reg::exception("Invalid key pattern '" + mPattern + "' : " + e.what() + '.');
+        }
+    }
+
+    bool    KeyMatcher::match(const std::string &key) const noexcept
+    {
+        if (mSyntax == jbr::reg::Pattern::Glob)
+            return (glob(mPattern.c_str(), key.c_str()));
+        try {
+            return (std::regex_search(key, mRegex.value()));
+        }
+        catch (...) {
+            return (false);
+        }
+    }
+
+    std::vector<std::string>    KeyMatcher::literals() const noexcept(false)
+    {
+        std::vector<std::string>    literals(1);
+
+        if (mSyntax == jbr::reg::Pattern::Glob)
+        {
+            for (std::size_t i = 0; i < mPattern.size(); ++i)
+            {
+                if (mPattern[i] == '\\' && i + 1 < mPattern.size())
+                    literals.back() += mPattern[++i];
+                else if (mPattern[i] == '[')
+                {
+                    i = mPattern.find(']', i + 2);
+                    if (i == std::string::npos)
+                        return (std::vector<std::string>());
+                    literals.emplace_back();
+                }
+                else if (mPattern[i] == '*' || mPattern[i] == '?')
+                    literals.emplace_back();
+                else
+                    literals.back() += mPattern[i];
+            }
+        }
+        else
+        {
+            if (mPattern.find('|') != std::string::npos)
+                return (std::vector<std::string>()); // Alternatives, no mandatory literal.
+            for (std::size_t i = 0; i < mPattern.size() && mPattern[i] != '('; ++i)
+            {
+                char    next = i + 1 < mPattern.size() ? mPattern[i + 1] : '\0';
+
+                if (mPattern[i] == '\\' && std::strchr(".\\/-*+?^$()[]{}|", next) != nullptr && next != '\0')
+                {
+                    ++i;
+                    next = i + 1 < mPattern.size() ? mPattern[i + 1] : '\0';
+                    if (next == '*' || next == '?' || next == '{')
+                        literals.emplace_back();
+                    else
+                        literals.back() += mPattern[i];
+                }
+                else if (mPattern[i] == '\\')
+                {
+                    ++i; // Characters class, assertion or escape sequence, skipped with its operands (\xhh, \uhhhh, \cX, \ddd).
+                    if (next == 'x' || next == 'u' || next == 'c')
+                        i += next == 'x' ? 2 : (next == 'u' ? 4 : 1);
+                    else
+                        while (std::isdigit(static_cast<unsigned char>(next)) && i + 1 < mPattern.size() &&
+                               std::isdigit(static_cast<unsigned char>(mPattern[i + 1])))
+                            ++i;
+                    literals.emplace_back();
+                }
+                else if (mPattern[i] == '[')
+                {
+                    i = mPattern.find(']', i + 2);
+                    if (i == std::string::npos)
+                        return (std::vector<std::string>());
+                    literals.emplace_back();
+                }
+                else if (std::strchr(".*+?^${}", mPattern[i]) != nullptr)
+                    literals.emplace_back();
+                else if (next == '*' || next == '?' || next == '{')
+                    literals.emplace_back(); // Optional character.
+                else
+                    literals.back() += mPattern[i];
+            }
+        }
+        literals.erase(std::remove_if(literals.begin(), literals.end(), [](const std::string &literal) { return (literal.size() < 3); }),
+                       literals.end());
+        return (literals);
+    }
+
+    bool    KeyMatcher::glob(const char *pattern, const char *key) noexcept
+    {
+        const char  *star = nullptr;
+        const char  *retry = nullptr;
+
+        while (*key != '\0')
+        {
+            bool    matched = false;
+            char    c = *pattern;
+
+            if (c == '*')
+            {
+                star = ++pattern;
+                retry = key;
+                continue;
+            }
+            if (c == '?')
+            {
+                matched = true;
+                ++pattern;
+            }
+            else if (c == '[' && std::strchr(pattern + 2, ']') != nullptr)
+            {
+                const char  *it = pattern + 1;
+                bool        negate = *it == '!' || *it == '^';
+
+                if (negate)
+                    ++it;
+                do {
+                    if (it[1] == '-' && it[2] != ']' && it[2] != '\0')
+                    {
+                        matched = matched || (*key >= it[0] && *key <= it[2]);
+                        it += 3;
+                    }
+                    else
+                        matched = matched || *key == *it++;
+                } while (*it != ']');
+                matched = matched != negate;
+                pattern = it + 1;
+            }
+            else
+            {
+                if (c == '\\' && pattern[1] != '\0')
+                    c = *++pattern;
+                matched = c != '\0' && c == *key;
+                if (c != '\0')
+                    ++pattern;
+            }
+            if (matched)
+            {
+                ++key;
+                continue;
+            }
+            if (star == nullptr)
+                return (false);
+            pattern = star;
+            key = ++retry;
+        }
+        while (*pattern == '*')
+            ++pattern;
+        return (*pattern == '\0');
+    }
+
+    KeyIndex::KeyIndex(std::string &&stamp, std::vector<Key> &&keys) noexcept(false) : mStamp(std::move(stamp)), mKeys(std::move(keys))
+    {
+        for (std::uint32_t position = 0; position < mKeys.size(); ++position)
+        {
+            const std::string   &key = mKeys[position].mKey;
+
+            for (std::size_t i = 0; i + 3 <= key.size(); ++i)
+            {
+                std::vector<std::uint32_t>  &positions = mTrigrams[pack(key.data() + i)];
+
+                if (positions.empty() || positions.back() != position)
+                    positions.push_back(position);
+            }
+        }
+    }
+
+    namespace
+    {
+
+        //!
+        //! @brief Extract the process key indexes cache.
+        //! @return Cached indexes, by register location, and the cache mutex.
+        //!
+        std::pair<std::map<std::string, std::shared_ptr<const KeyIndex>>, std::mutex>   &indexes() noexcept
+        {
+            static std::pair<std::map<std::string, std::shared_ptr<const KeyIndex>>, std::mutex>  indexes;
+
+            return (indexes);
+        }
+
+    }
+
+    std::shared_ptr<const KeyIndex> KeyIndex::cached(const std::string &path, const std::string &stamp) noexcept
+    {
+        auto                        &[cache, mutex] = indexes();
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        index = cache.find(path);
+
+        if (index == cache.end() || stamp.empty() || index->second->stamp() != stamp)
+            return (nullptr);
+        return (index->second);
+    }
+
+    void    KeyIndex::cache(const std::string &path, const std::shared_ptr<const KeyIndex> &index) noexcept(false)
+    {
+        auto                        &[cache, mutex] = indexes();
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (cache.size() >= mCacheSize && cache.find(path) == cache.end())
+            cache.erase(cache.begin());
+        cache[path] = index;
+    }
+
+    std::vector<std::string>    KeyIndex::find(const jbr::reg::KeyMatcher &matcher) const noexcept(false)
+    {
+        std::optional<std::vector<std::uint32_t>>   positions = candidates(matcher);
+        std::chrono::system_clock::time_point       now = std::chrono::system_clock::now();
+        std::vector<std::string>                    keys;
+        auto                                        check = [this, &matcher, &now, &keys](std::uint32_t position) {
+            const Key   &key = mKeys[position];
+
+            if ((key.mExpiration == std::nullopt || key.mExpiration.value() > now) && matcher.match(key.mKey))
+                keys.push_back(key.mKey);
+        };
+
+        if (positions == std::nullopt)
+        {
+            for (std::uint32_t position = 0; position < mKeys.size(); ++position)
+                check(position);
+        }
+        else
+            for (std::uint32_t position : positions.value())
+                check(position);
+        return (keys);
+    }
+
+    std::optional<std::vector<std::uint32_t>>   KeyIndex::candidates(const jbr::reg::KeyMatcher &matcher) const noexcept(false)
+    {
+        std::vector<const std::vector<std::uint32_t> *> lists;
+        std::vector<std::uint32_t>                      positions;
+
+        for (const std::string &literal : matcher.literals())
+            for (std::size_t i = 0; i + 3 <= literal.size(); ++i)
+            {
+                auto    trigram = mTrigrams.find(pack(literal.data() + i));
+
+                if (trigram == mTrigrams.end())
+                    return (std::vector<std::uint32_t>());
+                lists.push_back(&trigram->second);
+            }
+        if (lists.empty())
+            return (std::nullopt);
+        std::sort(lists.begin(), lists.end(), [](const auto *first, const auto *second) { return (first->size() < second->size()); });
+        positions = *lists.front();
+        for (std::size_t i = 1; i < lists.size() && !positions.empty(); ++i)
+        {
+            std::vector<std::uint32_t>  intersection;
+
+            std::set_intersection(positions.begin(), positions.end(), lists[i]->begin(), lists[i]->end(), std::back_inserter(intersection));
+            positions = std::move(intersection);
+        }
+        return (positions);
+    }
+
+}
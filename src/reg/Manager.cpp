@@ -5,13 +5,30 @@
 //!
 
 #include "jbr/reg/Manager.hpp"
+#include "jbr/reg/FileLock.hpp"
+#include "jbr/reg/BlobStore.hpp"
+#include "jbr/reg/ValueIndex.hpp"
+#include "jbr/reg/KeyFilter.hpp"
+#include "jbr/reg/Tracer.hpp"
+#include "jbr/reg/ThreadPool.hpp"
 #include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <map>
+#ifndef _WIN32
+# include <fcntl.h>
+# include <unistd.h>
+#endif
 
 namespace jbr::reg
 {
 
     jbr::Register   Manager::create(const char *path, const std::optional<jbr::reg::perm::Rights> &rights) noexcept(false)
     {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Create);
+
         if (exist(path))
             throw jbr::reg::exception("The register '" + std::string(path) + "' already exist. You must remove it before create it or open it.");
 
@@ -23,16 +40,147 @@ namespace jbr::reg
 
     jbr::Register   Manager::open(const char *path) noexcept(false)
     {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Open);
+
         if (!exist(path))
             throw jbr::reg::exception("The register '" + std::string(path == nullptr ? "" : path) + "' does not exist. You must create it before.");
 
         jbr::Register   reg = std::make_unique<jbr::reg::Instance>(path);
 
-        if (!reg->isOpenable())
-            throw jbr::reg::exception("The register '" + std::string(path) + "' is not openable. Please check the register rights, read and open must be allowed.");
+        reg->open();
         return (reg);
     }
 
+    namespace
+    {
+
+        //!
+        //! @brief Extract the process shared registers.
+        //! @return Shared registers, by canonical path, and the registry mutex.
+        //!
+        std::pair<std::map<std::string, std::weak_ptr<const jbr::reg::Instance>>, std::mutex>  &registry() noexcept
+        {
+            static std::pair<std::map<std::string, std::weak_ptr<const jbr::reg::Instance>>, std::mutex>   registry;
+
+            return (registry);
+        }
+
+        //!
+        //! @brief Find a live shared register. The registry lock must be held.
+        //! @param registers Shared registers.
+        //! @param canonical Register canonical path.
+        //! @return Shared register, null if none.
+        //!
+        jbr::SharedRegister shared(const std::map<std::string, std::weak_ptr<const jbr::reg::Instance>> &registers, const std::string &canonical) noexcept
+        {
+            auto    found = registers.find(canonical);
+
+            return (found == registers.end() ? nullptr : found->second.lock());
+        }
+
+        //!
+        //! @brief Ask the system to read a register file ahead, in background.
+        //! @param path Register path.
+        //!
+        void    readahead(const std::string &path) noexcept
+        {
+#ifndef _WIN32
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (fd < 0)
+                return ;
+            (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+            ::close(fd);
+#else
+            (void)path;
+#endif
+        }
+
+    }
+
+    jbr::SharedRegister Manager::acquire(const char *path) noexcept(false)
+    {
+        std::error_code err;
+
+        if (!exist(path))
+            throw jbr::reg::exception("The register '" + std::string(path == nullptr ? "" : path) + "' does not exist. You must create it before.");
+
+        std::string canonical = std::filesystem::canonical(path, err).string();
+        auto        &[registers, mutex] = registry();
+
+        if (err)
+            throw jbr::reg::exception("Impossible to open the register '" + std::string(path) + "' : " + err.message() + '.');
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jbr::SharedRegister         reg = shared(registers, canonical);
+
+            jbr::reg::Metrics::get().lookup(jbr::reg::metric::Cache::Registry, reg != nullptr);
+            if (reg != nullptr)
+                return (reg);
+        }
+
+        jbr::SharedRegister         reg = open(canonical.c_str()); // Opened out of the registry lock, for the bulk openings.
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (jbr::SharedRegister opened = shared(registers, canonical); opened != nullptr)
+            return (opened); // Opened meanwhile by a other caller, its instance is kept.
+        for (auto it = registers.begin(); it != registers.end();)
+            it = it->second.expired() ? registers.erase(it) : std::next(it);
+        registers[canonical] = reg;
+        return (reg);
+    }
+
+    std::vector<jbr::reg::Opened>   Manager::openAll(const std::vector<std::string> &paths, std::size_t threads) noexcept(false)
+    {
+        std::vector<jbr::reg::Opened>   opened(paths.size());
+
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            opened[i].mPath = paths[i];
+            readahead(paths[i]);
+        }
+        {
+            jbr::reg::ThreadPool    pool(threads == 0 ? std::max<std::size_t>(std::thread::hardware_concurrency(), 1) : threads);
+
+            for (jbr::reg::Opened &result : opened)
+                pool.post([&result]() {
+                    try {
+                        result.mRegister = acquire(result.mPath.c_str());
+                    }
+                    catch (std::exception &e) {
+                        result.mError = e.what();
+                    }
+                    catch (...) {
+                        result.mError = "Impossible to open the register '" + result.mPath + "'.";
+                    }
+                });
+        } // The pending openings are run before the pool is stopped.
+        return (opened);
+    }
+
+    std::vector<jbr::reg::Opened>   Manager::preload(const char *manifest, std::size_t threads) noexcept(false)
+    {
+        if (manifest == nullptr || !manifest[0])
+            throw jbr::reg::exception("Impossible to preload the registers from a null or empty manifest path.");
+
+        std::ifstream               ifs(manifest);
+        std::filesystem::path       directory = std::filesystem::path(manifest).parent_path();
+        std::vector<std::string>    paths;
+        std::string                 line;
+
+        if (!ifs.is_open())
+            throw jbr::reg::exception("Impossible to read the registers manifest " + std::string(manifest) + '.');
+        while (std::getline(ifs, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.empty() || line[0] == '#')
+                continue;
+            paths.push_back(std::filesystem::path(line).is_absolute() ? line : (directory / line).string());
+        }
+        return (openAll(paths, threads));
+    }
+
     bool    Manager::exist(const char *path) noexcept
     {
         if (path == nullptr || !path[0])
@@ -42,11 +190,68 @@ namespace jbr::reg
 
     void    Manager::destroy(jbr::Register &reg) noexcept(false)
     {
-        const std::string &regPath = reg->localization();
+        destroy(*reg);
+    }
+
+    void    Manager::destroy(const jbr::SharedRegister &reg) noexcept(false)
+    {
+        auto                        &[registers, mutex] = registry();
+        std::lock_guard<std::mutex> lock(mutex); // Not acquired again while destroyed.
+
+        if (reg.use_count() > 1)
+            throw jbr::reg::exception("The register '" + reg->localization() + "' is shared by other handles. It can't be destroyed while in use.");
+        destroy(*reg);
+        registers.erase(reg->localization());
+    }
+
+    void    Manager::destroy(const jbr::reg::Instance &reg) noexcept(false)
+    {
+        jbr::reg::metric::Timer timer(jbr::reg::metric::Operation::Destroy);
+        const std::string       &regPath = reg.localization();
 
-        if (!reg->isDestroyable())
+        if (!reg.isDestroyable())
             throw jbr::reg::exception("The register '" + regPath + "' is not destroyable. Please check the register rights, read and destroy must be allow.");
+
+        jbr::reg::FileLock  lock(regPath);
+
         std::filesystem::remove(regPath);
+        jbr::reg::BlobStore(regPath).destroy();
+        jbr::reg::ValueIndex(regPath).destroy();
+        jbr::reg::KeyFilter::destroy(regPath);
     }
-    
+
+    jbr::reg::metric::Snapshot  Manager::metrics() noexcept(false)
+    {
+        return (jbr::reg::Metrics::get().snapshot());
+    }
+
+    void    Manager::dumpMetrics(const char *path) noexcept(false)
+    {
+        if (path == nullptr || !path[0])
+            throw jbr::reg::exception("Impossible to dump the metrics into a null or empty path.");
+
+        std::ofstream   ofs(path, std::ios::trunc);
+
+        jbr::reg::Metrics::get().snapshot().prometheus(ofs);
+        if (!ofs.flush())
+            throw jbr::reg::exception("Impossible to dump the metrics into " + std::string(path) + '.');
+    }
+
+    void    Manager::resetMetrics() noexcept
+    {
+        jbr::reg::Metrics::get().reset();
+    }
+
+    void    Manager::startTracing(const char *path) noexcept(false)
+    {
+        if (path == nullptr)
+            throw jbr::reg::exception("Impossible to start the tracing into a null path.");
+        jbr::reg::Tracer::get().start(path);
+    }
+
+    void    Manager::stopTracing() noexcept(false)
+    {
+        jbr::reg::Tracer::get().stop();
+    }
+
 }
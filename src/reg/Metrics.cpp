@@ -0,0 +1,268 @@
+//!
+//! @file Metrics.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Metrics.hpp"
+#include "jbr/reg/Tracer.hpp"
+#include <exception>
+#include <limits>
+
+namespace jbr::reg::metric
+{
+
+    const char  *name(Operation operation) noexcept
+    {
+        static const char   *names[] = { "create", "open", "destroy", "copy", "move", "get", "set", "available", "remove", "update",
+                                         "for_each", "find_keys", "keys_with_value", "purge" };
+
+        return (operation < Operation::Count ? names[static_cast<std::size_t>(operation)] : "unknown");
+    }
+
+    const char  *name(Phase phase) noexcept
+    {
+        static const char   *names[] = { "lock", "io", "parse", "search", "serialize", "chunk_parse" };
+
+        return (phase < Phase::Count ? names[static_cast<std::size_t>(phase)] : "unknown");
+    }
+
+    const char  *name(Cache cache) noexcept
+    {
+        static const char   *names[] = { "key_index", "value_index", "arena", "key_filter", "registry" };
+
+        return (cache < Cache::Count ? names[static_cast<std::size_t>(cache)] : "unknown");
+    }
+
+    std::uint64_t   Histogram::Snapshot::percentile(double percentile) const noexcept
+    {
+        double          rank = percentile / 100.0 * static_cast<double>(mCount);
+        std::uint64_t   seen = 0;
+
+        for (const auto &[highest, count] : mBuckets)
+        {
+            seen += count;
+            if (static_cast<double>(seen) >= rank)
+                return (highest < mMax ? highest : mMax);
+        }
+        return (mMax);
+    }
+
+    Histogram::Histogram() noexcept
+    {
+        reset();
+    }
+
+    void    Histogram::record(std::uint64_t value) noexcept
+    {
+        std::uint64_t   min = mMin.load(std::memory_order_relaxed);
+        std::uint64_t   max = mMax.load(std::memory_order_relaxed);
+
+        mCounts[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        mSum.fetch_add(value, std::memory_order_relaxed);
+        while (value < min && !mMin.compare_exchange_weak(min, value, std::memory_order_relaxed));
+        while (value > max && !mMax.compare_exchange_weak(max, value, std::memory_order_relaxed));
+        mCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void    Histogram::reset() noexcept
+    {
+        for (std::atomic<std::uint64_t> &count : mCounts)
+            count.store(0, std::memory_order_relaxed);
+        mCount.store(0, std::memory_order_relaxed);
+        mSum.store(0, std::memory_order_relaxed);
+        mMin.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        mMax.store(0, std::memory_order_relaxed);
+    }
+
+    Histogram::Snapshot Histogram::snapshot() const noexcept(false)
+    {
+        Snapshot    snapshot;
+
+        for (std::size_t i = 0; i < mBuckets; ++i)
+        {
+            std::uint64_t   count = mCounts[i].load(std::memory_order_relaxed);
+
+            if (count == 0)
+                continue;
+            snapshot.mBuckets.emplace_back(highest(i), count);
+            snapshot.mCount += count;
+        }
+        if (snapshot.mCount == 0)
+            return (snapshot);
+        snapshot.mSum = mSum.load(std::memory_order_relaxed);
+        snapshot.mMin = mMin.load(std::memory_order_relaxed);
+        snapshot.mMax = mMax.load(std::memory_order_relaxed);
+        return (snapshot);
+    }
+
+    std::size_t Histogram::bucket(std::uint64_t value) noexcept
+    {
+        std::size_t exponent = 0;
+
+        if (value < mSubBuckets)
+            return (static_cast<std::size_t>(value));
+        for (std::uint64_t rest = value; rest > 1; rest >>= 1)
+            ++exponent;
+        return ((exponent - mSubBits + 1) * mSubBuckets + static_cast<std::size_t>((value >> (exponent - mSubBits)) & (mSubBuckets - 1)));
+    }
+
+    std::uint64_t   Histogram::highest(std::size_t bucket) noexcept
+    {
+        std::size_t     group = bucket / mSubBuckets;
+        std::uint64_t   width = 0;
+
+        if (group == 0)
+            return (bucket);
+        width = std::uint64_t(1) << (group - 1);
+        return (((mSubBuckets + bucket % mSubBuckets) << (group - 1)) + (width - 1));
+    }
+
+    double  Snapshot::hitRate(Cache cache) const noexcept
+    {
+        std::uint64_t   hits = mHits[static_cast<std::size_t>(cache)];
+        std::uint64_t   total = hits + mMisses[static_cast<std::size_t>(cache)];
+
+        return (total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total));
+    }
+
+    void    Snapshot::prometheus(std::ostream &os) const noexcept(false)
+    {
+        static const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+        auto                summary = [&os](const char *metric, const char *label, const char *value, const Histogram::Snapshot &histogram) {
+            for (double quantile : quantiles)
+                os << metric << '{' << label << "=\"" << value << "\",quantile=\"" << quantile << "\"} "
+                   << static_cast<double>(histogram.percentile(quantile * 100.0)) / 1e9 << '\n';
+            os << metric << "_sum{" << label << "=\"" << value << "\"} " << static_cast<double>(histogram.mSum) / 1e9 << '\n';
+            os << metric << "_count{" << label << "=\"" << value << "\"} " << histogram.mCount << '\n';
+        };
+
+        os << "# HELP cregister_operation_duration_seconds Register operations latencies.\n"
+           << "# TYPE cregister_operation_duration_seconds summary\n";
+        for (std::size_t i = 0; i < mOperations.size(); ++i)
+            summary("cregister_operation_duration_seconds", "operation", name(static_cast<Operation>(i)), mOperations[i]);
+        os << "# HELP cregister_operation_errors_total Register operations failed.\n"
+           << "# TYPE cregister_operation_errors_total counter\n";
+        for (std::size_t i = 0; i < mErrors.size(); ++i)
+            os << "cregister_operation_errors_total{operation=\"" << name(static_cast<Operation>(i)) << "\"} " << mErrors[i] << '\n';
+        os << "# HELP cregister_phase_duration_seconds Register operations phases latencies.\n"
+           << "# TYPE cregister_phase_duration_seconds summary\n";
+        for (std::size_t i = 0; i < mPhases.size(); ++i)
+            summary("cregister_phase_duration_seconds", "phase", name(static_cast<Phase>(i)), mPhases[i]);
+        os << "# HELP cregister_read_bytes_total Register files and blob chunks bytes read.\n"
+           << "# TYPE cregister_read_bytes_total counter\n"
+           << "cregister_read_bytes_total " << mBytesRead << '\n'
+           << "# HELP cregister_written_bytes_total Register files and blob chunks bytes written.\n"
+           << "# TYPE cregister_written_bytes_total counter\n"
+           << "cregister_written_bytes_total " << mBytesWritten << '\n'
+           << "# HELP cregister_cache_hits_total Register caches hits.\n"
+           << "# TYPE cregister_cache_hits_total counter\n";
+        for (std::size_t i = 0; i < mHits.size(); ++i)
+            os << "cregister_cache_hits_total{cache=\"" << name(static_cast<Cache>(i)) << "\"} " << mHits[i] << '\n';
+        os << "# HELP cregister_cache_misses_total Register caches misses.\n"
+           << "# TYPE cregister_cache_misses_total counter\n";
+        for (std::size_t i = 0; i < mMisses.size(); ++i)
+            os << "cregister_cache_misses_total{cache=\"" << name(static_cast<Cache>(i)) << "\"} " << mMisses[i] << '\n';
+    }
+
+    Timer::Timer(Operation operation) noexcept : mStart(std::chrono::steady_clock::now()), mExceptions(std::uncaught_exceptions()),
+                                                 mId(static_cast<std::uint8_t>(operation)), mPhase(false), mFailed(false) {}
+
+    Timer::Timer(Phase phase) noexcept : mStart(std::chrono::steady_clock::now()), mExceptions(std::uncaught_exceptions()),
+                                         mId(static_cast<std::uint8_t>(phase)), mPhase(true), mFailed(false) {}
+
+    Timer::~Timer()
+    {
+        std::chrono::nanoseconds    duration = std::chrono::steady_clock::now() - mStart;
+        bool                        failed = !mPhase && (mFailed || std::uncaught_exceptions() > mExceptions);
+
+        if (mPhase)
+            jbr::reg::Metrics::get().record(static_cast<Phase>(mId), duration);
+        else
+            jbr::reg::Metrics::get().record(static_cast<Operation>(mId), duration, failed);
+#ifndef JBR_REG_NO_TRACING
+        if (jbr::reg::Tracer::get().enabled())
+            jbr::reg::Tracer::get().record(mPhase ? name(static_cast<Phase>(mId)) : name(static_cast<Operation>(mId)),
+                                           mPhase ? "phase" : "operation", mStart, duration, failed);
+#endif
+    }
+
+}
+
+namespace jbr::reg
+{
+
+    Metrics &Metrics::get() noexcept
+    {
+        static Metrics  *metrics = new Metrics(); // Never destroyed, background threads may record during the process exit.
+
+        return (*metrics);
+    }
+
+    Metrics::Metrics() noexcept
+    {
+        reset();
+    }
+
+    void    Metrics::record(jbr::reg::metric::Operation operation, std::chrono::nanoseconds duration, bool failed) noexcept
+    {
+        if (operation >= jbr::reg::metric::Operation::Count)
+            return ;
+        mOperations[static_cast<std::size_t>(operation)].record(static_cast<std::uint64_t>(duration.count() < 0 ? 0 : duration.count()));
+        if (failed)
+            mErrors[static_cast<std::size_t>(operation)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void    Metrics::record(jbr::reg::metric::Phase phase, std::chrono::nanoseconds duration) noexcept
+    {
+        if (phase >= jbr::reg::metric::Phase::Count)
+            return ;
+        mPhases[static_cast<std::size_t>(phase)].record(static_cast<std::uint64_t>(duration.count() < 0 ? 0 : duration.count()));
+    }
+
+    void    Metrics::lookup(jbr::reg::metric::Cache cache, bool hit) noexcept
+    {
+        if (cache >= jbr::reg::metric::Cache::Count)
+            return ;
+        (hit ? mHits : mMisses)[static_cast<std::size_t>(cache)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    jbr::reg::metric::Snapshot  Metrics::snapshot() const noexcept(false)
+    {
+        jbr::reg::metric::Snapshot  snapshot;
+
+        for (std::size_t i = 0; i < mOperations.size(); ++i)
+        {
+            snapshot.mOperations[i] = mOperations[i].snapshot();
+            snapshot.mErrors[i] = mErrors[i].load(std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < mPhases.size(); ++i)
+            snapshot.mPhases[i] = mPhases[i].snapshot();
+        snapshot.mBytesRead = mBytesRead.load(std::memory_order_relaxed);
+        snapshot.mBytesWritten = mBytesWritten.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < mHits.size(); ++i)
+        {
+            snapshot.mHits[i] = mHits[i].load(std::memory_order_relaxed);
+            snapshot.mMisses[i] = mMisses[i].load(std::memory_order_relaxed);
+        }
+        return (snapshot);
+    }
+
+    void    Metrics::reset() noexcept
+    {
+        for (jbr::reg::metric::Histogram &histogram : mOperations)
+            histogram.reset();
+        for (std::atomic<std::uint64_t> &errors : mErrors)
+            errors.store(0, std::memory_order_relaxed);
+        for (jbr::reg::metric::Histogram &histogram : mPhases)
+            histogram.reset();
+        mBytesRead.store(0, std::memory_order_relaxed);
+        mBytesWritten.store(0, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < mHits.size(); ++i)
+        {
+            mHits[i].store(0, std::memory_order_relaxed);
+            mMisses[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+}
@@ -0,0 +1,240 @@
+//!
+//! @file Serializer.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Serializer.hpp"
+#include "jbr/reg/exception.hpp"
+#include <cstring>
+
+namespace jbr::reg
+{
+
+    Serializer::Serializer(std::string path) noexcept(false) : mPath(std::move(path)), mFile(std::fopen(mPath.c_str(), "wb")),
+                                                               mBuffer(nullptr), mUsed(0), mWritten(0), mFailed(false), mProcessEntities(true),
+                                                               mElementJustOpened(false), mFirstElement(true), mDepth(0), mTextDepth(-1)
+    {
+        if (mFile == nullptr)
+            throw jbr::reg::exception("Error while saving the register content, error code : " +
+                                      std::to_string(tinyxml2::XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED) + ".");
+        std::setvbuf(mFile, nullptr, _IONBF, 0); // Each flush is a single write of the whole buffer.
+        mBuffer = std::make_unique<char[]>(mBufferSize);
+    }
+
+    Serializer::~Serializer()
+    {
+        std::fclose(mFile);
+    }
+
+    void    Serializer::serialize(const tinyxml2::XMLDocument &document) noexcept
+    {
+        document.Accept(this);
+    }
+
+    void    Serializer::finish() noexcept(false)
+    {
+        flush();
+        if (mFailed || std::fflush(mFile) != 0)
+            throw jbr::reg::exception("Error while saving the register content into " + mPath + '.');
+    }
+
+    bool    Serializer::VisitEnter(const tinyxml2::XMLDocument &document)
+    {
+        static const char   bom[] = { '\xEF', '\xBB', '\xBF' };
+
+        mProcessEntities = document.ProcessEntities();
+        if (document.HasBOM())
+            write(bom, sizeof(bom));
+        return (!mFailed);
+    }
+
+    bool    Serializer::VisitEnter(const tinyxml2::XMLElement &element, const tinyxml2::XMLAttribute *attribute)
+    {
+        seal();
+        if (mTextDepth < 0 && !mFirstElement)
+            write("\n", 1);
+        for (int depth = 0; depth < mDepth; ++depth)
+            write("    ", 4);
+        write("<", 1);
+        write(element.Name());
+        for (; attribute != nullptr; attribute = attribute->Next())
+        {
+            write(" ", 1);
+            write(attribute->Name());
+            write("=\"", 2);
+            escape(attribute->Value(), true);
+            write("\"", 1);
+        }
+        mElementJustOpened = true;
+        mFirstElement = false;
+        ++mDepth;
+        return (!mFailed);
+    }
+
+    bool    Serializer::VisitExit(const tinyxml2::XMLElement &element)
+    {
+        --mDepth;
+        if (mElementJustOpened)
+            write("/>", 2);
+        else
+        {
+            if (mTextDepth < 0)
+                indent();
+            write("</", 2);
+            write(element.Name());
+            write(">", 1);
+        }
+        if (mTextDepth == mDepth)
+            mTextDepth = -1;
+        if (mDepth == 0)
+            write("\n", 1);
+        mElementJustOpened = false;
+        return (!mFailed);
+    }
+
+    bool    Serializer::Visit(const tinyxml2::XMLText &text)
+    {
+        const char  *raw = nullptr;
+        std::size_t size = 0;
+        bool        parsed = text.RawValue(&raw, &size);
+
+        mTextDepth = mDepth - 1;
+        seal();
+        if (text.CData())
+            write("<![CDATA[", 9);
+        if (parsed)
+            write(raw, size); // Still escaped as parsed.
+        else if (text.CData())
+            write(text.Value());
+        else
+            escape(text.Value(), false);
+        if (text.CData())
+            write("]]>", 3);
+        return (!mFailed);
+    }
+
+    bool    Serializer::Visit(const tinyxml2::XMLComment &comment)
+    {
+        seal();
+        if (mTextDepth < 0 && !mFirstElement)
+            indent();
+        mFirstElement = false;
+        write("<!--", 4);
+        write(comment.Value());
+        write("-->", 3);
+        return (!mFailed);
+    }
+
+    bool    Serializer::Visit(const tinyxml2::XMLDeclaration &declaration)
+    {
+        seal();
+        if (mTextDepth < 0 && !mFirstElement)
+            indent();
+        mFirstElement = false;
+        write("<?", 2);
+        write(declaration.Value());
+        write("?>", 2);
+        return (!mFailed);
+    }
+
+    bool    Serializer::Visit(const tinyxml2::XMLUnknown &unknown)
+    {
+        seal();
+        if (mTextDepth < 0 && !mFirstElement)
+            indent();
+        mFirstElement = false;
+        write("<!", 2);
+        write(unknown.Value());
+        write(">", 1);
+        return (!mFailed);
+    }
+
+    void    Serializer::write(const char *data, std::size_t size) noexcept
+    {
+        if (mFailed)
+            return;
+        if (size > mBufferSize - mUsed)
+        {
+            std::size_t part = mBufferSize - mUsed;
+
+            std::memcpy(mBuffer.get() + mUsed, data, part);
+            mUsed += part;
+            data += part;
+            size -= part;
+            flush();
+            for (; size >= mBufferSize && !mFailed; data += mBufferSize, size -= mBufferSize) // Whole chunks written without copy.
+            {
+                mFailed = std::fwrite(data, 1, mBufferSize, mFile) != mBufferSize;
+                mWritten += mFailed ? 0 : mBufferSize;
+            }
+            if (mFailed)
+                return;
+        }
+        std::memcpy(mBuffer.get() + mUsed, data, size);
+        mUsed += size;
+    }
+
+    void    Serializer::write(const char *data) noexcept
+    {
+        write(data, std::strlen(data));
+    }
+
+    void    Serializer::escape(const char *data, bool attribute) noexcept
+    {
+        const char  *run = data;
+        const char  *c = data;
+
+        if (!mProcessEntities)
+        {
+            write(data);
+            return;
+        }
+        for (; *c; ++c)
+        {
+            const char  *entity = nullptr;
+
+            switch (*c)
+            {
+                case '&': entity = "&amp;"; break;
+                case '<': entity = "&lt;"; break;
+                case '>': entity = "&gt;"; break;
+                case '"': entity = attribute ? "&quot;" : nullptr; break;
+                case '\'': entity = attribute ? "&apos;" : nullptr; break;
+                default: break;
+            }
+            if (entity != nullptr)
+            {
+                write(run, static_cast<std::size_t>(c - run));
+                write(entity);
+                run = c + 1;
+            }
+        }
+        write(run, static_cast<std::size_t>(c - run));
+    }
+
+    void    Serializer::flush() noexcept
+    {
+        if (mFailed || mUsed == 0)
+            return;
+        mFailed = std::fwrite(mBuffer.get(), 1, mUsed, mFile) != mUsed;
+        mWritten += mFailed ? 0 : mUsed;
+        mUsed = 0;
+    }
+
+    void    Serializer::seal() noexcept
+    {
+        if (!mElementJustOpened)
+            return;
+        mElementJustOpened = false;
+        write(">", 1);
+    }
+
+    void    Serializer::indent() noexcept
+    {
+        write("\n", 1);
+        for (int depth = 0; depth < mDepth; ++depth)
+            write("    ", 4);
+    }
+
+}
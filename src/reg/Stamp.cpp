@@ -0,0 +1,42 @@
+//!
+//! @file Stamp.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Stamp.hpp"
+#ifdef _WIN32
+# include <filesystem>
+#else
+# include <sys/stat.h>
+#endif
+
+namespace jbr::reg
+{
+
+    std::string stamp(const std::string &path) noexcept
+    {
+        try {
+#ifdef _WIN32
+            std::error_code err;
+            auto            date = std::filesystem::last_write_time(path, err);
+            auto            size = std::filesystem::file_size(path, err);
+
+            if (err)
+                return ("");
+            return (std::to_string(date.time_since_epoch().count()) + ' ' + std::to_string(size));
+#else
+            struct stat status = {};
+
+            if (stat(path.c_str(), &status) != 0)
+                return ("");
+            return (std::to_string(status.st_dev) + ' ' + std::to_string(status.st_ino) + ' ' + std::to_string(status.st_size) + ' ' +
+                    std::to_string(status.st_mtim.tv_sec) + '.' + std::to_string(status.st_mtim.tv_nsec));
+#endif
+        }
+        catch (...) {
+            return ("");
+        }
+    }
+
+}
@@ -0,0 +1,111 @@
+//!
+//! @file ThreadPool.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/ThreadPool.hpp"
+#include <algorithm>
+
+namespace jbr::reg
+{
+
+    ThreadPool  &ThreadPool::io() noexcept
+    {
+        static ThreadPool   pool(std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, 4));
+
+        return (pool);
+    }
+
+    ThreadPool  &ThreadPool::cpu() noexcept
+    {
+        static ThreadPool   pool(std::max<std::size_t>(std::thread::hardware_concurrency(), 1) - 1);
+
+        return (pool);
+    }
+
+    ThreadPool::ThreadPool(std::size_t threads) noexcept : mNext(0)
+    {
+        try {
+            for (std::size_t i = 0; i < threads; ++i)
+            {
+                auto    worker = std::make_unique<Worker>();
+
+                worker->mThread = std::thread(&ThreadPool::run, std::ref(*worker));
+                mWorkers.push_back(std::move(worker));
+            }
+        }
+        catch (...) {} // Keep the started workers, jobs are run synchronously if none can be started.
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        for (auto &worker : mWorkers)
+        {
+            {
+                std::lock_guard<std::mutex> lock(worker->mMutex);
+
+                worker->mRunning = false;
+            }
+            worker->mCondition.notify_one();
+        }
+        for (auto &worker : mWorkers)
+            worker->mThread.join();
+    }
+
+    void    ThreadPool::post(std::function<void()> &&job) noexcept(false)
+    {
+        post(mNext++, std::move(job));
+    }
+
+    void    ThreadPool::post(std::size_t affinity, std::function<void()> &&job) noexcept(false)
+    {
+        if (mWorkers.empty())
+        {
+            execute(job);
+            return ;
+        }
+
+        Worker  &worker = *mWorkers[affinity % mWorkers.size()];
+
+        {
+            std::lock_guard<std::mutex> lock(worker.mMutex);
+
+            worker.mJobs.push_back(std::move(job));
+        }
+        worker.mCondition.notify_one();
+    }
+
+    bool    ThreadPool::runsOn(std::size_t affinity) const noexcept
+    {
+        return (!mWorkers.empty() && mWorkers[affinity % mWorkers.size()]->mThread.get_id() == std::this_thread::get_id());
+    }
+
+    void    ThreadPool::run(Worker &worker) noexcept
+    {
+        std::unique_lock<std::mutex>    lock(worker.mMutex);
+
+        while (true)
+        {
+            worker.mCondition.wait(lock, [&worker]() { return (!worker.mJobs.empty() || !worker.mRunning); });
+            if (worker.mJobs.empty())
+                return ;
+
+            std::function<void()>   job = std::move(worker.mJobs.front());
+
+            worker.mJobs.pop_front();
+            lock.unlock();
+            execute(job);
+            lock.lock();
+        }
+    }
+
+    void    ThreadPool::execute(std::function<void()> &job) noexcept
+    {
+        try {
+            job();
+        }
+        catch (...) {}
+    }
+
+}
@@ -0,0 +1,108 @@
+//!
+//! @file Tracer.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Tracer.hpp"
+#include "jbr/reg/exception.hpp"
+#include <fstream>
+
+#ifdef _WIN32
+# include <process.h>
+# define getpid _getpid
+#else
+# include <unistd.h>
+#endif
+
+namespace jbr::reg
+{
+
+    Tracer  &Tracer::get() noexcept
+    {
+        static Tracer   *tracer = new Tracer(); // Never destroyed, background threads may record during the process exit.
+
+        return (*tracer);
+    }
+
+    Tracer::Tracer() noexcept : mEnabled(false), mDropped(0) {}
+
+    void    Tracer::start(const std::string &path) noexcept(false)
+    {
+#ifdef JBR_REG_NO_TRACING
+        (void)path;
+        throw jbr::reg::exception("Impossible to start the tracing, the tracing has been disabled at compile time.");
+#else
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (path.empty())
+            throw jbr::reg::exception("Impossible to start the tracing into a empty path.");
+        mPath = path;
+        mEvents.clear();
+        mDropped = 0;
+        mOrigin = std::chrono::steady_clock::now();
+        mEnabled.store(true, std::memory_order_relaxed);
+#endif
+    }
+
+    void    Tracer::stop() noexcept(false)
+    {
+        std::vector<Event>          events;
+        std::string                 path;
+        std::size_t                 dropped = 0;
+        long                        pid = static_cast<long>(getpid());
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (!mEnabled.load(std::memory_order_relaxed))
+                throw jbr::reg::exception("Impossible to stop the tracing, the tracing is not started.");
+            mEnabled.store(false, std::memory_order_relaxed);
+            events.swap(mEvents);
+            path.swap(mPath);
+            dropped = mDropped;
+        }
+
+        std::ofstream   ofs(path, std::ios::trunc);
+
+        ofs << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":" << dropped << "},\"traceEvents\":[";
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            const Event &event = events[i];
+
+            ofs << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << event.mName << "\",\"cat\":\"" << event.mCategory << "\",\"ph\":\"X\",\"ts\":"
+                << event.mStart.count() / 1000 << '.' << std::to_string(1000 + event.mStart.count() % 1000).substr(1) << ",\"dur\":"
+                << event.mDuration.count() / 1000 << '.' << std::to_string(1000 + event.mDuration.count() % 1000).substr(1)
+                << ",\"pid\":" << pid << ",\"tid\":" << event.mThread;
+            if (event.mFailed)
+                ofs << ",\"args\":{\"failed\":true}";
+            ofs << '}';
+        }
+        ofs << "\n]}\n";
+        if (!ofs.flush())
+            throw jbr::reg::exception("Impossible to write the trace file " + path + '.');
+    }
+
+    void    Tracer::record(const char *name, const char *category, std::chrono::steady_clock::time_point start,
+                           std::chrono::nanoseconds duration, bool failed) noexcept
+    {
+        static std::atomic<std::uint32_t>   threads(0);
+        thread_local std::uint32_t          thread = ++threads;
+        std::lock_guard<std::mutex>         lock(mMutex);
+
+        if (!mEnabled.load(std::memory_order_relaxed) || start < mOrigin)
+            return ;
+        if (mEvents.size() >= mMaxEvents)
+        {
+            ++mDropped;
+            return ;
+        }
+        try {
+            mEvents.push_back(Event{ name, category, start - mOrigin, duration, thread, failed });
+        }
+        catch (...) {
+            ++mDropped;
+        }
+    }
+
+}
@@ -0,0 +1,273 @@
+//!
+//! @file ValueIndex.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/ValueIndex.hpp"
+#include "jbr/reg/Stamp.hpp"
+#include "jbr/reg/exception.hpp"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#ifndef _WIN32
+# include <unistd.h>
+#else
+# include <process.h>
+# define getpid _getpid
+#endif
+
+namespace jbr::reg
+{
+
+    static const char   *stampName = "stamp"; //!< Stamp file name, bucket files are named by value hash and size.
+
+    //!
+    //! @brief Escape a key to store it on a single bucket line.
+    //! @param key Variable key.
+    //! @return Escaped key.
+    //!
+    static std::string  escape(const std::string &key) noexcept(false)
+    {
+        std::string escaped;
+
+        escaped.reserve(key.size());
+        for (char c : key)
+        {
+            if (c == '\\')
+                escaped += "\\\\";
+            else if (c == '\n')
+                escaped += "\\n";
+            else if (c == '\t')
+                escaped += "\\t";
+            else
+                escaped += c;
+        }
+        return (escaped);
+    }
+
+    //!
+    //! @brief Unescape a key read from a bucket line.
+    //! @param escaped Escaped key.
+    //! @return Variable key.
+    //!
+    static std::string  unescape(const std::string &escaped) noexcept(false)
+    {
+        std::string key;
+
+        key.reserve(escaped.size());
+        for (std::size_t i = 0; i < escaped.size(); ++i)
+        {
+            if (escaped[i] != '\\' || i + 1 == escaped.size())
+                key += escaped[i];
+            else if (escaped[++i] == 'n')
+                key += '\n';
+            else if (escaped[i] == 't')
+                key += '\t';
+            else
+                key += escaped[i];
+        }
+        return (key);
+    }
+
+    std::uint64_t   ValueIndex::check(const char *data, std::size_t size, std::uint64_t hash) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash = (hash + static_cast<unsigned char>(data[i])) * 0xbf58476d1ce4e5b9ull; // Unlike the bucket hash (FNV-1a).
+            hash ^= hash >> 31;
+        }
+        return (hash);
+    }
+
+    bool    ValueIndex::enabled() const noexcept
+    {
+        std::error_code err;
+
+        return (std::filesystem::is_directory(mDirectory, err));
+    }
+
+    bool    ValueIndex::fresh(bool &readable) const noexcept
+    {
+        std::ifstream   ifs(mDirectory / stampName);
+        std::string     saved;
+        std::string     current = jbr::reg::stamp(mRegister);
+
+        if (!std::getline(ifs, saved) || current.empty() || saved != current || !(ifs >> readable))
+            return (false);
+        return (true);
+    }
+
+    std::vector<ValueIndex::Entry>  ValueIndex::read(const std::string &bucket) const noexcept(false)
+    {
+        std::vector<Entry>  entries;
+        std::ifstream       ifs(mDirectory / bucket);
+        std::string         line;
+
+        while (std::getline(ifs, line))
+        {
+            std::size_t checkSeparator = line.rfind('\t');
+            std::size_t separator = checkSeparator == std::string::npos || checkSeparator == 0 ? std::string::npos : line.rfind('\t', checkSeparator - 1);
+
+            if (separator == std::string::npos)
+                throw jbr::reg::exception("Invalid value index bucket " + (mDirectory / bucket).string() + '.');
+
+            std::string expiration = line.substr(separator + 1, checkSeparator - separator - 1);
+            Entry       entry{ unescape(line.substr(0, separator)), std::nullopt, std::stoull(line.substr(checkSeparator + 1), nullptr, 16) };
+
+            if (expiration != "-")
+                entry.mExpiration = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        std::chrono::milliseconds(std::stoll(expiration))));
+            entries.push_back(std::move(entry));
+        }
+        if (ifs.bad())
+            throw jbr::reg::exception("Impossible to read the value index bucket " + (mDirectory / bucket).string() + '.');
+        return (entries);
+    }
+
+    void    ValueIndex::apply(const Changes &changes, const std::string &registerStamp, bool readable) const noexcept(false)
+    {
+        std::map<std::string, std::vector<Entry>>   buckets;
+
+        for (const Change &change : changes)
+        {
+            for (const std::string *bucket : { &change.mFrom, &change.mTo })
+                if (!bucket->empty() && buckets.count(*bucket) == 0)
+                    buckets[*bucket] = read(*bucket);
+            if (!change.mFrom.empty())
+            {
+                std::vector<Entry>  &entries = buckets[change.mFrom];
+
+                entries.erase(std::remove_if(entries.begin(), entries.end(), [&change](const Entry &entry) { return (entry.mKey == change.mKey); }),
+                              entries.end());
+            }
+            if (!change.mTo.empty())
+            {
+                std::vector<Entry>  &entries = buckets[change.mTo];
+
+                entries.erase(std::remove_if(entries.begin(), entries.end(), [&change](const Entry &entry) { return (entry.mKey == change.mKey); }),
+                              entries.end());
+                entries.push_back(Entry{ change.mKey, change.mExpiration, change.mCheck });
+            }
+        }
+        for (const auto &[bucket, entries] : buckets)
+            write(bucket, entries);
+        stamp(registerStamp, readable);
+    }
+
+    void    ValueIndex::rebuild(const Buckets &buckets, const std::string &registerStamp, bool readable) const noexcept(false)
+    {
+        std::error_code err;
+
+        create();
+        for (std::filesystem::directory_iterator it(mDirectory, err), end; !err && it != end; it.increment(err))
+        {
+            std::error_code removeErr;
+
+            if (buckets.count(it->path().filename().string()) == 0)
+                std::filesystem::remove(it->path(), removeErr);
+        }
+        for (const auto &[bucket, entries] : buckets)
+            write(bucket, entries);
+        stamp(registerStamp, readable);
+    }
+
+    void    ValueIndex::create() const noexcept(false)
+    {
+        std::error_code err;
+
+        std::filesystem::create_directories(mDirectory, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to create the value index directory " + mDirectory.string() + " : " + err.message() + '.');
+    }
+
+    void    ValueIndex::copy(const ValueIndex &target) const noexcept(false)
+    {
+        std::error_code err;
+
+        if (!enabled())
+            return ;
+        std::filesystem::copy(mDirectory, target.mDirectory, std::filesystem::copy_options::recursive, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to copy the value index directory " + mDirectory.string() + " : " + err.message() + '.');
+    }
+
+    void    ValueIndex::move(const ValueIndex &target) const noexcept(false)
+    {
+        std::error_code err;
+
+        if (!enabled())
+            return ;
+        std::filesystem::rename(mDirectory, target.mDirectory, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to move the value index directory " + mDirectory.string() + " : " + err.message() + '.');
+    }
+
+    void    ValueIndex::destroy() const noexcept
+    {
+        std::error_code err;
+
+        std::filesystem::remove_all(mDirectory, err);
+    }
+
+    void    ValueIndex::stamp(const std::string &registerStamp, bool readable) const noexcept(false)
+    {
+        std::filesystem::path   location = temporary(stampName);
+        std::error_code         err;
+
+        {
+            std::ofstream   ofs(location, std::ios::trunc);
+
+            if (!(ofs << registerStamp << '\n' << readable << '\n') || !ofs.flush())
+            {
+                std::filesystem::remove(location, err);
+                throw jbr::reg::exception("Impossible to write the value index stamp " + location.string() + '.');
+            }
+        }
+        std::filesystem::rename(location, mDirectory / stampName, err);
+        if (err)
+            throw jbr::reg::exception("Impossible to write the value index stamp " + location.string() + " : " + err.message() + '.');
+    }
+
+    std::filesystem::path   ValueIndex::temporary(const std::string &name) const noexcept(false)
+    {
+        static std::atomic<std::size_t> counter(0);
+
+        return (mDirectory / (name + '.' + std::to_string(getpid()) + '.' + std::to_string(counter++) + ".tmp"));
+    }
+
+    void    ValueIndex::write(const std::string &bucket, const std::vector<Entry> &entries) const noexcept(false)
+    {
+        std::filesystem::path   location = mDirectory / bucket;
+        std::filesystem::path   replacement = temporary(bucket);
+        std::error_code         err;
+
+        if (entries.empty())
+        {
+            std::filesystem::remove(location, err);
+            return ;
+        }
+        {
+            std::ofstream   ofs(replacement, std::ios::trunc);
+
+            for (const Entry &entry : entries)
+            {
+                ofs << escape(entry.mKey) << '\t';
+                if (entry.mExpiration == std::nullopt)
+                    ofs << '-';
+                else
+                    ofs << std::chrono::duration_cast<std::chrono::milliseconds>(entry.mExpiration.value().time_since_epoch()).count();
+                ofs << '\t' << std::hex << entry.mCheck << std::dec << '\n';
+            }
+            if (!ofs.flush())
+            {
+                std::filesystem::remove(replacement, err);
+                throw jbr::reg::exception("Impossible to write the value index bucket " + replacement.string() + '.');
+            }
+        }
+        std::filesystem::rename(replacement, location, err); // Readers never see a partially written bucket.
+        if (err)
+            throw jbr::reg::exception("Impossible to write the value index bucket " + location.string() + " : " + err.message() + '.');
+    }
+
+}
@@ -0,0 +1,115 @@
+//!
+//! @file ValueStream.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/ValueStream.hpp"
+#include "jbr/reg/Instance.hpp"
+
+namespace jbr::reg
+{
+
+    ValueReader::Buffer::Buffer(jbr::reg::BlobStore &&store, std::vector<std::string> &&chunks, std::string &&value) noexcept :
+        mStore(std::move(store)), mChunks(std::move(chunks)), mNext(0), mCurrent(std::move(value))
+    {
+        setg(mCurrent.data(), mCurrent.data(), mCurrent.data() + mCurrent.size());
+    }
+
+    ValueReader::Buffer::int_type   ValueReader::Buffer::underflow()
+    {
+        while (gptr() == egptr())
+        {
+            if (mNext >= mChunks.size())
+                return (traits_type::eof());
+            mCurrent = mStore.read(mChunks[mNext++]);
+            setg(mCurrent.data(), mCurrent.data(), mCurrent.data() + mCurrent.size());
+        }
+        return (traits_type::to_int_type(*gptr()));
+    }
+
+    ValueReader::ValueReader(jbr::reg::BlobStore &&store, std::vector<std::string> &&chunks, std::string &&value, std::size_t size) noexcept :
+        std::istream(nullptr), mBuffer(std::move(store), std::move(chunks), std::move(value)), mSize(size)
+    {
+        rdbuf(&mBuffer);
+    }
+
+    ValueWriter::Buffer::Buffer(jbr::reg::BlobStore &&store) noexcept(false) :
+        mStore(std::move(store)), mData(jbr::reg::BlobStore::mChunkSize), mSize(0)
+    {
+        setp(mData.data(), mData.data() + mData.size());
+    }
+
+    void    ValueWriter::Buffer::stage() noexcept(false)
+    {
+        std::size_t size = static_cast<std::size_t>(pptr() - pbase());
+
+        if (size == 0)
+            return ;
+
+        std::string             chunk = jbr::reg::BlobStore::identify(pbase(), size);
+        std::filesystem::path   pending = mStore.stage(pbase(), size);
+
+        try {
+            mStaged.emplace_back(std::move(chunk), pending);
+        }
+        catch (...) {
+            mStore.discard(pending);
+            throw;
+        }
+        mSize += size;
+        setp(mData.data(), mData.data() + mData.size());
+    }
+
+    void    ValueWriter::Buffer::release() noexcept
+    {
+        mStaged.clear();
+        mSize = 0;
+        setp(mData.data(), mData.data() + mData.size());
+    }
+
+    void    ValueWriter::Buffer::discard() noexcept
+    {
+        for (const auto &staged : mStaged)
+            mStore.discard(staged.second);
+        mStaged.clear();
+    }
+
+    ValueWriter::Buffer::int_type   ValueWriter::Buffer::overflow(int_type character)
+    {
+        try {
+            stage();
+        }
+        catch (...) {
+            return (traits_type::eof());
+        }
+        if (traits_type::eq_int_type(character, traits_type::eof()))
+            return (traits_type::not_eof(character));
+        *pptr() = traits_type::to_char_type(character);
+        pbump(1);
+        return (character);
+    }
+
+    ValueWriter::ValueWriter(const jbr::reg::Instance &instance, std::string &&key) noexcept(false) :
+        std::ostream(nullptr), mInstance(instance), mKey(std::move(key)), mBuffer(jbr::reg::BlobStore(instance.localization()))
+    {
+        rdbuf(&mBuffer);
+    }
+
+    void    ValueWriter::commit() noexcept(false)
+    {
+        std::string pending = mBuffer.pending();
+
+        if (bad())
+            throw jbr::reg::exception("Impossible to commit the variable '" + mKey + "', the blob chunks can't be written.");
+        if (mBuffer.staged().empty() && pending.size() <= mInstance.blobThreshold() && pending.find('\0') == std::string::npos)
+            mInstance.modify(mKey.c_str(), [&pending](const char *) { return (std::optional<std::string>(pending)); });
+        else
+        {
+            mBuffer.stage();
+            mInstance.writeBlob(mKey.c_str(), mBuffer.staged(), mBuffer.size());
+        }
+        mBuffer.release();
+    }
+
+}
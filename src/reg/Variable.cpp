@@ -9,7 +9,8 @@
 namespace jbr::reg
 {
 
-    Variable::Variable(std::string &&name, std::string &&value, const std::optional<jbr::reg::var::perm::Rights> &rights) : mValue(value)
+    Variable::Variable(std::string &&name, std::string &&value, const std::optional<jbr::reg::var::perm::Rights> &rights,
+                       const std::optional<std::chrono::system_clock::time_point> &expiration) : mValue(value), mExpiration(expiration)
     {
         if (name.empty())
             throw jbr::reg::exception("Impossible to set a empty register variable.");
@@ -55,4 +56,11 @@ namespace jbr::reg
         mRights = rights;
     }
 
+    void        Variable::expireAt(const std::optional<std::chrono::system_clock::time_point> &expiration) noexcept(false)
+    {
+        if (!isUpdatable())
+            throw jbr::reg::exception("Impossible to set the expiration of a register variable, the 'write' and 'update' rights must be set to true.");
+        mExpiration = expiration;
+    }
+
 }
@@ -0,0 +1,291 @@
+//!
+//! @file Watcher.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include "jbr/reg/Watcher.hpp"
+#include "jbr/reg/Instance.hpp"
+#include "jbr/reg/Arena.hpp"
+#include "jbr/reg/BlobStore.hpp"
+#include "jbr/reg/node/Name.hpp"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#ifdef __linux__
+# include <sys/inotify.h>
+# include <poll.h>
+# include <unistd.h>
+#endif
+
+namespace jbr::reg
+{
+
+    Watcher &Watcher::get() noexcept
+    {
+        static Watcher  watcher;
+
+        return (watcher);
+    }
+
+    Watcher::Watcher() noexcept : mNextId(1), mNotifier(-1), mRunning(false)
+    {
+#ifdef __linux__
+        mNotifier = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    Watcher::~Watcher()
+    {
+        mRunning = false;
+        if (mThread.joinable())
+            mThread.join();
+#ifdef __linux__
+        if (mNotifier >= 0)
+            close(mNotifier);
+#endif
+    }
+
+    jbr::reg::WatchId   Watcher::subscribe(const std::string &path, std::optional<std::string> &&key, jbr::reg::WatchCallback &&callback) noexcept(false)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (!callback)
+            throw jbr::reg::exception("Impossible to watch the register '" + path + "' without callback.");
+        attach(path);
+        mSubscriptions.emplace(mNextId, Subscription{ path, std::move(key), std::move(callback) });
+        if (!mThread.joinable())
+        {
+            mRunning = true;
+            mThread = std::thread(&Watcher::run, this);
+        }
+        return (mNextId++);
+    }
+
+    void    Watcher::unsubscribe(jbr::reg::WatchId id) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto                        subscription = mSubscriptions.find(id);
+
+        if (subscription == mSubscriptions.end())
+            return ;
+        detach(subscription->second.mPath);
+        mSubscriptions.erase(subscription);
+    }
+
+    void    Watcher::relocate(jbr::reg::WatchId id, const std::string &path) noexcept(false)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto                        subscription = mSubscriptions.find(id);
+
+        if (subscription == mSubscriptions.end() || subscription->second.mPath == path)
+            return ;
+        attach(path);
+        detach(subscription->second.mPath);
+        subscription->second.mPath = path;
+    }
+
+    void    Watcher::attach(const std::string &path) noexcept(false)
+    {
+        auto            target = mTargets.find(path);
+        std::error_code err;
+
+        if (target != mTargets.end())
+        {
+            ++target->second.mSubscribers;
+            return ;
+        }
+
+        std::filesystem::path   file = std::filesystem::weakly_canonical(path, err); // Saves replace the target of a link.
+
+        if (err || file.empty())
+            file = path;
+
+        Target  newTarget{ load(path), std::filesystem::last_write_time(path, err), -1, file.filename().string(), 1 };
+
+#ifdef __linux__
+        if (mNotifier >= 0)
+        {
+            std::filesystem::path   directory = file.parent_path();
+
+            newTarget.mDirectory = inotify_add_watch(mNotifier, directory.empty() ? "." : directory.c_str(),
+                                                     IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE);
+            if (newTarget.mDirectory >= 0)
+                ++mDirectories[newTarget.mDirectory];
+        }
+#endif
+        mTargets.emplace(path, std::move(newTarget));
+    }
+
+    void    Watcher::detach(const std::string &path) noexcept
+    {
+        auto    target = mTargets.find(path);
+
+        if (target == mTargets.end() || --target->second.mSubscribers > 0)
+            return ;
+#ifdef __linux__
+        if (target->second.mDirectory >= 0 && --mDirectories[target->second.mDirectory] == 0)
+        {
+            inotify_rm_watch(mNotifier, target->second.mDirectory);
+            mDirectories.erase(target->second.mDirectory);
+        }
+#endif
+        mTargets.erase(target);
+    }
+
+    void    Watcher::run() noexcept
+    {
+        while (mRunning)
+            for (const std::string &path : poll())
+                refresh(path);
+    }
+
+    std::set<std::string>   Watcher::poll() noexcept
+    {
+        std::set<std::pair<int, std::string>>   events;
+        std::set<std::string>                   updated;
+        std::error_code                         err;
+
+#ifdef __linux__
+        if (mNotifier >= 0)
+        {
+            struct pollfd   descriptor = { mNotifier, POLLIN, 0 };
+
+            if (::poll(&descriptor, 1, 100) > 0)
+            {
+                alignas(struct inotify_event) char  buffer[4096];
+                ssize_t                             size;
+
+                while ((size = read(mNotifier, buffer, sizeof(buffer))) > 0)
+                    for (char *it = buffer; it < buffer + size; it += sizeof(struct inotify_event) + reinterpret_cast<struct inotify_event *>(it)->len)
+                    {
+                        const struct inotify_event  *event = reinterpret_cast<struct inotify_event *>(it);
+
+                        if (event->len > 0)
+                            events.emplace(event->wd, event->name);
+                    }
+            }
+        }
+        else
+#endif
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (const auto &[path, target] : mTargets)
+            if (target.mDirectory >= 0 ? events.count({ target.mDirectory, target.mFileName }) > 0
+                                       : std::filesystem::last_write_time(path, err) != target.mStamp)
+                updated.insert(path);
+        return (updated);
+    }
+
+    void    Watcher::refresh(const std::string &path) noexcept
+    {
+        std::vector<std::pair<std::string, std::optional<jbr::reg::Variable>>>      changes;
+        std::vector<std::pair<std::string, std::optional<Entry>>>                   changed;
+        std::vector<std::pair<std::optional<std::string>, jbr::reg::WatchCallback>> subscribers;
+        std::error_code                                                             err;
+        Body                                                                        body;
+
+        try {
+            body = load(path);
+        }
+        catch (...) {
+            if (std::filesystem::exists(path, err))
+                return ; // Register partially written or corrupted, wait for the next update.
+        }
+        try {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto                        target = mTargets.find(path);
+
+            if (target == mTargets.end())
+                return ;
+
+            auto    previous = target->second.mBody.begin();
+            auto    current = body.begin();
+
+            while (previous != target->second.mBody.end() || current != body.end())
+                if (current == body.end() || (previous != target->second.mBody.end() && previous->first < current->first))
+                    changed.emplace_back((previous++)->first, std::nullopt);
+                else if (previous == target->second.mBody.end() || current->first < previous->first ||
+                         current->second.mValue != previous->second.mValue || current->second.mChunks != previous->second.mChunks ||
+                         !(current->second.mRights == previous->second.mRights))
+                {
+                    if (previous != target->second.mBody.end() && previous->first == current->first)
+                        ++previous;
+                    changed.emplace_back(current->first, current->second);
+                    ++current;
+                }
+                else
+                {
+                    ++previous;
+                    ++current;
+                }
+            target->second.mBody = std::move(body);
+            target->second.mStamp = std::filesystem::last_write_time(path, err);
+            for (const auto &[id, subscription] : mSubscriptions)
+                if (subscription.mPath == path)
+                    subscribers.emplace_back(subscription.mKey, subscription.mCallback);
+        }
+        catch (...) {
+            return ;
+        }
+        for (const auto &[key, entry] : changed)
+        {
+            bool    watched = std::any_of(subscribers.begin(), subscribers.end(), [&key = key](const auto &subscriber) {
+                return (subscriber.first == std::nullopt || subscriber.first.value() == key);
+            });
+
+            try {
+                if (watched) // Only the changed values watched are read, from their chunks if stored out of line.
+                    changes.emplace_back(key, entry == std::nullopt ? std::nullopt
+                                                                    : std::optional<jbr::reg::Variable>(jbr::reg::Variable(std::string(key), readValue(path, entry.value()), entry->mRights)));
+            }
+            catch (...) {} // Value replaced meanwhile, notified on the next update.
+        }
+        for (const auto &[key, variable] : changes)
+            for (const auto &[watchedKey, callback] : subscribers)
+                if (watchedKey == std::nullopt || watchedKey.value() == key)
+                {
+                    try {
+                        callback(key.c_str(), variable);
+                    }
+                    catch (...) {}
+                }
+    }
+
+    Watcher::Body   Watcher::load(const std::string &path) noexcept(false)
+    {
+        jbr::reg::Instance      reg{std::string(path)};
+        jbr::reg::Arena::Lease  lease;
+        tinyxml2::XMLDocument   &xmlDocument = *lease;
+        Body                    body;
+
+        for (tinyxml2::XMLElement *variableElement = reg.getBodyXMLElement(xmlDocument)->FirstChildElement(); variableElement != nullptr;
+             variableElement = variableElement->NextSiblingElement())
+        {
+            const char  *key = reg.getSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::key)->GetText();
+
+            const tinyxml2::XMLElement  *blobNode = reg.findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::blob);
+            std::size_t                 size = 0;
+
+            if (key != nullptr)
+                body[key] = Entry{ blobNode == nullptr ? reg.readValue(variableElement) : std::string(),
+                                   blobNode == nullptr ? std::vector<std::string>() : reg.getBlobChunksFromNode(blobNode, size),
+                                   reg.getVariableRightsFromNode(reg.findSubXMLElement(variableElement, jbr::reg::node::name::_body::_variable::rights)) };
+        }
+        return (body);
+    }
+
+    std::string Watcher::readValue(const std::string &path, const Entry &entry) noexcept(false)
+    {
+        jbr::reg::BlobStore store(path);
+        std::string         value = entry.mValue;
+
+        for (const std::string &chunk : entry.mChunks)
+            value += store.read(chunk);
+        return (value);
+    }
+
+}
@@ -0,0 +1,89 @@
+//!
+//! @file Lease_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Arena.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Arena::Lease")
+{
+    static const char   xml[] = "<register><header/><body><variable><key>key</key><value>value</value></variable></body></register>";
+
+    SUBCASE("Documents reused with their memory.")
+    {
+        tinyxml2::XMLDocument   *document = nullptr;
+
+        jbr::reg::Arena::release();
+        {
+            jbr::reg::Arena::Lease  lease;
+
+            document = &*lease;
+            REQUIRE(lease->Parse(xml) == tinyxml2::XML_SUCCESS);
+        }
+        {
+            jbr::reg::Arena::Lease  lease;
+
+            CHECK(&*lease == document);
+            CHECK(lease->FirstChild() == nullptr);
+            CHECK(lease->PoolBytes() > 0);
+            CHECK(lease->CharBufferBytes() > sizeof(xml));
+            REQUIRE(lease->Parse(xml) == tinyxml2::XML_SUCCESS);
+            CHECK(std::string(lease->FirstChildElement("register")->FirstChildElement("body")->FirstChildElement("variable")
+                                   ->FirstChildElement("value")->GetText()) == "value");
+        }
+        jbr::reg::Arena::release();
+    }
+
+    SUBCASE("Lease without raising.")
+    {
+        jbr::reg::Arena::Lease  lease(std::nothrow);
+
+        REQUIRE(lease);
+        CHECK(lease->Parse(xml) == tinyxml2::XML_SUCCESS);
+    }
+
+    SUBCASE("Nested leases.")
+    {
+        jbr::reg::Arena::Lease  outer;
+        jbr::reg::Arena::Lease  inner;
+
+        CHECK(&*outer != &*inner);
+
+        jbr::Register   reg = jbr::reg::Manager::create("./arena_nested.reg");
+        std::size_t     found = 0;
+
+        for (int i = 0; i < 10; ++i)
+            reg->set(jbr::reg::Variable("variable " + std::to_string(i), std::to_string(i)));
+        CHECK(reg->forEach([&reg, &found](const jbr::reg::VariableView &variable) {
+            found += std::string(reg->get(std::string(variable.mKey).c_str()).read()) == variable.mValue;
+            return (true);
+        }) == 10);
+        CHECK(found == 10);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Configured block size and retention.")
+    {
+        jbr::reg::Arena::release();
+        jbr::reg::Arena::configure(64 * 1024, 0);
+        {
+            jbr::reg::Arena::Lease  lease;
+
+            REQUIRE(lease->Parse(xml) == tinyxml2::XML_SUCCESS);
+            CHECK(lease->PoolBytes() > 60 * 1024);
+        }
+        {
+            jbr::reg::Arena::Lease  lease;
+
+            CHECK(lease->PoolBytes() == 0);
+            CHECK(lease->CharBufferBytes() == 0);
+        }
+        jbr::reg::Arena::configure(jbr::reg::Arena::mDefaultBlockSize, jbr::reg::Arena::mDefaultMaxRetained);
+        jbr::reg::Arena::release();
+    }
+
+}
@@ -0,0 +1,44 @@
+//!
+//! @file schedule_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Expirer.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <chrono>
+#include <thread>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Expirer::schedule")
+{
+
+    SUBCASE("Same expiration scheduled once.")
+    {
+        jbr::reg::Expirer                       &expirer = jbr::reg::Expirer::get();
+        std::chrono::system_clock::time_point   expiration = std::chrono::system_clock::now() + std::chrono::hours(1);
+        std::size_t                             scheduled = expirer.scheduled();
+
+        expirer.schedule("./expirer_schedule_once.reg", "key", expiration);
+        expirer.schedule("./expirer_schedule_once.reg", "key", expiration);
+        CHECK(expirer.scheduled() == scheduled + 1);
+        expirer.schedule("./expirer_schedule_once.reg", "other", expiration);
+        expirer.schedule("./expirer_schedule_once.reg", "key", expiration + std::chrono::hours(1));
+        CHECK(expirer.scheduled() == scheduled + 3);
+    }
+
+    SUBCASE("Expired variable read again not scheduled again.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./expirer_read_expired.reg");
+        std::size_t     scheduled = jbr::reg::Expirer::get().scheduled();
+
+        reg->set(jbr::reg::Variable("lease", "node 1", std::nullopt, std::chrono::system_clock::now() + std::chrono::milliseconds(1)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        for (std::size_t i = 0; i < 10; ++i)
+            CHECK_FALSE(reg->available("lease"));
+        CHECK(jbr::reg::Expirer::get().scheduled() <= scheduled + 1);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
@@ -0,0 +1,72 @@
+//!
+//! @file record_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Metrics.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::metric::Histogram::record")
+{
+
+    SUBCASE("Empty histogram.")
+    {
+        jbr::reg::metric::Histogram             histogram;
+        jbr::reg::metric::Histogram::Snapshot   snapshot = histogram.snapshot();
+
+        CHECK(snapshot.mCount == 0);
+        CHECK(snapshot.mBuckets.empty());
+        CHECK(snapshot.percentile(50) == 0);
+        CHECK(snapshot.mean() == 0.0);
+    }
+
+    SUBCASE("Exact small values.")
+    {
+        jbr::reg::metric::Histogram histogram;
+
+        for (std::uint64_t value = 0; value < 16; ++value)
+            histogram.record(value);
+
+        jbr::reg::metric::Histogram::Snapshot   snapshot = histogram.snapshot();
+
+        CHECK(snapshot.mCount == 16);
+        CHECK(snapshot.mMin == 0);
+        CHECK(snapshot.mMax == 15);
+        CHECK(snapshot.mBuckets.size() == 16);
+        CHECK(snapshot.percentile(50) == 7);
+        CHECK(snapshot.percentile(100) == 15);
+    }
+
+    SUBCASE("Bounded relative error.")
+    {
+        jbr::reg::metric::Histogram histogram;
+
+        for (std::uint64_t value = 1; value <= 10000; ++value)
+            histogram.record(value * 1000);
+
+        jbr::reg::metric::Histogram::Snapshot   snapshot = histogram.snapshot();
+
+        CHECK(snapshot.mCount == 10000);
+        CHECK(snapshot.mSum == 50005000ull * 1000);
+        CHECK(snapshot.mMin == 1000);
+        CHECK(snapshot.mMax == 10000000);
+        CHECK(snapshot.percentile(50) >= 5000000);
+        CHECK(snapshot.percentile(50) <= 5000000 + 5000000 / 16);
+        CHECK(snapshot.percentile(99) >= 9900000);
+        CHECK(snapshot.percentile(99) <= 9900000 + 9900000 / 16);
+        CHECK(snapshot.percentile(100) == 10000000);
+    }
+
+    SUBCASE("Largest values.")
+    {
+        jbr::reg::metric::Histogram histogram;
+
+        histogram.record(~std::uint64_t(0));
+        CHECK(histogram.snapshot().mMax == ~std::uint64_t(0));
+        CHECK(histogram.snapshot().percentile(50) == ~std::uint64_t(0));
+        histogram.reset();
+        CHECK(histogram.snapshot().mCount == 0);
+    }
+
+}
@@ -0,0 +1,74 @@
+//!
+//! @file asyncGet_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::asyncGet")
+{
+
+    SUBCASE("Basic asynchronous get.")
+    {
+        jbr::Register                           reg = jbr::reg::Manager::create("./basic_async_get.reg");
+
+        reg->set(jbr::reg::Variable("basic_async_get", "value"));
+
+        jbr::reg::Operation<jbr::reg::Variable> operation = reg->asyncGet("basic_async_get");
+        jbr::reg::Variable                      variable = operation.get();
+
+        CHECK(operation.ready());
+        CHECK(std::string(variable.key()) == "basic_async_get");
+        CHECK(std::string(variable.read()) == "value");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Asynchronous get after asynchronous set.")
+    {
+        jbr::Register                           reg = jbr::reg::Manager::create("./async_get_after_set.reg");
+
+        (void)reg->asyncSet(jbr::reg::Variable("first", "1"));
+        (void)reg->asyncSet(jbr::reg::Variable("first", "2"));
+
+        jbr::reg::Operation<jbr::reg::Variable> operation = reg->asyncGet("first");
+
+        CHECK(std::string(operation.get().read()) == "2");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("No existing variable.")
+    {
+        jbr::Register                           reg = jbr::reg::Manager::create("./async_get_no_exist_var.reg");
+        jbr::reg::Operation<jbr::reg::Variable> operation = reg->asyncGet("no_exist");
+        std::string                             msg;
+
+        try {
+            (void)operation.get();
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "No variable named 'no_exist' were found into the register './async_get_no_exist_var.reg'.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Null pointer.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./async_get_null_ptr.reg");
+        std::string     msg;
+
+        try {
+            (void)reg->asyncGet(nullptr);
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to extract a null or empty variable.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
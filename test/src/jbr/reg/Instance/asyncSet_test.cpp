@@ -0,0 +1,82 @@
+//!
+//! @file asyncSet_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::asyncSet")
+{
+
+    SUBCASE("Multiple asynchronous set then flush.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./multiple_async_set.reg");
+
+        for (int i = 0; i < 20; ++i)
+            (void)reg->asyncSet(jbr::reg::Variable("var " + std::to_string(i), std::to_string(i)));
+        reg->asyncFlush().get();
+        for (int i = 0; i < 20; ++i)
+            CHECK(std::string(reg->get(("var " + std::to_string(i)).c_str()).read()) == std::to_string(i));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Asynchronous set without replace.")
+    {
+        jbr::Register               reg = jbr::reg::Manager::create("./async_set_no_replace.reg");
+        jbr::reg::Operation<void>   operation;
+        std::string                 msg;
+
+        reg->set(jbr::reg::Variable("var", "value"));
+        operation = reg->asyncSet(jbr::reg::Variable("var", "new value"), false);
+        try {
+            operation.get();
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Cannot replace the already existing variable 'new value' from ./async_set_no_replace.reg register.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Pending operations completed on destruction.")
+    {
+        {
+            jbr::Register   reg = jbr::reg::Manager::create("./async_set_destruction.reg");
+
+            (void)reg->asyncSet(jbr::reg::Variable("var", "value"));
+        }
+
+        jbr::Register   reg = jbr::reg::Manager::open("./async_set_destruction.reg");
+
+        CHECK(std::string(reg->get("var").read()) == "value");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Asynchronous operations on a moved register.")
+    {
+        {
+            jbr::Register   reg = jbr::reg::Manager::create("./async_set_moved.reg");
+
+            for (int i = 0; i < 10; ++i)
+                (void)reg->asyncSet(jbr::reg::Variable("var " + std::to_string(i), std::to_string(i)));
+            reg->asyncFlush().get();
+            (void)reg->asyncSet(jbr::reg::Variable("pending", "value"));
+            reg->move("./async_set_moved_to.reg");
+            (void)reg->asyncSet(jbr::reg::Variable("moved", "value"));
+            CHECK(std::string(reg->asyncGet("moved").get().read()) == "value");
+            CHECK(std::string(reg->asyncGet("var 9").get().read()) == "9");
+        }
+
+        jbr::Register   reg = jbr::reg::Manager::open("./async_set_moved_to.reg");
+
+        CHECK_FALSE(jbr::reg::Manager::exist("./async_set_moved.reg"));
+        CHECK(std::string(reg->get("moved").read()) == "value");
+        CHECK(std::string(reg->get("pending").read()) == "value");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
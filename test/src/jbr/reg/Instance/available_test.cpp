@@ -8,7 +8,9 @@
 #include <jbr/reg/Variable.hpp>
 #include <jbr/reg/exception.hpp>
 #include <doctest.h>
+#include <filesystem>
 #include <fstream>
+#include <thread>
 
 TEST_CASE("jbr::reg::Instance::available")
 {
@@ -143,4 +145,57 @@ TEST_CASE("jbr::reg::Instance::available")
         jbr::reg::Manager::destroy(reg);
     }
 
+    SUBCASE("Missing keys answered by the key filter.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./key_filter.reg");
+        auto            index = static_cast<std::size_t>(jbr::reg::metric::Cache::KeyFilter);
+
+        reg->set(jbr::reg::Variable("first", "1"));
+        jbr::reg::Manager::resetMetrics();
+        CHECK_FALSE(reg->available(jbr::reg::Variable("missing", std::string())));
+        CHECK_FALSE(reg->available(jbr::reg::Variable("other", std::string())));
+        reg->set(jbr::reg::Variable("second", "2"));
+        CHECK(reg->available(jbr::reg::Variable("second", std::string())));
+        CHECK(reg->available(jbr::reg::Variable("first", std::string())));
+        CHECK(jbr::reg::Manager::metrics().mMisses[index] == 1);
+        CHECK(jbr::reg::Manager::metrics().mHits[index] == 3);
+        CHECK_FALSE(reg->hasKeyFilter());
+        reg->enableKeyFilter();
+        CHECK(reg->hasKeyFilter());
+        CHECK(std::filesystem::exists("./key_filter.reg.filter"));
+        reg->set(jbr::reg::Variable("third", "3"));
+        CHECK(reg->available(jbr::reg::Variable("third", std::string())));
+        CHECK_FALSE(reg->available(jbr::reg::Variable("fourth", std::string())));
+        reg->disableKeyFilter();
+        CHECK_FALSE(reg->hasKeyFilter());
+        reg->enableKeyFilter();
+        jbr::reg::Manager::destroy(reg);
+        CHECK_FALSE(std::filesystem::exists("./key_filter.reg.filter"));
+    }
+
+    SUBCASE("Keys set concurrently kept by the key filter.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./key_filter_concurrent.reg");
+        std::size_t     missing = 0;
+
+        reg->set(jbr::reg::Variable("first", "1"));
+        CHECK_FALSE(reg->available(jbr::reg::Variable("missing", std::string())));
+
+        std::thread     writer([&reg]() {
+            for (std::size_t i = 0; i < 40; ++i)
+                reg->set(jbr::reg::Variable("writer " + std::to_string(i), "1"));
+        });
+
+        for (std::size_t i = 0; i < 40; ++i)
+            reg->set(jbr::reg::Variable("main " + std::to_string(i), "1"));
+        writer.join();
+        for (std::size_t i = 0; i < 40; ++i)
+        {
+            missing += !reg->available(jbr::reg::Variable("writer " + std::to_string(i), std::string()));
+            missing += !reg->available(jbr::reg::Variable("main " + std::to_string(i), std::string()));
+        }
+        CHECK(missing == 0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
 }
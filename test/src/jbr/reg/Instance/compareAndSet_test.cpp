@@ -0,0 +1,45 @@
+//!
+//! @file compareAndSet_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::compareAndSet")
+{
+
+    SUBCASE("Swap on expected values only.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./basic_compare_and_set.reg");
+
+        reg->set(jbr::reg::Variable("state", "idle"));
+        CHECK(reg->compareAndSet("state", "idle", "running"));
+        CHECK_FALSE(reg->compareAndSet("state", "idle", "stopped"));
+        CHECK(std::string(reg->get("state").read()) == "running");
+        CHECK_FALSE(reg->compareAndSet("missing", "", "value"));
+        CHECK_FALSE(reg->find("missing").has_value());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Swap without update right.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./compare_and_set_no_right.reg");
+        std::string     msg;
+
+        reg->set(jbr::reg::Variable("state", "idle", jbr::reg::var::perm::Rights(true, true, false, true, true, true)));
+        try {
+            (void)reg->compareAndSet("state", "idle", "running");
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to update a variable without read, write and update rights.");
+        CHECK_THROWS_AS((void)reg->compareAndSet("state", nullptr, "running"), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
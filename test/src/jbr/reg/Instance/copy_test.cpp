@@ -169,4 +169,46 @@ TEST_CASE("jbr::reg::Instance::copy")
         std::filesystem::remove("./copy_without_copy_right.reg");
     }
 
+    SUBCASE("Copy a large register, rights read from its header.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./copy_large.reg");
+        jbr::Register       denied = jbr::reg::Manager::create("./copy_large_denied.reg",
+                                                               jbr::reg::perm::Rights(true, true, true, false, true, true));
+        std::string         msg;
+
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            reg->set(jbr::reg::Variable("large " + std::to_string(i), std::string(60000, static_cast<char>('a' + i))));
+            denied->set(jbr::reg::Variable("large " + std::to_string(i), std::string(60000, static_cast<char>('a' + i))));
+        }
+        REQUIRE(std::filesystem::file_size("./copy_large.reg") > 256 * 1024);
+        jbr::reg::Manager::resetMetrics();
+        reg->copy("./copy_large_copied.reg");
+
+        jbr::reg::metric::Snapshot  metrics = jbr::reg::Manager::metrics();
+
+        CHECK(metrics.mBytesRead >= std::filesystem::file_size("./copy_large.reg"));
+#ifdef __linux__
+        CHECK(metrics.mBytesWritten == 0); // Copied by the kernel.
+#endif
+
+        jbr::Register       copied = jbr::reg::Manager::open("./copy_large_copied.reg");
+        std::ifstream       source("./copy_large.reg", std::ios::binary);
+        std::ifstream       target("./copy_large_copied.reg", std::ios::binary);
+
+        CHECK(std::string(std::istreambuf_iterator<char>(source), {}) == std::string(std::istreambuf_iterator<char>(target), {}));
+        CHECK(std::string(copied->get("large 4").read()) == std::string(60000, 'e'));
+        try {
+            denied->copy("./copy_large_denied_copied.reg");
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to copy the register './copy_large_denied.reg' without copy and read right.");
+        CHECK_FALSE(jbr::reg::Manager::exist("./copy_large_denied_copied.reg"));
+        jbr::reg::Manager::destroy(reg);
+        jbr::reg::Manager::destroy(copied);
+        jbr::reg::Manager::destroy(denied);
+    }
+
 }
@@ -0,0 +1,119 @@
+//!
+//! @file expiration_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <fstream>
+#include <thread>
+#include <doctest.h>
+
+//!
+//! @brief Read a register file content.
+//! @param path Register location.
+//! @return File content.
+//!
+static std::string  readRegisterFile(const char *path)
+{
+    std::ifstream   ifs(path);
+
+    return (std::string((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>())));
+}
+
+TEST_CASE("jbr::reg::Instance expiration")
+{
+
+    SUBCASE("Expiration persisted with the variable.")
+    {
+        jbr::Register                           reg = jbr::reg::Manager::create("./expiration_persisted.reg");
+        jbr::reg::Variable                      lease("lease", "owner");
+        std::chrono::system_clock::time_point   date(std::chrono::milliseconds(4102444800000));
+
+        lease.expireAt(date);
+        reg->set(lease);
+        CHECK(readRegisterFile("./expiration_persisted.reg").find("<expiration>4102444800000</expiration>") != std::string::npos);
+        CHECK(reg->get("lease").expiration() == date);
+        CHECK(reg->find("lease")->expiration() == date);
+        reg->set(jbr::reg::Variable("lease", "owner"));
+        CHECK(readRegisterFile("./expiration_persisted.reg").find("<expiration>") == std::string::npos);
+        CHECK(reg->get("lease").expiration() == std::nullopt);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Expired variables are not available anymore.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./expiration_lazy.reg");
+        jbr::reg::Variable  lease("lease", "owner");
+        std::string         msg;
+
+        lease.expireIn(std::chrono::milliseconds(200));
+        reg->set(lease);
+        reg->set(jbr::reg::Variable("persistent", "value"));
+        CHECK(reg->available("lease"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        CHECK_FALSE(reg->available("lease"));
+        CHECK_FALSE(reg->find("lease").has_value());
+        try {
+            (void)reg->get("lease");
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "No variable named 'lease' were found into the register './expiration_lazy.reg'.");
+        CHECK(reg->available("persistent"));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Expired variables set again as absent ones.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./expiration_set.reg");
+        jbr::reg::Variable  lease("lease", "holder-1");
+
+        lease.expireIn(std::chrono::milliseconds(30));
+        reg->set(lease);
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        CHECK_FALSE(reg->available("lease"));
+        CHECK_NOTHROW(reg->set(jbr::reg::Variable("lease", "holder-2"), false));
+        CHECK(reg->get("lease").read() == std::string("holder-2"));
+        CHECK(reg->get("lease").expiration() == std::nullopt);
+        CHECK_THROWS_AS(reg->set(jbr::reg::Variable("lease", "holder-3"), false), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Expired variables are purged.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./expiration_purge.reg");
+
+        for (int i = 0; i < 10; ++i)
+        {
+            jbr::reg::Variable  lease("lease " + std::to_string(i), "owner");
+
+            lease.expireIn(std::chrono::milliseconds(100));
+            reg->set(lease);
+        }
+        reg->set(jbr::reg::Variable("persistent", "value"));
+        for (int i = 0; i < 50 && readRegisterFile("./expiration_purge.reg").find("lease") != std::string::npos; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        CHECK(readRegisterFile("./expiration_purge.reg").find("lease") == std::string::npos);
+        CHECK(reg->available("persistent"));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Renewed variables are not purged.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./expiration_renewed.reg");
+        jbr::reg::Variable  lease("lease", "owner");
+
+        lease.expireIn(std::chrono::milliseconds(100));
+        reg->set(lease);
+        lease.expireIn(std::chrono::hours(1));
+        reg->set(lease);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        CHECK(reg->available("lease"));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
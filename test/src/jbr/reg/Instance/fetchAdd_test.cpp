@@ -0,0 +1,38 @@
+//!
+//! @file fetchAdd_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::fetchAdd")
+{
+
+    SUBCASE("Fetch previous values.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./basic_fetch_add.reg");
+
+        reg->set(jbr::reg::Variable("counter", "10"));
+        CHECK(reg->fetchAdd("counter", 5) == 10);
+        CHECK(reg->fetchAdd("counter", -20) == 15);
+        CHECK(reg->fetchAdd("missing", 2) == 0);
+        CHECK(std::string(reg->get("counter").read()) == "-5");
+        CHECK(std::string(reg->get("missing").read()) == "2");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Fetch on underflow.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./fetch_add_underflow.reg");
+
+        reg->set(jbr::reg::Variable("min", std::to_string(std::numeric_limits<std::int64_t>::min())));
+        CHECK_THROWS_AS(reg->fetchAdd("min", -1), jbr::reg::exception);
+        CHECK(reg->fetchAdd("min", 1) == std::numeric_limits<std::int64_t>::min());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
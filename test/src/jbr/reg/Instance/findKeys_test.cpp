@@ -0,0 +1,168 @@
+//!
+//! @file findKeys_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/FileLock.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <chrono>
+#include <thread>
+#include <doctest.h>
+
+static std::vector<std::string> sortedKeys(const jbr::Register &reg, const char *pattern, jbr::reg::Pattern syntax = jbr::reg::Pattern::Glob)
+{
+    std::vector<std::string>    keys = reg->findKeys(pattern, syntax);
+
+    std::sort(keys.begin(), keys.end());
+    return (keys);
+}
+
+//!
+//! @brief Create a register larger than the parallel parsing threshold : variables "variable.N", "lease.owner" and "lease.term" expired.
+//! @param path Register location.
+//! @param count Number of variables.
+//! @param comment Tell if a comment is added into the body.
+//! @return Created register.
+//!
+static jbr::Register largeRegister(const char *path, std::size_t count, bool comment)
+{
+    jbr::Register   reg = jbr::reg::Manager::create(path);
+    std::string     content;
+    std::string     out;
+
+    reg->set(jbr::reg::Variable("lease.owner", "node 1"));
+    reg->set(jbr::reg::Variable("lease.term", "3", std::nullopt, std::chrono::system_clock::now() + std::chrono::milliseconds(1)));
+    reg->set(jbr::reg::Variable("@KEY@", std::string(200, 'v')));
+
+    jbr::reg::FileLock  lock(path); // The expired variable purge rewrites the register meanwhile.
+
+    {
+        std::ifstream   ifs(path, std::ios::binary);
+
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    std::size_t begin = content.rfind('\n', content.find("<variable>")) + 1;
+    std::size_t end = content.find('\n', content.find("</variable>")) + 1;
+    std::string block = content.substr(begin, end - begin);
+    std::size_t marker = block.find("@KEY@");
+
+    out = content.substr(0, begin);
+    for (std::size_t i = 0; i < count; ++i)
+        out += block.substr(0, marker) + "variable." + std::to_string(i) + block.substr(marker + 5);
+    if (comment)
+        out += "<!-- comment -->\n";
+    out += content.substr(end);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << out;
+    return (reg);
+}
+
+TEST_CASE("jbr::reg::Instance::findKeys")
+{
+
+    SUBCASE("Find keys with glob patterns.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_keys_glob.reg");
+
+        reg->set(jbr::reg::Variable("service.http.port", "80"));
+        reg->set(jbr::reg::Variable("service.http.host", "localhost"));
+        reg->set(jbr::reg::Variable("service.smtp.port", "25"));
+        reg->set(jbr::reg::Variable("user.42.name", "jbr"));
+        reg->set(jbr::reg::Variable("user.7.name", "guest"));
+        reg->set(jbr::reg::Variable("literal*star", "1"));
+        CHECK(sortedKeys(reg, "service.*.port") == std::vector<std::string>{ "service.http.port", "service.smtp.port" });
+        CHECK(sortedKeys(reg, "service.http.*") == std::vector<std::string>{ "service.http.host", "service.http.port" });
+        CHECK(sortedKeys(reg, "user.?.name") == std::vector<std::string>{ "user.7.name" });
+        CHECK(sortedKeys(reg, "user.[0-9][0-9].name") == std::vector<std::string>{ "user.42.name" });
+        CHECK(sortedKeys(reg, "user.[!4]*") == std::vector<std::string>{ "user.7.name" });
+        CHECK(sortedKeys(reg, "literal\\*star") == std::vector<std::string>{ "literal*star" });
+        CHECK(reg->findKeys("*").size() == 6);
+        CHECK(reg->findKeys("service").empty());
+        CHECK(reg->findKeys("unknown.*").empty());
+        CHECK_THROWS_AS((void)reg->findKeys(nullptr), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Find keys with regular expressions.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_keys_regex.reg");
+
+        reg->set(jbr::reg::Variable("service.http.port", "80"));
+        reg->set(jbr::reg::Variable("service.smtp.port", "25"));
+        reg->set(jbr::reg::Variable("user.42.name", "jbr"));
+        reg->set(jbr::reg::Variable("user.7.name", "guest"));
+        reg->set(jbr::reg::Variable("ABCDE", "escaped"));
+        CHECK(sortedKeys(reg, "\\x41BCD", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "ABCDE" });
+        CHECK(sortedKeys(reg, "\\u0041BCD", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "ABCDE" });
+        CHECK(sortedKeys(reg, "A\\x42CDE", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "ABCDE" });
+        CHECK(sortedKeys(reg, "user\\.\\d\\d\\.name", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "user.42.name" });
+        CHECK(sortedKeys(reg, "port$", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "service.http.port", "service.smtp.port" });
+        CHECK(sortedKeys(reg, "^user\\.\\d+\\.name$", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "user.42.name", "user.7.name" });
+        CHECK(sortedKeys(reg, "https?\\.port", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "service.http.port" });
+        CHECK(sortedKeys(reg, "smtp|42", jbr::reg::Pattern::Regex) == std::vector<std::string>{ "service.smtp.port", "user.42.name" });
+        CHECK(reg->findKeys("(http|user)\\.", jbr::reg::Pattern::Regex).size() == 3);
+        CHECK_THROWS_AS((void)reg->findKeys("user.(", jbr::reg::Pattern::Regex), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Index refreshed on register changes.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_keys_refresh.reg");
+
+        reg->set(jbr::reg::Variable("node.1.address", "10.0.0.1"));
+        CHECK(sortedKeys(reg, "node.*") == std::vector<std::string>{ "node.1.address" });
+        reg->set(jbr::reg::Variable("node.2.address", "10.0.0.2"));
+        CHECK(sortedKeys(reg, "node.*") == std::vector<std::string>{ "node.1.address", "node.2.address" });
+        reg->remove("node.1.address");
+        CHECK(sortedKeys(reg, "node.*") == std::vector<std::string>{ "node.2.address" });
+        jbr::reg::Manager::destroy(reg);
+        CHECK_THROWS_AS((void)reg->findKeys("node.*"), jbr::reg::exception);
+    }
+
+    SUBCASE("Large registers parsed in parallel, or serially if unusual.")
+    {
+        for (bool comment : { false, true })
+        {
+            jbr::Register               reg = largeRegister("./find_keys_large.reg", 30000, comment);
+
+            jbr::reg::Manager::resetMetrics();
+
+            std::vector<std::string>    keys = reg->findKeys("variable.*");
+            std::uint64_t               chunks = jbr::reg::Manager::metrics().phase(jbr::reg::metric::Phase::ChunkParse).mCount;
+
+            REQUIRE(std::filesystem::file_size("./find_keys_large.reg") > jbr::reg::Instance::mParallelParseThreshold);
+            if (comment)
+                CHECK(chunks == 0);
+            else
+                CHECK(chunks > 1);
+            REQUIRE(keys.size() == 30000);
+            CHECK(keys.front() == "variable.0");
+            CHECK(keys.back() == "variable.29999");
+            CHECK(std::is_sorted(keys.begin(), keys.end(), [](const std::string &lhs, const std::string &rhs) {
+                return (std::stoul(lhs.substr(9)) < std::stoul(rhs.substr(9)));
+            }));
+            CHECK(sortedKeys(reg, "variable.1234?").size() == 10);
+            CHECK(sortedKeys(reg, "lease.*") == std::vector<std::string>{ "lease.owner" });
+            jbr::reg::Manager::destroy(reg);
+        }
+    }
+
+    SUBCASE("Expired variables excluded.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_keys_expired.reg");
+
+        reg->set(jbr::reg::Variable("lease.owner", "node 1", std::nullopt, std::chrono::system_clock::now() + std::chrono::milliseconds(50)));
+        reg->set(jbr::reg::Variable("lease.term", "3"));
+        CHECK(reg->findKeys("lease.*").size() == 2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+        CHECK(sortedKeys(reg, "lease.*") == std::vector<std::string>{ "lease.term" });
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
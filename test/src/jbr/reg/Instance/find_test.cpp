@@ -0,0 +1,52 @@
+//!
+//! @file find_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <fstream>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::find")
+{
+
+    SUBCASE("Find existing variables.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./basic_find.reg");
+
+        reg->set(jbr::reg::Variable("first variable", "some data"));
+        reg->set(jbr::reg::Variable("second one", "OK"));
+        reg->set(jbr::reg::Variable("var", ""));
+        REQUIRE(reg->find("first variable").has_value());
+        CHECK(std::string(reg->find("first variable")->read()) == "some data");
+        CHECK(std::string(reg->find("second one")->read()) == "OK");
+        CHECK(std::string(reg->find("var")->read()) == "");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Find missing variables.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_missing.reg");
+
+        reg->set(jbr::reg::Variable("var", "value"));
+        CHECK_FALSE(reg->find("no_exist").has_value());
+        CHECK_FALSE(reg->find(nullptr).has_value());
+        CHECK_FALSE(reg->find("").has_value());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Invalid register.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./find_invalid.reg");
+        std::ofstream   regInvalid("./find_invalid.reg");
+
+        regInvalid << "spdokpod \n <jdspssjd>><<<>>dofkdf\n";
+        regInvalid.close();
+        CHECK_FALSE(reg->find("var").has_value());
+        std::filesystem::remove("./find_invalid.reg");
+    }
+
+}
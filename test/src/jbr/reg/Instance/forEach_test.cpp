@@ -0,0 +1,80 @@
+//!
+//! @file forEach_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::forEach")
+{
+
+    SUBCASE("Visit all variables.")
+    {
+        jbr::Register                                       reg = jbr::reg::Manager::create("./basic_for_each.reg");
+        std::vector<std::pair<std::string, std::string>>    visited;
+
+        reg->set(jbr::reg::Variable("first", "1"));
+        reg->set(jbr::reg::Variable("second", "2", jbr::reg::var::perm::Rights(true, false, false, false, false, false)));
+        reg->set(jbr::reg::Variable("empty", ""));
+        CHECK(reg->forEach([&visited](const jbr::reg::VariableView &variable) {
+            visited.emplace_back(variable.mKey, variable.mValue);
+            if (variable.mKey == "second")
+                CHECK_FALSE(variable.mRights.mWrite);
+            return (true);
+        }) == 3);
+        REQUIRE(visited.size() == 3);
+        CHECK(visited[0] == std::make_pair(std::string("empty"), std::string("")));
+        CHECK(visited[1] == std::make_pair(std::string("second"), std::string("2")));
+        CHECK(visited[2] == std::make_pair(std::string("first"), std::string("1")));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Stop the iteration.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./for_each_stop.reg");
+        std::size_t     calls = 0;
+
+        for (int i = 0; i < 10; ++i)
+            reg->set(jbr::reg::Variable("var " + std::to_string(i), std::to_string(i)));
+        CHECK(reg->forEach([&calls](const jbr::reg::VariableView &variable) {
+            ++calls;
+            return (variable.mKey != "var 7");
+        }) == 3);
+        CHECK(calls == 3);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Skip expired variables and load blobs.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./for_each_expired.reg");
+        jbr::reg::Variable  lease("lease", "owner");
+        std::string         blob(100 * 1024, 'b');
+        std::size_t         blobSize = 0;
+
+        lease.expireIn(std::chrono::milliseconds(50));
+        reg->set(lease);
+        reg->set(jbr::reg::Variable("blob", std::string(blob)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        CHECK(reg->forEach([&blobSize](const jbr::reg::VariableView &variable) {
+            CHECK(variable.mKey != "lease");
+            blobSize = variable.mValue.size();
+            return (true);
+        }) == 1);
+        CHECK(blobSize == blob.size());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Not existing register.")
+    {
+        jbr::reg::Instance  reg("./for_each_not_existing.reg");
+
+        CHECK_THROWS_AS(reg.forEach([](const jbr::reg::VariableView &) { return (true); }), jbr::reg::exception);
+    }
+
+}
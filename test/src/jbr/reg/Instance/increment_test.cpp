@@ -0,0 +1,85 @@
+//!
+//! @file increment_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::increment")
+{
+
+    SUBCASE("Increment existing and missing variables.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./basic_increment.reg");
+
+        reg->set(jbr::reg::Variable("counter", "41"));
+        reg->set(jbr::reg::Variable("empty", ""));
+        CHECK(reg->increment("counter") == 42);
+        CHECK(reg->increment("counter", -50) == -8);
+        CHECK(reg->increment("empty", 3) == 3);
+        CHECK(reg->increment("missing", 7) == 7);
+        CHECK(std::string(reg->get("counter").read()) == "-8");
+        CHECK(std::string(reg->get("missing").read()) == "7");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Increment invalid values.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./increment_invalid.reg");
+        std::string     msg;
+
+        reg->set(jbr::reg::Variable("text", "12abc"));
+        reg->set(jbr::reg::Variable("max", std::to_string(std::numeric_limits<std::int64_t>::max())));
+        try {
+            reg->increment("text");
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to increment the variable 'text' from ./increment_invalid.reg register, value '12abc' is not a integer.");
+        CHECK_THROWS_AS(reg->increment("max"), jbr::reg::exception);
+        CHECK(std::string(reg->get("text").read()) == "12abc");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Increment without update right.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./increment_no_right.reg");
+        std::string     msg;
+
+        reg->set(jbr::reg::Variable("counter", "1", jbr::reg::var::perm::Rights(true, true, false, true, true, true)));
+        try {
+            reg->increment("counter");
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to update a variable without read, write and update rights.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Concurrent increments are not lost.")
+    {
+        jbr::Register               reg = jbr::reg::Manager::create("./concurrent_increment.reg");
+        std::vector<std::thread>    threads;
+
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back([]() {
+                jbr::Register   local = jbr::reg::Manager::open("./concurrent_increment.reg");
+
+                for (int j = 0; j < 25; ++j)
+                    local->increment("counter");
+            });
+        for (std::thread &thread : threads)
+            thread.join();
+        CHECK(std::string(reg->get("counter").read()) == "100");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
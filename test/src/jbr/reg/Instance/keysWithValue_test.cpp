@@ -0,0 +1,155 @@
+//!
+//! @file keysWithValue_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/BlobStore.hpp>
+#include <jbr/reg/ValueIndex.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <doctest.h>
+
+static std::vector<std::string> sortedKeys(const jbr::Register &reg, const char *value)
+{
+    std::vector<std::string>    keys = reg->keysWithValue(value);
+
+    std::sort(keys.begin(), keys.end());
+    return (keys);
+}
+
+TEST_CASE("jbr::reg::Instance::keysWithValue")
+{
+
+    SUBCASE("Search without index.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./keys_with_value_scan.reg");
+
+        reg->set(jbr::reg::Variable("host 1", "shard 7"));
+        reg->set(jbr::reg::Variable("host 2", "shard 3"));
+        reg->set(jbr::reg::Variable("host 3", "shard 7"));
+        CHECK_FALSE(reg->hasValueIndex());
+        CHECK(sortedKeys(reg, "shard 7") == std::vector<std::string>{ "host 1", "host 3" });
+        CHECK(sortedKeys(reg, "shard 9").empty());
+        CHECK_THROWS_AS((void)reg->keysWithValue(nullptr), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Index maintained on changes.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./keys_with_value_index.reg");
+
+        reg->set(jbr::reg::Variable("host 1", "shard 7"));
+        reg->enableValueIndex();
+        CHECK(reg->hasValueIndex());
+        reg->set(jbr::reg::Variable("host 2", "shard 7"));
+        reg->set(jbr::reg::Variable("host 3", "shard 3"));
+        reg->set(jbr::reg::Variable("counter\nwith\tescapes", "41"));
+        CHECK(sortedKeys(reg, "shard 7") == std::vector<std::string>{ "host 1", "host 2" });
+        reg->set(jbr::reg::Variable("host 1", "shard 3"));
+        reg->remove("host 2");
+        CHECK(sortedKeys(reg, "shard 7").empty());
+        CHECK(sortedKeys(reg, "shard 3") == std::vector<std::string>{ "host 1", "host 3" });
+        (void)reg->increment("counter\nwith\tescapes");
+        CHECK(sortedKeys(reg, "42") == std::vector<std::string>{ "counter\nwith\tescapes" });
+        CHECK(sortedKeys(reg, "41").empty());
+        reg->set(jbr::reg::Variable("replica", "shard 3"));
+        reg->set(jbr::reg::Variable("blob", std::string(100 * 1024, 'b')));
+        CHECK(sortedKeys(reg, std::string(100 * 1024, 'b').c_str()) == std::vector<std::string>{ "blob" });
+        reg->move("./keys_with_value_moved.reg");
+        CHECK(std::filesystem::is_directory("./keys_with_value_moved.reg.index"));
+        CHECK(sortedKeys(reg, "shard 3") == std::vector<std::string>{ "host 1", "host 3", "replica" });
+        jbr::reg::Manager::destroy(reg);
+        CHECK_FALSE(std::filesystem::exists("./keys_with_value_moved.reg.index"));
+    }
+
+    SUBCASE("Index rebuilt after a external change.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./keys_with_value_external.reg");
+        std::string     content;
+
+        reg->enableValueIndex();
+        reg->set(jbr::reg::Variable("host 1", "shard 7"));
+        CHECK(sortedKeys(reg, "shard 7") == std::vector<std::string>{ "host 1" });
+        {
+            std::ifstream   ifs("./keys_with_value_external.reg");
+
+            content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        content.replace(content.find("shard 7"), 7, "shard 8");
+        {
+            std::ofstream   ofs("./keys_with_value_external.reg", std::ios::trunc);
+
+            ofs << content << "\n";
+        }
+        CHECK(sortedKeys(reg, "shard 7").empty());
+        CHECK(sortedKeys(reg, "shard 8") == std::vector<std::string>{ "host 1" });
+        reg->disableValueIndex();
+        CHECK_FALSE(reg->hasValueIndex());
+        CHECK(sortedKeys(reg, "shard 8") == std::vector<std::string>{ "host 1" });
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Values of a same hash told apart.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./keys_with_value_collision.reg");
+        const char      *collision = "shard 9";
+
+        reg->enableValueIndex();
+        reg->set(jbr::reg::Variable("host 1", "shard 7"));
+        {
+            std::ofstream   ofs("./keys_with_value_collision.reg.index/" + jbr::reg::BlobStore::identify(collision, std::strlen(collision)),
+                                std::ios::trunc); // As if "shard 7" and "shard 9" had the same hash.
+
+            ofs << "host 1\t-\t" << std::hex << jbr::reg::ValueIndex::check("shard 7", 7) << '\n';
+        }
+        CHECK(sortedKeys(reg, collision).empty());
+        CHECK(sortedKeys(reg, "shard 7") == std::vector<std::string>{ "host 1" });
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Buckets read while they are replaced.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./keys_with_value_concurrent.reg");
+        std::atomic<bool>   stop{false};
+        std::size_t         failures = 0;
+        std::atomic<bool>   written{true};
+
+        reg->enableValueIndex();
+        for (std::size_t i = 0; i < 200; ++i)
+            reg->set(jbr::reg::Variable("host " + std::to_string(i), "shard 7"));
+
+        std::thread         writer([&reg, &stop, &written]() {
+            try {
+                for (std::size_t i = 0; !stop; ++i)
+                    reg->set(jbr::reg::Variable("host " + std::to_string(i % 200), "shard 7"));
+            }
+            catch (const jbr::reg::exception &) {
+                written = false;
+            }
+        });
+
+        for (std::size_t i = 0; i < 50; ++i)
+        {
+            try {
+                failures += reg->keysWithValue("shard 7").size() != 200;
+            }
+            catch (const jbr::reg::exception &) {
+                ++failures;
+            }
+        }
+        stop = true;
+        writer.join();
+        CHECK(written);
+        CHECK(failures == 0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
@@ -0,0 +1,77 @@
+//!
+//! @file memoryUsage_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::memoryUsage")
+{
+
+    SUBCASE("Memory by category.")
+    {
+        jbr::Register           reg = jbr::reg::Manager::create("./memory_usage.reg");
+        jbr::reg::MemoryUsage   empty = reg->memoryUsage();
+
+        CHECK(empty.mCount == 0);
+        CHECK(empty.mVariables == 0);
+        CHECK(empty.mFile == 0);
+        CHECK(empty.mStrings > std::filesystem::file_size("./memory_usage.reg"));
+        CHECK(empty.mPools > 0);
+        for (int i = 0; i < 200; ++i)
+            reg->set(jbr::reg::Variable("variable " + std::to_string(i), std::string(100, 'v')));
+
+        jbr::reg::MemoryUsage   usage = reg->memoryUsage();
+
+        CHECK(usage.mCount == 200);
+        CHECK(usage.mStrings > std::filesystem::file_size("./memory_usage.reg"));
+        CHECK(usage.mPools > empty.mPools);
+        CHECK(usage.mVariables >= 200 * (sizeof(jbr::reg::Variable) + 101));
+        CHECK(usage.loaded() == usage.mPools + usage.mStrings + usage.mFile);
+        CHECK(usage.total() == usage.loaded() + usage.mVariables);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Values stored out of line.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./memory_usage_blob.reg");
+
+        reg->setBlobThreshold(64);
+        reg->set(jbr::reg::Variable("blob", std::string(10000, 'b')));
+
+        jbr::reg::MemoryUsage   usage = reg->memoryUsage();
+
+        CHECK(usage.mCount == 1);
+        CHECK(usage.mFile < 10000);
+        CHECK(usage.mVariables >= sizeof(jbr::reg::Variable) + 10001);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Large register mapped.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./memory_usage_mapped.reg");
+
+        reg->setBlobThreshold(jbr::reg::Instance::mMapThreshold * 2);
+        reg->set(jbr::reg::Variable("large", std::string(jbr::reg::Instance::mMapThreshold, 'l')));
+
+        jbr::reg::MemoryUsage   usage = reg->memoryUsage();
+
+        CHECK(usage.mFile == std::filesystem::file_size("./memory_usage_mapped.reg"));
+        CHECK(usage.mStrings == 0);
+        CHECK(std::string(reg->get("large").read()) == std::string(jbr::reg::Instance::mMapThreshold, 'l'));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Not existing register.")
+    {
+        jbr::reg::Instance  reg("./memory_usage_not_existing.reg");
+
+        CHECK_THROWS_AS((void)reg.memoryUsage(), jbr::reg::exception);
+    }
+
+}
@@ -0,0 +1,164 @@
+//!
+//! @file openValueStream_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <doctest.h>
+
+static std::size_t  countChunks(const std::string &directory)
+{
+    std::error_code err;
+    std::size_t     chunks = 0;
+
+    for (std::filesystem::directory_iterator it(directory, err), end; !err && it != end; it.increment(err))
+        ++chunks;
+    return (chunks);
+}
+
+TEST_CASE("jbr::reg::Instance::openValueStream")
+{
+
+    SUBCASE("Large values stored out of line.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_out_of_line.reg");
+        std::string     value(200 * 1024, 'x');
+        std::string     content;
+
+        value[1234] = 'y';
+        reg->set(jbr::reg::Variable("blob", std::string(value)));
+        reg->set(jbr::reg::Variable("small", "inline"));
+
+        std::ifstream   ifs("./blob_out_of_line.reg");
+
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        CHECK(content.find("xxxxxxxx") == std::string::npos);
+        CHECK(content.find("<size>204800</size>") != std::string::npos);
+        CHECK(countChunks("./blob_out_of_line.reg.blobs") == 3);
+        CHECK(std::string(reg->get("blob").read()) == value);
+        CHECK(std::string(reg->find("blob")->read()) == value);
+        CHECK(std::string(reg->get("small").read()) == "inline");
+        jbr::reg::Manager::destroy(reg);
+        CHECK_FALSE(std::filesystem::exists("./blob_out_of_line.reg.blobs"));
+    }
+
+    SUBCASE("Read values chunk by chunk.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_stream_read.reg");
+        std::string     value;
+        std::string     read;
+        char            buffer[1000];
+
+        for (int i = 0; i < 30000; ++i)
+            value += std::to_string(i);
+        reg->set(jbr::reg::Variable("blob", std::string(value)));
+        reg->set(jbr::reg::Variable("small", "inline"));
+        {
+            jbr::reg::ValueReader   reader = reg->openValueStream("blob");
+
+            CHECK(reader.size() == value.size());
+            while (reader.read(buffer, sizeof(buffer)) || reader.gcount() > 0)
+                read.append(buffer, static_cast<std::size_t>(reader.gcount()));
+        }
+        CHECK(read == value);
+        {
+            jbr::reg::ValueReader   reader = reg->openValueStream("small");
+            std::string             small;
+
+            reader >> small;
+            CHECK(reader.size() == 6);
+            CHECK(small == "inline");
+        }
+        CHECK_THROWS_AS((void)reg->openValueStream("no_exist"), jbr::reg::exception);
+        CHECK_THROWS_AS((void)reg->openValueStream(nullptr), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Chunks collected, copied and moved with the register.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_collect.reg");
+
+        reg->setBlobThreshold(16);
+        reg->setBlobCollectDelay(std::chrono::seconds(0));
+        reg->set(jbr::reg::Variable("first", "a value larger than the threshold"));
+        reg->set(jbr::reg::Variable("second", "a value larger than the threshold"));
+        CHECK(countChunks("./blob_collect.reg.blobs") == 1);
+        reg->remove("first");
+        CHECK(countChunks("./blob_collect.reg.blobs") == 1);
+        reg->copy("./blob_collect_copy.reg");
+        reg->set(jbr::reg::Variable("second", "small"));
+        CHECK(countChunks("./blob_collect.reg.blobs") == 0);
+        reg->move("./blob_collect_moved.reg");
+        CHECK_FALSE(std::filesystem::exists("./blob_collect.reg.blobs"));
+        jbr::reg::Manager::destroy(reg);
+
+        jbr::Register   copy = jbr::reg::Manager::open("./blob_collect_copy.reg");
+
+        CHECK(std::string(copy->get("second").read()) == "a value larger than the threshold");
+        jbr::reg::Manager::destroy(copy);
+    }
+
+    SUBCASE("Chunks of a replaced value kept for its readers.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_replaced.reg");
+        std::string     first(100, 'a');
+        std::string     read;
+
+        reg->setBlobThreshold(16);
+        reg->set(jbr::reg::Variable("blob", std::string(first)));
+        {
+            jbr::reg::ValueReader   reader = reg->openValueStream("blob");
+
+            reg->set(jbr::reg::Variable("blob", std::string(100, 'b')));
+            CHECK(countChunks("./blob_replaced.reg.blobs") == 3);
+            reader >> read;
+        }
+        CHECK(read == first);
+        reg->setBlobCollectDelay(std::chrono::seconds(0));
+        reg->set(jbr::reg::Variable("blob", std::string(100, 'b')));
+        CHECK(countChunks("./blob_replaced.reg.blobs") == 1);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Values read while they are replaced.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./blob_concurrent.reg");
+        jbr::Register       reader = jbr::reg::Manager::open("./blob_concurrent.reg");
+        std::string         values[2] = { std::string(100 * 1024, 'a'), std::string(100 * 1024, 'b') };
+        std::atomic<bool>   writing(true);
+        std::size_t         failures = 0;
+        std::size_t         reads = 0;
+
+        reg->set(jbr::reg::Variable("blob", std::string(values[0])));
+
+        std::thread         writer([&reg, &values, &writing]() {
+            for (std::size_t i = 1; i < 40; ++i)
+                reg->set(jbr::reg::Variable("blob", std::string(values[i % 2])));
+            writing = false;
+        });
+
+        while (writing || reads == 0)
+        {
+            try {
+                std::string value = reader->get("blob").read();
+
+                failures += value == values[0] || value == values[1] ? 0 : 1;
+            }
+            catch (const jbr::reg::exception &) {
+                ++failures;
+            }
+            ++reads;
+        }
+        writer.join();
+        CHECK(failures == 0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
@@ -9,6 +9,9 @@
 #include <jbr/reg/exception.hpp>
 #include <doctest.h>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 TEST_CASE("jbr::reg::Instance::set")
 {
@@ -370,4 +373,72 @@ TEST_CASE("jbr::reg::Instance::set")
         jbr::reg::Manager::destroy(reg);
     }
 
+#ifndef _WIN32
+    SUBCASE("Links, mode and owner of the register kept.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./set_link_target.reg");
+
+        std::filesystem::create_symlink("set_link_target.reg", "./set_link.reg");
+        std::filesystem::permissions("./set_link_target.reg", std::filesystem::perms::owner_read | std::filesystem::perms::owner_write |
+                                                              std::filesystem::perms::group_read);
+        {
+            jbr::Register           link = jbr::reg::Manager::open("./set_link.reg");
+            std::mutex              mutex;
+            std::condition_variable condition;
+            bool                    notified = false;
+            jbr::reg::WatchId       id = link->watch("through link", [&](const char *, const std::optional<jbr::reg::Variable> &) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                notified = true;
+                condition.notify_all();
+            });
+
+            link->set(jbr::reg::Variable("through link", "value"));
+
+            std::unique_lock<std::mutex>    lock(mutex);
+
+            CHECK(condition.wait_for(lock, std::chrono::seconds(5), [&notified]() { return (notified); }));
+            lock.unlock();
+            link->unwatch(id);
+        }
+        CHECK(std::filesystem::is_symlink("./set_link.reg"));
+        CHECK(std::filesystem::status("./set_link_target.reg").permissions() ==
+              (std::filesystem::perms::owner_read | std::filesystem::perms::owner_write | std::filesystem::perms::group_read));
+        CHECK(std::string(reg->get("through link").read()) == "value");
+        std::filesystem::remove("./set_link.reg");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Hard linked register read while it is saved.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./set_hard_linked.reg");
+        std::atomic<bool>   stop{false};
+        std::size_t         reads = 0;
+        std::size_t         failures = 0;
+
+        reg->setBlobThreshold(1024 * 1024);
+        reg->set(jbr::reg::Variable("large", std::string(360 * 1024, 'l')));
+        std::filesystem::create_hard_link("./set_hard_linked.reg", "./set_hard_linked_other.reg");
+        REQUIRE(std::filesystem::file_size("./set_hard_linked.reg") >= jbr::reg::Instance::mMapThreshold);
+
+        std::thread         writer([&reg, &stop]() {
+            for (std::size_t i = 0; !stop; ++i)
+                reg->set(jbr::reg::Variable("counter", std::to_string(i)));
+        });
+
+        for (; reads < 200; ++reads)
+        {
+            std::optional<jbr::reg::Variable>   variable;
+
+            failures += reg->tryGet("large", variable) != jbr::reg::Error::None || !variable.has_value();
+        }
+        stop = true;
+        writer.join();
+        CHECK(failures == 0);
+        CHECK_FALSE(jbr::reg::Manager::open("./set_hard_linked_other.reg")->available("counter")); // Saved by replacing the file.
+        std::filesystem::remove("./set_hard_linked_other.reg");
+        jbr::reg::Manager::destroy(reg);
+    }
+#endif
+
 }
@@ -0,0 +1,121 @@
+//!
+//! @file tryGet_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <fstream>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::tryGet")
+{
+
+    SUBCASE("Basic try get variable.")
+    {
+        jbr::Register                       reg = jbr::reg::Manager::create("./basic_try_get.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        reg->set(jbr::reg::Variable("basic_try_get", "value", jbr::reg::var::perm::Rights(true, true, false, true, false, true)));
+        CHECK(reg->tryGet("basic_try_get", variable) == jbr::reg::Error::None);
+        REQUIRE(variable.has_value());
+        CHECK(std::string(variable->key()) == "basic_try_get");
+        CHECK(std::string(variable->read()) == "value");
+        CHECK((variable->rights() == jbr::reg::var::perm::Rights(true, true, false, true, false, true)));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Variable without rights node.")
+    {
+        std::ofstream                       regFile("./try_get_no_rights.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        regFile << "<register>\n"
+                   "    <header>\n"
+                   "        <version>1.0.0</version>\n"
+                   "    </header>\n"
+                   "    <body>\n"
+                   "        <variable>\n"
+                   "            <key>Another one</key>\n"
+                   "            <value>OK</value>\n"
+                   "        </variable>\n"
+                   "    </body>\n"
+                   "</register>\n";
+        regFile.close();
+
+        jbr::Register   reg = jbr::reg::Manager::open("./try_get_no_rights.reg");
+
+        CHECK(reg->tryGet("Another one", variable) == jbr::reg::Error::None);
+        REQUIRE(variable.has_value());
+        CHECK(std::string(variable->read()) == "OK");
+        CHECK((variable->rights() == jbr::reg::var::perm::Rights()));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("No existing variable.")
+    {
+        jbr::Register                       reg = jbr::reg::Manager::create("./try_get_no_exist_var.reg");
+        std::optional<jbr::reg::Variable>   variable = jbr::reg::Variable("previous");
+
+        CHECK(reg->tryGet("no_exist", variable) == jbr::reg::Error::NotFound);
+        CHECK_FALSE(variable.has_value());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Null or empty key.")
+    {
+        jbr::Register                       reg = jbr::reg::Manager::create("./try_get_null_key.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        CHECK(reg->tryGet(nullptr, variable) == jbr::reg::Error::InvalidKey);
+        CHECK(reg->tryGet("", variable) == jbr::reg::Error::InvalidKey);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Invalid register.")
+    {
+        jbr::Register                       reg = jbr::reg::Manager::create("./try_get_invalid.reg");
+        std::ofstream                       regInvalid("./try_get_invalid.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        regInvalid << "spdokpod \n <jdspssjd>><<<>>dofkdf\n";
+        regInvalid.close();
+        CHECK(reg->tryGet("Basic set", variable) == jbr::reg::Error::Parsing);
+        std::filesystem::remove("./try_get_invalid.reg");
+        CHECK(reg->tryGet("Basic set", variable) == jbr::reg::Error::NotExisting);
+    }
+
+    SUBCASE("Corrupted register.")
+    {
+        std::ofstream                       regFile("./try_get_corrupted.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        regFile << "<register>\n"
+                   "    <header>\n"
+                   "    </header>\n"
+                   "    <body>\n"
+                   "    </body>\n"
+                   "</register>\n";
+        regFile.close();
+
+        jbr::reg::Instance  reg("./try_get_corrupted.reg");
+
+        CHECK(reg.tryGet("var", variable) == jbr::reg::Error::Corrupted);
+        std::filesystem::remove("./try_get_corrupted.reg");
+    }
+
+    SUBCASE("Not readable register.")
+    {
+        jbr::Register                       reg = jbr::reg::Manager::create("./try_get_not_readable.reg");
+        std::optional<jbr::reg::Variable>   variable;
+
+        reg->set(jbr::reg::Variable("var", "value"));
+        reg->applyRights(jbr::reg::perm::Rights(false, true, true, true, true, true));
+        CHECK(reg->tryGet("var", variable) == jbr::reg::Error::NotReadable);
+        CHECK_FALSE(variable.has_value());
+        std::filesystem::remove("./try_get_not_readable.reg");
+    }
+
+}
@@ -0,0 +1,130 @@
+//!
+//! @file watch_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <condition_variable>
+#include <chrono>
+#include <doctest.h>
+
+//!
+//! @brief Collect watch notifications and allow to wait for them.
+//!
+struct WatchRecorder
+{
+    std::mutex                                          mMutex;
+    std::condition_variable                             mCondition;
+    std::map<std::string, std::optional<std::string>>   mChanges;
+
+    jbr::reg::WatchCallback callback()
+    {
+        return ([this](const char *key, const std::optional<jbr::reg::Variable> &variable) {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mChanges[key] = variable == std::nullopt ? std::nullopt : std::optional<std::string>(variable->read());
+            mCondition.notify_all();
+        });
+    }
+
+    void    clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mChanges.clear();
+    }
+
+    bool    wait(const char *key)
+    {
+        std::unique_lock<std::mutex>    lock(mMutex);
+
+        return (mCondition.wait_for(lock, std::chrono::seconds(5), [this, key]() { return (mChanges.count(key) > 0); }));
+    }
+};
+
+TEST_CASE("jbr::reg::Instance::watch")
+{
+
+    SUBCASE("Watch all variables.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./watch_all.reg");
+        WatchRecorder   recorder;
+
+        reg->set(jbr::reg::Variable("untouched", "value"));
+        (void)reg->watch(recorder.callback());
+        reg->set(jbr::reg::Variable("new variable", "new value"));
+        REQUIRE(recorder.wait("new variable"));
+        CHECK(recorder.mChanges["new variable"] == std::optional<std::string>("new value"));
+        recorder.clear(); // Before the change, its notification could else be cleared.
+        reg->remove("new variable");
+        REQUIRE(recorder.wait("new variable"));
+        CHECK(recorder.mChanges["new variable"] == std::nullopt);
+        CHECK(recorder.mChanges.count("untouched") == 0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Watch a single variable.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./watch_key.reg");
+        WatchRecorder   recorder;
+
+        (void)reg->watch("watched", recorder.callback());
+        reg->set(jbr::reg::Variable("ignored", "value"));
+        reg->set(jbr::reg::Variable("watched", "value"));
+        REQUIRE(recorder.wait("watched"));
+        CHECK(recorder.mChanges.count("ignored") == 0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Watch values stored out of line.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./watch_blob.reg");
+        WatchRecorder   recorder;
+
+        reg->set(jbr::reg::Variable("blob", std::string(200 * 1024, 'a')));
+        (void)reg->watch(recorder.callback());
+        jbr::reg::Manager::resetMetrics();
+        reg->set(jbr::reg::Variable("other", "value"));
+        REQUIRE(recorder.wait("other"));
+        CHECK(recorder.mChanges.count("blob") == 0);
+        CHECK(jbr::reg::Manager::metrics().mBytesRead < 100 * 1024);
+        reg->set(jbr::reg::Variable("blob", std::string(200 * 1024, 'b')));
+        REQUIRE(recorder.wait("blob"));
+        CHECK(recorder.mChanges["blob"] == std::optional<std::string>(std::string(200 * 1024, 'b')));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Unwatch.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./unwatch.reg");
+        WatchRecorder       recorder;
+        WatchRecorder       control;
+        jbr::reg::WatchId   id = reg->watch(recorder.callback());
+
+        (void)reg->watch(control.callback());
+        reg->unwatch(id);
+        reg->set(jbr::reg::Variable("var", "value"));
+        REQUIRE(control.wait("var"));
+        CHECK(recorder.mChanges.empty());
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Invalid watch.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./invalid_watch.reg");
+        std::string     msg;
+
+        try {
+            (void)reg->watch(nullptr, [](const char *, const std::optional<jbr::reg::Variable> &) {});
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to watch a null or empty variable.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
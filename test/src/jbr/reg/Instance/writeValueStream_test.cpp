@@ -0,0 +1,90 @@
+//!
+//! @file writeValueStream_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Instance::writeValueStream")
+{
+
+    SUBCASE("Write large values chunk by chunk.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_stream_write.reg");
+        std::string     value;
+        bool            visible = true;
+
+        {
+            jbr::reg::ValueWriter   writer = reg->writeValueStream("blob");
+
+            for (int i = 0; i < 50000; ++i)
+                writer << i << ';';
+            visible = reg->available("blob");
+            CHECK(writer.size() > 2 * jbr::reg::BlobStore::mChunkSize);
+            writer.commit();
+        }
+        CHECK_FALSE(visible);
+        value = std::string(reg->get("blob").read());
+        CHECK(value.substr(0, 10) == "0;1;2;3;4;");
+        CHECK(value.substr(value.size() - 6) == "49999;");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Small values written inline.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_stream_inline.reg");
+
+        reg->setBlobCollectDelay(std::chrono::seconds(0));
+        reg->set(jbr::reg::Variable("var", std::string(100 * 1024, 'z')));
+        {
+            jbr::reg::ValueWriter   writer = reg->writeValueStream("var");
+
+            writer << "small";
+            writer.commit();
+        }
+        CHECK(std::string(reg->get("var").read()) == "small");
+        CHECK(std::filesystem::is_empty("./blob_stream_inline.reg.blobs"));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Uncommitted values discarded.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./blob_stream_discard.reg");
+
+        reg->set(jbr::reg::Variable("var", "value"));
+        {
+            jbr::reg::ValueWriter   writer = reg->writeValueStream("var");
+
+            writer << std::string(300 * 1024, 'a');
+        }
+        CHECK(std::string(reg->get("var").read()) == "value");
+        CHECK(std::filesystem::is_empty("./blob_stream_discard.reg.blobs"));
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Write without update right.")
+    {
+        jbr::Register           reg = jbr::reg::Manager::create("./blob_stream_no_right.reg");
+        jbr::reg::ValueWriter   writer = reg->writeValueStream("var");
+        std::string             msg;
+
+        reg->set(jbr::reg::Variable("var", "value", jbr::reg::var::perm::Rights(true, true, false, true, true, true)));
+        writer << std::string(100 * 1024, 'a');
+        try {
+            writer.commit();
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to update a variable without read, write and update rights.");
+        CHECK(std::string(reg->get("var").read()) == "value");
+        CHECK_THROWS_AS((void)reg->writeValueStream(""), jbr::reg::exception);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
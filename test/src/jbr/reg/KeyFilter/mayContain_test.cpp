@@ -0,0 +1,63 @@
+//!
+//! @file mayContain_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/KeyFilter.hpp>
+#include <jbr/reg/Stamp.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::KeyFilter::mayContain")
+{
+
+    SUBCASE("No false negative, few false positives.")
+    {
+        jbr::reg::KeyFilter filter("stamp", 1000);
+        std::size_t         positives = 0;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+            filter.insert("variable." + std::to_string(i));
+        for (std::size_t i = 0; i < 1000; ++i)
+            CHECK(filter.mayContain("variable." + std::to_string(i)));
+        for (std::size_t i = 0; i < 10000; ++i)
+            positives += filter.mayContain("missing." + std::to_string(i)) ? 1 : 0;
+        CHECK(positives < 500);
+    }
+
+    SUBCASE("Empty filter.")
+    {
+        jbr::reg::KeyFilter filter("stamp", 0);
+
+        CHECK_FALSE(filter.mayContain("variable"));
+        CHECK_FALSE(filter.mayContain(""));
+    }
+
+    SUBCASE("Filter loaded from the register filter file.")
+    {
+        std::ofstream("./key_filter_file.reg") << "<register/>\n";
+
+        std::string         stamp = jbr::reg::stamp("./key_filter_file.reg");
+        jbr::reg::KeyFilter filter(std::string(stamp), 10);
+
+        filter.insert("saved");
+        CHECK_FALSE(jbr::reg::KeyFilter::enabled("./key_filter_file.reg"));
+        CHECK(jbr::reg::KeyFilter::cached("./key_filter_file.reg", stamp) == nullptr);
+        jbr::reg::KeyFilter::save("./key_filter_file.reg", filter);
+        CHECK(jbr::reg::KeyFilter::enabled("./key_filter_file.reg"));
+        CHECK(jbr::reg::KeyFilter::cached("./key_filter_file.reg", stamp + '0') == nullptr);
+
+        auto    loaded = jbr::reg::KeyFilter::cached("./key_filter_file.reg", stamp);
+
+        REQUIRE(loaded != nullptr);
+        CHECK(loaded->mayContain("saved"));
+        CHECK_FALSE(loaded->mayContain("not saved"));
+        jbr::reg::KeyFilter::destroy("./key_filter_file.reg");
+        CHECK_FALSE(jbr::reg::KeyFilter::enabled("./key_filter_file.reg"));
+        CHECK(jbr::reg::KeyFilter::cached("./key_filter_file.reg", stamp) == nullptr);
+        std::filesystem::remove("./key_filter_file.reg");
+    }
+}
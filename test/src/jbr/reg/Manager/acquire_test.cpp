@@ -0,0 +1,99 @@
+//!
+//! @file acquire_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+#include <filesystem>
+#include <type_traits>
+#include <thread>
+#include <vector>
+
+TEST_CASE("jbr::reg::Manager::acquire")
+{
+
+    SUBCASE("Acquire a register with a null path.")
+    {
+        std::string msg;
+
+        try {
+            (void)jbr::reg::Manager::acquire(nullptr);
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "The register '' does not exist. You must create it before.");
+    }
+
+    SUBCASE("Acquire a register not existing.")
+    {
+        CHECK_THROWS_AS((void)jbr::reg::Manager::acquire("./acquire_missing.reg"), jbr::reg::exception);
+    }
+
+    SUBCASE("Same instance shared by path.")
+    {
+        jbr::reg::Manager::create("./acquire_shared.reg")->set(jbr::reg::Variable("key", "value"));
+
+        jbr::SharedRegister first = jbr::reg::Manager::acquire("./acquire_shared.reg");
+        jbr::SharedRegister second = jbr::reg::Manager::acquire("acquire_shared.reg");
+        jbr::SharedRegister third = jbr::reg::Manager::acquire(std::filesystem::absolute("./acquire_shared.reg").string().c_str());
+
+        CHECK(first == second);
+        CHECK(first == third);
+        CHECK(first.use_count() == 3);
+        CHECK(first->localization() == std::filesystem::canonical("./acquire_shared.reg").string());
+        CHECK(std::string(first->get("key").read()) == "value");
+        CHECK_THROWS_AS(jbr::reg::Manager::destroy(first), jbr::reg::exception);
+        CHECK(jbr::reg::Manager::exist("./acquire_shared.reg"));
+        second.reset();
+        third.reset();
+        jbr::reg::Manager::destroy(first);
+        CHECK_FALSE(jbr::reg::Manager::exist("./acquire_shared.reg"));
+    }
+
+    SUBCASE("Instance closed with its last handle.")
+    {
+        jbr::Register       reg = jbr::reg::Manager::create("./acquire_closed.reg");
+        std::weak_ptr<const jbr::reg::Instance> released;
+
+        jbr::reg::Manager::resetMetrics();
+        {
+            jbr::SharedRegister shared = jbr::reg::Manager::acquire("./acquire_closed.reg");
+
+            released = shared;
+            CHECK(jbr::reg::Manager::acquire("./acquire_closed.reg") == shared);
+        }
+        CHECK(released.expired());
+        CHECK(jbr::reg::Manager::acquire("./acquire_closed.reg") != nullptr);
+        CHECK(jbr::reg::Manager::metrics().mHits[static_cast<std::size_t>(jbr::reg::metric::Cache::Registry)] == 1);
+        CHECK(jbr::reg::Manager::metrics().mMisses[static_cast<std::size_t>(jbr::reg::metric::Cache::Registry)] == 2);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Constant instance shared between threads.")
+    {
+        static_assert(std::is_const_v<jbr::SharedRegister::element_type>, "Shared registers can't be moved or reconfigured.");
+        (void)jbr::reg::Manager::create("./acquire_threads.reg");
+
+        std::vector<std::thread>    threads;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            threads.emplace_back([i]() {
+                jbr::SharedRegister reg = jbr::reg::Manager::acquire("./acquire_threads.reg");
+
+                for (std::size_t j = 0; j < 10; ++j)
+                    reg->set(jbr::reg::Variable("key " + std::to_string(i) + ' ' + std::to_string(j), std::to_string(j)));
+            });
+        for (std::thread &thread : threads)
+            thread.join();
+
+        jbr::SharedRegister reg = jbr::reg::Manager::acquire("./acquire_threads.reg");
+        std::size_t         count = reg->forEach([](const jbr::reg::VariableView &) { return (true); });
+
+        CHECK(count == 40);
+        jbr::reg::Manager::destroy(reg);
+    }
+}
@@ -0,0 +1,97 @@
+//!
+//! @file metrics_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <fstream>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Manager::metrics")
+{
+
+    SUBCASE("Operations, phases and bytes recorded.")
+    {
+        jbr::reg::Manager::resetMetrics();
+
+        jbr::Register   reg = jbr::reg::Manager::create("./metrics_operations.reg");
+
+        reg->set(jbr::reg::Variable("first", "value"));
+        reg->set(jbr::reg::Variable("second", "value"));
+        CHECK(std::string(reg->get("first").read()) == "value");
+        CHECK_THROWS_AS((void)reg->get("missing"), jbr::reg::exception);
+        CHECK_FALSE(reg->find("missing").has_value());
+        CHECK(reg->available("second"));
+
+        jbr::reg::metric::Snapshot  metrics = jbr::reg::Manager::metrics();
+
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Create).mCount >= 1);
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Set).mCount >= 2);
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Get).mCount >= 3);
+        CHECK(metrics.errors(jbr::reg::metric::Operation::Get) >= 2);
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Available).mCount >= 1);
+        CHECK(metrics.phase(jbr::reg::metric::Phase::Io).mCount >= 6);
+        CHECK(metrics.phase(jbr::reg::metric::Phase::Parse).mCount >= 5);
+        CHECK(metrics.phase(jbr::reg::metric::Phase::Search).mCount >= 4);
+        CHECK(metrics.phase(jbr::reg::metric::Phase::Serialize).mCount >= 2);
+        CHECK(metrics.mBytesRead >= std::filesystem::file_size("./metrics_operations.reg"));
+        CHECK(metrics.mBytesWritten >= std::filesystem::file_size("./metrics_operations.reg"));
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Set).percentile(50) > 0);
+        CHECK(metrics.operation(jbr::reg::metric::Operation::Set).mMax >= metrics.operation(jbr::reg::metric::Operation::Set).mMin);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Caches hit rates.")
+    {
+        jbr::reg::Manager::resetMetrics();
+
+        jbr::Register   reg = jbr::reg::Manager::create("./metrics_caches.reg");
+
+        reg->set(jbr::reg::Variable("node.1", "up"));
+        (void)reg->findKeys("node.*");
+        (void)reg->findKeys("node.*");
+        (void)reg->findKeys("node.*");
+        (void)reg->findKeys("node.*");
+
+        jbr::reg::metric::Snapshot  metrics = jbr::reg::Manager::metrics();
+
+        CHECK(metrics.mHits[static_cast<std::size_t>(jbr::reg::metric::Cache::KeyIndex)] == 3);
+        CHECK(metrics.mMisses[static_cast<std::size_t>(jbr::reg::metric::Cache::KeyIndex)] == 1);
+        CHECK(metrics.hitRate(jbr::reg::metric::Cache::KeyIndex) == doctest::Approx(0.75));
+        CHECK(metrics.hitRate(jbr::reg::metric::Cache::ValueIndex) == 0.0);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Prometheus dump.")
+    {
+        std::string content;
+
+        jbr::reg::Manager::resetMetrics();
+        {
+            jbr::Register   reg = jbr::reg::Manager::create("./metrics_dump.reg");
+
+            reg->set(jbr::reg::Variable("key", "value"));
+            jbr::reg::Manager::destroy(reg);
+        }
+        jbr::reg::Manager::dumpMetrics("./metrics_dump.prom");
+        {
+            std::ifstream   ifs("./metrics_dump.prom");
+
+            content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        CHECK(content.find("# TYPE cregister_operation_duration_seconds summary") != std::string::npos);
+        CHECK(content.find("cregister_operation_duration_seconds_count{operation=\"set\"} 1\n") != std::string::npos);
+        CHECK(content.find("cregister_operation_duration_seconds{operation=\"set\",quantile=\"0.99\"}") != std::string::npos);
+        CHECK(content.find("cregister_phase_duration_seconds_count{phase=\"serialize\"}") != std::string::npos);
+        CHECK(content.find("cregister_written_bytes_total ") != std::string::npos);
+        CHECK(content.find("cregister_cache_hits_total{cache=\"key_index\"} 0\n") != std::string::npos);
+        CHECK_THROWS_AS(jbr::reg::Manager::dumpMetrics(nullptr), jbr::reg::exception);
+        CHECK_THROWS_AS(jbr::reg::Manager::dumpMetrics("./not/existing/directory/metrics.prom"), jbr::reg::exception);
+        std::filesystem::remove("./metrics_dump.prom");
+    }
+
+}
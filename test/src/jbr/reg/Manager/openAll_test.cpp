@@ -0,0 +1,84 @@
+//!
+//! @file openAll_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+#include <filesystem>
+#include <fstream>
+
+TEST_CASE("jbr::reg::Manager::openAll")
+{
+
+    SUBCASE("Registers opened in parallel, errors by path.")
+    {
+        std::vector<std::string>    paths;
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            paths.push_back("./open_all_" + std::to_string(i) + ".reg");
+            jbr::reg::Manager::create(paths.back().c_str())->set(jbr::reg::Variable("index", std::to_string(i)));
+        }
+        std::ofstream("./open_all_invalid.reg") << "<register>\n";
+        paths.emplace_back("./open_all_invalid.reg");
+        paths.emplace_back("./open_all_missing.reg");
+        paths.push_back(paths.front());
+
+        std::vector<jbr::reg::Opened>   opened = jbr::reg::Manager::openAll(paths, 3);
+
+        REQUIRE(opened.size() == paths.size());
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            CHECK(opened[i].mPath == paths[i]);
+            CHECK(opened[i].mError.empty());
+            REQUIRE(opened[i].mRegister != nullptr);
+            CHECK(std::string(opened[i].mRegister->get("index").read()) == std::to_string(i));
+        }
+        CHECK(opened[8].mRegister == nullptr);
+        CHECK_FALSE(opened[8].mError.empty());
+        CHECK(opened[9].mRegister == nullptr);
+        CHECK(opened[9].mError == "The register './open_all_missing.reg' does not exist. You must create it before.");
+        CHECK(opened[10].mRegister == opened[0].mRegister);
+        opened[10].mRegister.reset();
+        for (std::size_t i = 0; i < 8; ++i)
+            jbr::reg::Manager::destroy(opened[i].mRegister);
+        std::filesystem::remove("./open_all_invalid.reg");
+    }
+
+    SUBCASE("No register.")
+    {
+        CHECK(jbr::reg::Manager::openAll({}).empty());
+    }
+}
+
+TEST_CASE("jbr::reg::Manager::preload")
+{
+
+    SUBCASE("Registers listed into a manifest.")
+    {
+        std::filesystem::create_directories("./preload");
+        (void)jbr::reg::Manager::create("./preload/first.reg");
+        (void)jbr::reg::Manager::create("./preload/second.reg");
+        std::ofstream("./preload/manifest") << "# Startup registers\nfirst.reg\n\nsecond.reg\r\n";
+
+        std::vector<jbr::reg::Opened>   opened = jbr::reg::Manager::preload("./preload/manifest");
+
+        REQUIRE(opened.size() == 2);
+        CHECK(opened[0].mPath == (std::filesystem::path("./preload") / "first.reg").string());
+        CHECK(opened[0].mRegister != nullptr);
+        CHECK(opened[1].mRegister != nullptr);
+        CHECK(opened[1].mRegister == jbr::reg::Manager::acquire("./preload/second.reg"));
+        jbr::reg::Manager::destroy(opened[0].mRegister);
+        jbr::reg::Manager::destroy(opened[1].mRegister);
+        std::filesystem::remove_all("./preload");
+    }
+
+    SUBCASE("Manifest not existing.")
+    {
+        CHECK_THROWS_AS((void)jbr::reg::Manager::preload("./preload_missing"), jbr::reg::exception);
+        CHECK_THROWS_AS((void)jbr::reg::Manager::preload(nullptr), jbr::reg::exception);
+    }
+}
@@ -5,6 +5,7 @@
 //!
 
 #include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
 #include <jbr/reg/exception.hpp>
 #include <doctest.h>
 #include <fstream>
@@ -499,4 +500,18 @@ TEST_CASE("jbr::reg::Manager::open")
         std::filesystem::remove("./ut_open_full_right_set_register.reg");
     }
 
+    SUBCASE("Open a register with a single parse.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./ut_open_single_parse.reg");
+
+        reg->set(jbr::reg::Variable("key", "value"));
+        jbr::reg::Manager::resetMetrics();
+        {
+            jbr::Register   opened = jbr::reg::Manager::open("./ut_open_single_parse.reg");
+
+            CHECK(jbr::reg::Manager::metrics().phase(jbr::reg::metric::Phase::Parse).mCount == 1);
+        }
+        jbr::reg::Manager::destroy(reg);
+    }
+
 }
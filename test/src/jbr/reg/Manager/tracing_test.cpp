@@ -0,0 +1,79 @@
+//!
+//! @file tracing_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <fstream>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Manager::startTracing")
+{
+
+#ifndef JBR_REG_NO_TRACING
+    SUBCASE("Operations and phases recorded as trace events.")
+    {
+        std::string content;
+
+        jbr::reg::Manager::startTracing("./tracing_events.json");
+        {
+            jbr::Register   reg = jbr::reg::Manager::create("./tracing_events.reg");
+
+            reg->set(jbr::reg::Variable("key", "value"));
+            CHECK_FALSE(reg->find("missing").has_value());
+            jbr::reg::Manager::destroy(reg);
+        }
+        jbr::reg::Manager::stopTracing();
+        {
+            std::ifstream   ifs("./tracing_events.json");
+
+            content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        CHECK(content.find("\"traceEvents\":[") != std::string::npos);
+        CHECK(content.find("{\"name\":\"set\",\"cat\":\"operation\",\"ph\":\"X\"") != std::string::npos);
+        CHECK(content.find("{\"name\":\"lock\",\"cat\":\"phase\",\"ph\":\"X\"") != std::string::npos);
+        CHECK(content.find("{\"name\":\"serialize\",\"cat\":\"phase\",\"ph\":\"X\"") != std::string::npos);
+        CHECK(content.find("\"args\":{\"failed\":true}") != std::string::npos);
+        CHECK(content.find("\"dropped_events\":0") != std::string::npos);
+        CHECK(content.substr(content.size() - 4) == "\n]}\n");
+        std::filesystem::remove("./tracing_events.json");
+    }
+
+    SUBCASE("Nothing recorded once stopped.")
+    {
+        std::string content;
+
+        jbr::reg::Manager::startTracing("./tracing_stopped.json");
+        jbr::reg::Manager::stopTracing();
+        {
+            jbr::Register   reg = jbr::reg::Manager::create("./tracing_stopped.reg");
+
+            jbr::reg::Manager::destroy(reg);
+        }
+        {
+            std::ifstream   ifs("./tracing_stopped.json");
+
+            content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        CHECK(content.find("\"name\"") == std::string::npos);
+        std::filesystem::remove("./tracing_stopped.json");
+    }
+
+    SUBCASE("Invalid tracing usage.")
+    {
+        CHECK_THROWS_AS(jbr::reg::Manager::startTracing(nullptr), jbr::reg::exception);
+        CHECK_THROWS_AS(jbr::reg::Manager::startTracing(""), jbr::reg::exception);
+        CHECK_THROWS_AS(jbr::reg::Manager::stopTracing(), jbr::reg::exception);
+    }
+#else
+    SUBCASE("Tracing disabled at compile time.")
+    {
+        CHECK_THROWS_AS(jbr::reg::Manager::startTracing("./tracing_disabled.json"), jbr::reg::exception);
+    }
+#endif
+
+}
@@ -0,0 +1,77 @@
+//!
+//! @file rights_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/perm/Mask.hpp>
+#include <jbr/reg/var/perm/Mask.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::perm::Mask::rights")
+{
+
+    SUBCASE("All rights by default.")
+    {
+        constexpr jbr::reg::perm::Mask  mask;
+
+        static_assert(mask.bits() == jbr::reg::perm::Mask::All);
+        static_assert(mask.isReadable() && mask.isOpenable() && mask.isWritable() && mask.isCopyable() && mask.isMovable() && mask.isDestroyable());
+        static_assert(jbr::reg::perm::Mask(jbr::reg::perm::Rights()) == mask);
+    }
+
+    SUBCASE("Predicates.")
+    {
+        constexpr jbr::reg::perm::Mask  readOnly(jbr::reg::perm::Mask::Read | jbr::reg::perm::Mask::Move);
+
+        static_assert(readOnly.isReadable() && !readOnly.isWritable());
+        static_assert(!readOnly.isMovable() && !readOnly.isOpenable());
+        static_assert(jbr::reg::perm::Mask(0xFF) == jbr::reg::perm::Mask());
+    }
+
+    SUBCASE("Conversion to the rights structure.")
+    {
+        jbr::reg::perm::Rights  rights(true, false, true, false, false, true);
+        jbr::reg::perm::Mask    mask(rights);
+        jbr::reg::perm::Rights  converted = mask.rights();
+
+        CHECK(mask.bits() == (jbr::reg::perm::Mask::Read | jbr::reg::perm::Mask::Open | jbr::reg::perm::Mask::Destroy));
+        CHECK(converted.mRead);
+        CHECK_FALSE(converted.mWrite);
+        CHECK(converted.mOpen);
+        CHECK_FALSE(converted.mCopy);
+        CHECK_FALSE(converted.mMove);
+        CHECK(converted.mDestroy);
+        mask.set(jbr::reg::perm::Mask::Write | jbr::reg::perm::Mask::Move, true);
+        CHECK(mask.isMovable());
+        mask.set(jbr::reg::perm::Mask::Read, false);
+        CHECK_FALSE(mask.isMovable());
+        CHECK(mask != jbr::reg::perm::Mask(rights));
+    }
+}
+
+TEST_CASE("jbr::reg::var::perm::Mask::rights")
+{
+
+    SUBCASE("All rights by default.")
+    {
+        constexpr jbr::reg::var::perm::Mask mask;
+
+        static_assert(mask.bits() == jbr::reg::var::perm::Mask::All);
+        static_assert(mask.isReadable() && mask.isWritable() && mask.isUpdatable() && mask.isRenamable() && mask.isCopyable() && mask.isRemovable());
+        static_assert(jbr::reg::var::perm::Mask(jbr::reg::var::perm::Rights()) == mask);
+    }
+
+    SUBCASE("Conversion to the rights structure.")
+    {
+        jbr::reg::var::perm::Rights rights(true, true, true, false, false, true);
+        jbr::reg::var::perm::Mask   mask(rights);
+
+        CHECK(mask.rights() == rights);
+        CHECK(mask.isUpdatable());
+        CHECK_FALSE(mask.isRenamable());
+        CHECK_FALSE(mask.isCopyable());
+        CHECK(mask.isRemovable());
+        CHECK(jbr::reg::var::perm::Mask(mask.bits()) == mask);
+    }
+}
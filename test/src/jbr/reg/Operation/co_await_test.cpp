@@ -0,0 +1,102 @@
+//!
+//! @file co_await_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Manager.hpp>
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <string>
+#include <doctest.h>
+
+//!
+//! @struct Task
+//! @brief Minimal coroutine, started on call, whose end is waited through a future.
+//!
+struct Task
+{
+    //!
+    //! @struct promise_type
+    //! @brief Coroutine promise, completing the future.
+    //!
+    struct promise_type
+    {
+        std::promise<void>  mDone; //!< Completed at the coroutine end.
+
+        Task                get_return_object() { return (Task{ mDone.get_future() }); }
+        std::suspend_never  initial_suspend() noexcept { return {}; }
+        std::suspend_never  final_suspend() noexcept { return {}; }
+        void                return_void() { mDone.set_value(); }
+        void                unhandled_exception() { mDone.set_exception(std::current_exception()); }
+    };
+
+    std::future<void>   mDone; //!< Coroutine end.
+};
+
+static Task setThenGet(const jbr::Register &reg, std::string &value)
+{
+    co_await reg->asyncSet(jbr::reg::Variable("awaited", "value"));
+
+    jbr::reg::Variable  variable = co_await reg->asyncGet("awaited");
+
+    value = variable.read();
+}
+
+static Task getMissing(const jbr::Register &reg, std::string &msg)
+{
+    try {
+        (void)co_await reg->asyncGet("no_exist");
+    }
+    catch (jbr::reg::exception &e) {
+        msg = e.what();
+    }
+}
+
+static Task getResumedOn(const jbr::Register &reg, jbr::reg::ThreadPool &pool, bool &resumedOn)
+{
+    (void)co_await reg->asyncGet("resumed").resumeOn([&pool](std::function<void()> &&resume) { pool.post(0, std::move(resume)); });
+    resumedOn = pool.runsOn(0);
+}
+
+TEST_CASE("jbr::reg::Operation::co_await")
+{
+
+    SUBCASE("Set and get awaited from a coroutine.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./co_await_set_get.reg");
+        std::string     value;
+
+        setThenGet(reg, value).mDone.get();
+        CHECK(value == "value");
+        CHECK(std::string(reg->get("awaited").read()) == "value");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Exception raised to the awaiting coroutine.")
+    {
+        jbr::Register   reg = jbr::reg::Manager::create("./co_await_no_exist.reg");
+        std::string     msg;
+
+        getMissing(reg, msg).mDone.get();
+        CHECK(msg == "No variable named 'no_exist' were found into the register './co_await_no_exist.reg'.");
+        jbr::reg::Manager::destroy(reg);
+    }
+
+    SUBCASE("Coroutine resumed through a executor.")
+    {
+        jbr::Register           reg = jbr::reg::Manager::create("./co_await_resume_on.reg");
+        jbr::reg::ThreadPool    pool(1);
+        bool                    resumedOn = false;
+
+        reg->set(jbr::reg::Variable("resumed", "value"));
+        getResumedOn(reg, pool, resumedOn).mDone.get();
+        CHECK(resumedOn);
+        jbr::reg::Manager::destroy(reg);
+    }
+
+}
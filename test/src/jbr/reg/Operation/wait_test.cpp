@@ -0,0 +1,51 @@
+//!
+//! @file wait_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Operation.hpp>
+#include <jbr/reg/exception.hpp>
+#include <string>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Operation::wait")
+{
+
+    SUBCASE("Operation waited from a other thread.")
+    {
+        jbr::reg::ThreadPool        pool(1);
+        jbr::reg::Operation<int>    operation = jbr::reg::Operation<int>::launch(pool, 0, []() { return (42); });
+
+        CHECK(operation.get() == 42);
+        CHECK(operation.ready());
+    }
+
+    SUBCASE("Operation waited from the worker running it.")
+    {
+        jbr::reg::ThreadPool                pool(1);
+        jbr::reg::Operation<std::string>    outer = jbr::reg::Operation<std::string>::launch(pool, 0, [&pool]() {
+            jbr::reg::Operation<int>    inner = jbr::reg::Operation<int>::launch(pool, 0, []() { return (42); });
+
+            try {
+                (void)inner.get();
+            }
+            catch (jbr::reg::exception &e) {
+                return (std::string(e.what()));
+            }
+            return (std::string());
+        });
+
+        CHECK(outer.get() == "Impossible to wait a register operation from the worker running it, it must be awaited instead.");
+    }
+
+    SUBCASE("Completed operation waited from the worker of its affinity.")
+    {
+        jbr::reg::ThreadPool        pool(1);
+        jbr::reg::Operation<int>    first = jbr::reg::Operation<int>::launch(pool, 0, []() { return (1); });
+        jbr::reg::Operation<int>    second = jbr::reg::Operation<int>::launch(pool, 0, [&first]() { return (first.get() + 1); });
+
+        CHECK(second.get() == 2);
+    }
+
+}
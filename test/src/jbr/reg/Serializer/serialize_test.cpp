@@ -0,0 +1,111 @@
+//!
+//! @file serialize_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Serializer.hpp>
+#include <jbr/reg/exception.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <doctest.h>
+
+//!
+//! @brief Serialize a document into a file, then read it back.
+//! @param document Document to serialize.
+//! @param written Bytes reported as written.
+//! @return File content.
+//!
+static std::string serialize(const tinyxml2::XMLDocument &document, std::size_t &written)
+{
+    std::string content;
+
+    {
+        jbr::reg::Serializer    serializer("./serialize.xml");
+
+        serializer.serialize(document);
+        serializer.finish();
+        written = serializer.written();
+    }
+
+    std::ifstream   ifs("./serialize.xml", std::ios::binary);
+
+    content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    ifs.close();
+    std::filesystem::remove("./serialize.xml");
+    return (content);
+}
+
+//!
+//! @brief Print a document with tinyxml2.
+//! @param document Document to print.
+//! @return Printed document.
+//!
+static std::string print(const tinyxml2::XMLDocument &document)
+{
+    tinyxml2::XMLPrinter    printer;
+
+    document.Print(&printer);
+    return (std::string(printer.CStr(), static_cast<std::size_t>(printer.CStrSize() - 1)));
+}
+
+TEST_CASE("jbr::reg::Serializer::serialize")
+{
+    static const char   xml[] = "<?xml version=\"1.0\"?>\n<!-- register -->\n<register attribute=\"a &quot;quoted&quot; &amp; &apos;b&apos;\">\n"
+                                "    <header>\n        <version>1.0.0</version>\n        <empty/>\n    </header>\n"
+                                "    <body>\n        <value>a &lt;b&gt; &amp; c \"d\"</value>\n        <data><![CDATA[<raw> & data]]></data>\n"
+                                "    </body>\n</register>\n";
+
+    SUBCASE("tinyxml2 printer format.")
+    {
+        tinyxml2::XMLDocument   document;
+        std::size_t             written = 0;
+
+        REQUIRE(document.Parse(xml) == tinyxml2::XML_SUCCESS);
+
+        std::string printed = print(document);
+        std::string content = serialize(document, written);
+
+        CHECK(content == printed);
+        CHECK(written == content.size());
+        REQUIRE(document.Parse("<mixed>text<inner>value</inner>tail</mixed>") == tinyxml2::XML_SUCCESS);
+        CHECK(serialize(document, written) == print(document));
+    }
+
+    SUBCASE("Texts written back as parsed.")
+    {
+        tinyxml2::XMLDocument   document;
+        std::size_t             written = 0;
+
+        REQUIRE(document.Parse(xml) == tinyxml2::XML_SUCCESS);
+        CHECK(serialize(document, written) == xml);
+        document.FirstChildElement("register")->FirstChildElement("body")->FirstChildElement("value")->SetText("<changed> & \"new\"");
+        CHECK(serialize(document, written).find("<value>&lt;changed&gt; &amp; \"new\"</value>") != std::string::npos);
+        CHECK(serialize(document, written) == print(document));
+    }
+
+    SUBCASE("Output larger than the buffer.")
+    {
+        tinyxml2::XMLDocument   document;
+        tinyxml2::XMLElement    *reg = document.NewElement("register");
+        std::size_t             written = 0;
+
+        document.InsertFirstChild(reg);
+        for (int i = 0; i < 3; ++i)
+            reg->InsertEndChild(document.NewElement("value"))->ToElement()->SetText(std::string(jbr::reg::Serializer::mBufferSize + 7, 'a' + i).c_str());
+
+        std::string content = serialize(document, written);
+
+        CHECK(content == print(document));
+        CHECK(written == content.size());
+        CHECK(written > 3 * jbr::reg::Serializer::mBufferSize);
+    }
+
+    SUBCASE("Not writable file.")
+    {
+        CHECK_THROWS_AS(jbr::reg::Serializer("./serialize_not_existing/serialize.xml"), jbr::reg::exception);
+    }
+
+}
@@ -0,0 +1,53 @@
+//!
+//! @file post_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/ThreadPool.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::ThreadPool::post")
+{
+
+    SUBCASE("Jobs with the same affinity are run in order.")
+    {
+        std::vector<int>    order;
+
+        {
+            jbr::reg::ThreadPool    pool(4);
+
+            for (int i = 0; i < 100; ++i)
+                pool.post(42, [&order, i]() { order.push_back(i); });
+        }
+        REQUIRE(order.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            CHECK(order[i] == i);
+    }
+
+    SUBCASE("Jobs are run by all workers.")
+    {
+        std::atomic<int>    count(0);
+
+        {
+            jbr::reg::ThreadPool    pool(3);
+
+            CHECK(pool.size() == 3);
+            for (int i = 0; i < 30; ++i)
+                pool.post([&count]() { ++count; throw std::runtime_error("ignored"); });
+        }
+        CHECK(count == 30);
+    }
+
+    SUBCASE("Synchronous pool.")
+    {
+        jbr::reg::ThreadPool    pool(0);
+        std::thread::id         id;
+
+        pool.post([&id]() { id = std::this_thread::get_id(); });
+        CHECK(pool.size() == 0);
+        CHECK((id == std::this_thread::get_id()));
+        CHECK_FALSE(pool.runsOn(0));
+    }
+
+}
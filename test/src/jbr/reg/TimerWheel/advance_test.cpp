@@ -0,0 +1,74 @@
+//!
+//! @file advance_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/TimerWheel.hpp>
+#include <algorithm>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::TimerWheel::advance")
+{
+
+    SUBCASE("Timers expire on their deadline.")
+    {
+        jbr::reg::TimerWheel<int>   wheel(1000);
+
+        wheel.schedule(1005, 1);
+        wheel.schedule(1000 + 70, 2);
+        wheel.schedule(1000 + 5000, 3);
+        wheel.schedule(1000 + 300000, 4);
+        CHECK(wheel.size() == 4);
+        CHECK(wheel.advance(1004).empty());
+        CHECK(wheel.advance(1005) == std::vector<int>{ 1 });
+        CHECK(wheel.advance(1069).empty());
+        CHECK(wheel.advance(1070) == std::vector<int>{ 2 });
+        CHECK(wheel.advance(5999).empty());
+        CHECK(wheel.advance(6000) == std::vector<int>{ 3 });
+        CHECK(wheel.advance(300999).empty());
+        CHECK(wheel.advance(301000) == std::vector<int>{ 4 });
+        CHECK(wheel.size() == 0);
+    }
+
+    SUBCASE("Past deadlines expire on the next tick.")
+    {
+        jbr::reg::TimerWheel<int>   wheel(500);
+
+        wheel.schedule(10, 1);
+        CHECK(wheel.advance(500) == std::vector<int>{ 1 });
+    }
+
+    SUBCASE("Deadlines beyond the wheel range.")
+    {
+        jbr::reg::TimerWheel<int>   wheel(0);
+        std::uint64_t               deadline = (std::uint64_t(1) << 24) * 3 + 17;
+
+        wheel.schedule(deadline + 0, 1);
+        CHECK(wheel.advance(deadline - 1).empty());
+        CHECK(wheel.advance(deadline) == std::vector<int>{ 1 });
+    }
+
+    SUBCASE("Many timers.")
+    {
+        jbr::reg::TimerWheel<int>   wheel(0);
+        std::vector<int>            expired;
+
+        for (int i = 0; i < 10000; ++i)
+            wheel.schedule(static_cast<std::uint64_t>(i) * 37 % 100000, int(i));
+        for (std::uint64_t tick = 0; tick < 100000; tick += 997)
+        {
+            std::vector<int>    timers = wheel.advance(tick);
+
+            for (int timer : timers)
+                CHECK(static_cast<std::uint64_t>(timer) * 37 % 100000 <= tick);
+            expired.insert(expired.end(), timers.begin(), timers.end());
+        }
+        for (int timer : wheel.advance(100000))
+            expired.push_back(timer);
+        std::sort(expired.begin(), expired.end());
+        CHECK(expired.size() == 10000);
+        CHECK(wheel.size() == 0);
+    }
+
+}
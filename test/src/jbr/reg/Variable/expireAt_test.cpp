@@ -0,0 +1,56 @@
+//!
+//! @file expireAt_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/Variable.hpp>
+#include <jbr/reg/exception.hpp>
+#include <doctest.h>
+
+TEST_CASE("jbr::reg::Variable::expireAt")
+{
+
+    SUBCASE("Variable without expiration.")
+    {
+        jbr::reg::Variable  var("key", "value");
+
+        CHECK(var.expiration() == std::nullopt);
+        CHECK_FALSE(var.isExpired());
+    }
+
+    SUBCASE("Expire a variable.")
+    {
+        jbr::reg::Variable  var("key", "value");
+
+        CHECK_NOTHROW(var.expireAt(std::chrono::system_clock::now() - std::chrono::seconds(1)));
+        CHECK(var.isExpired());
+        CHECK_NOTHROW(var.expireIn(std::chrono::hours(1)));
+        CHECK_FALSE(var.isExpired());
+        CHECK_NOTHROW(var.expireAt(std::nullopt));
+        CHECK(var.expiration() == std::nullopt);
+    }
+
+    SUBCASE("Expiration from constructor.")
+    {
+        std::chrono::system_clock::time_point   date = std::chrono::system_clock::now() + std::chrono::minutes(5);
+        jbr::reg::Variable                      var("key", "value", jbr::reg::var::perm::Rights(true, false, false, false, false, false), date);
+
+        CHECK(var.expiration() == date);
+    }
+
+    SUBCASE("Expire without rights.")
+    {
+        jbr::reg::Variable  var("key", "value", jbr::reg::var::perm::Rights(true, true, false, true, true, true));
+        std::string         msg;
+
+        try {
+            var.expireIn(std::chrono::seconds(1));
+        }
+        catch (jbr::reg::exception &e) {
+            msg = e.what();
+        }
+        CHECK(msg == "Impossible to set the expiration of a register variable, the 'write' and 'update' rights must be set to true.");
+    }
+
+}
@@ -0,0 +1,79 @@
+//!
+//! @file MapFile_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <tinyxml2.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <doctest.h>
+
+//!
+//! @brief Write a document, with a entity parsed in place.
+//! @param path Document location.
+//! @param size Document size, a pages size multiple puts the null terminator after the file pages.
+//! @return Value stored into the document.
+//!
+static std::string write(const std::string &path, std::size_t size)
+{
+    static const std::string    head = "<register><value>&amp;";
+    static const std::string    tail = "</value></register>";
+    std::string                 value(size - head.size() - tail.size(), 'v');
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << head << value << tail;
+    return ('&' + value);
+}
+
+TEST_CASE("tinyxml2::XMLDocument::MapFile")
+{
+
+    SUBCASE("Mapped and parsed in place.")
+    {
+        std::string             value = write("./map_file.xml", 4096);
+        tinyxml2::XMLDocument   document;
+
+        REQUIRE(document.MapFile("./map_file.xml") == tinyxml2::XML_SUCCESS);
+        CHECK(document.Mapped());
+        CHECK(document.MappedFileSize() == 4096);
+        REQUIRE(document.ParseMapped() == tinyxml2::XML_SUCCESS);
+        CHECK(document.FirstChildElement("register")->FirstChildElement("value")->GetText() == value);
+        std::filesystem::remove("./map_file.xml");
+        CHECK(document.FirstChildElement("register")->FirstChildElement("value")->GetText() == value);
+        document.Clear();
+        CHECK_FALSE(document.Mapped());
+        CHECK(document.MappedFileSize() == 0);
+    }
+
+    SUBCASE("Small files read.")
+    {
+        std::string             value = write("./map_file_small.xml", 100);
+        tinyxml2::XMLDocument   document;
+
+        REQUIRE(document.LoadFileMapped("./map_file_small.xml", 4096) == tinyxml2::XML_SUCCESS);
+        CHECK_FALSE(document.Mapped());
+        CHECK(document.MappedFileSize() == 100);
+        CHECK(document.FirstChildElement("register")->FirstChildElement("value")->GetText() == value);
+        REQUIRE(document.LoadFileMapped("./map_file_small.xml") == tinyxml2::XML_SUCCESS);
+        CHECK(document.Mapped());
+        CHECK(document.FirstChildElement("register")->FirstChildElement("value")->GetText() == value);
+        std::filesystem::remove("./map_file_small.xml");
+    }
+
+    SUBCASE("Errors.")
+    {
+        tinyxml2::XMLDocument   document;
+
+        CHECK(document.MapFile("./map_file_not_existing.xml") == tinyxml2::XML_ERROR_FILE_NOT_FOUND);
+        CHECK(document.ParseMapped() == tinyxml2::XML_ERROR_FILE_NOT_FOUND);
+        std::ofstream("./map_file_empty.xml", std::ios::trunc).close();
+        CHECK(document.LoadFileMapped("./map_file_empty.xml") == tinyxml2::XML_ERROR_EMPTY_DOCUMENT);
+        std::ofstream("./map_file_invalid.xml", std::ios::trunc) << "<register><value></register>";
+        CHECK(document.LoadFileMapped("./map_file_invalid.xml") == tinyxml2::XML_ERROR_MISMATCHED_ELEMENT);
+        CHECK(document.NoChildren());
+        std::filesystem::remove("./map_file_empty.xml");
+        std::filesystem::remove("./map_file_invalid.xml");
+    }
+
+}
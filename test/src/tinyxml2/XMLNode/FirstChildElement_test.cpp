@@ -0,0 +1,59 @@
+//!
+//! @file FirstChildElement_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <jbr/reg/node/Name.hpp>
+#include <tinyxml2.h>
+#include <cstring>
+#include <doctest.h>
+
+TEST_CASE("tinyxml2::XMLNode::FirstChildElement")
+{
+
+    SUBCASE("Parsed names.")
+    {
+        tinyxml2::XMLDocument   document;
+
+        REQUIRE(document.Parse("<variable><keys>a</keys><key>b</key><value>c</value><key>d</key></variable>") == tinyxml2::XML_SUCCESS);
+
+        const tinyxml2::XMLElement  *variable = document.FirstChildElement("variable", 8);
+
+        REQUIRE(variable != nullptr);
+        REQUIRE(variable->FirstChildElement("key", 3) != nullptr);
+        CHECK(std::strcmp(variable->FirstChildElement("key", 3)->GetText(), "b") == 0);
+        CHECK(std::strcmp(variable->FirstChildElement("key", 3)->NextSiblingElement("key", 3)->GetText(), "d") == 0);
+        CHECK(variable->FirstChildElement("key", 3)->NextSiblingElement("key", 3)->NextSiblingElement("key", 3) == nullptr);
+        CHECK(variable->FirstChildElement("ke", 2) == nullptr);
+        CHECK(variable->FirstChildElement("rights", 6) == nullptr);
+    }
+
+    SUBCASE("Created and interned names.")
+    {
+        static const char       interned[] = "value";
+        tinyxml2::XMLDocument   document;
+        tinyxml2::XMLElement    *variable = document.NewElement("variable");
+        tinyxml2::XMLElement    *value = document.NewElement("placeholder");
+
+        document.InsertEndChild(variable);
+        variable->InsertEndChild(document.NewElement("values"));
+        variable->InsertEndChild(value);
+        value->SetName(interned, true);
+        CHECK(variable->FirstChildElement("value", 5) == value);
+        CHECK(variable->FirstChildElement(interned, 5) == value);
+        CHECK(variable->FirstChildElement("values", 6) != nullptr);
+        CHECK(variable->FirstChildElement("valu", 4) == nullptr);
+    }
+
+    SUBCASE("Register node names.")
+    {
+        static_assert(jbr::reg::node::name::_body::_variable::expiration.size() == 10);
+        tinyxml2::XMLDocument   document;
+
+        REQUIRE(document.Parse("<register><header/><body/></register>") == tinyxml2::XML_SUCCESS);
+        REQUIRE(document.FirstChildElement(jbr::reg::node::name::reg.data(), jbr::reg::node::name::reg.size()) != nullptr);
+        CHECK(document.FirstChildElement(jbr::reg::node::name::reg.data(), jbr::reg::node::name::reg.size())
+                      ->FirstChildElement(jbr::reg::node::name::body.data(), jbr::reg::node::name::body.size()) != nullptr);
+    }
+}
@@ -0,0 +1,103 @@
+//!
+//! @file SetScanKernel_test.cpp
+//! @author jbruel
+//! @date 19/10/26
+//!
+
+#include <tinyxml2.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+
+//!
+//! @brief Parse a document and describe it : texts, attributes and line numbers of the elements.
+//! @param xml Document to parse.
+//! @return Document description, or the parsing error.
+//!
+static std::string describe(const std::string &xml)
+{
+    tinyxml2::XMLDocument           document;
+    std::string                     description;
+    std::vector<tinyxml2::XMLNode *> stack;
+
+    if (document.Parse(xml.data(), xml.size()) != tinyxml2::XML_SUCCESS)
+        return ("error " + std::to_string(document.ErrorID()) + " line " + std::to_string(document.ErrorLineNum()));
+    stack.push_back(document.FirstChild());
+    while (!stack.empty())
+    {
+        tinyxml2::XMLNode   *node = stack.back();
+
+        stack.pop_back();
+        if (node == nullptr)
+            continue;
+        stack.push_back(node->NextSibling());
+        stack.push_back(node->FirstChild());
+        description += '[' + std::string(node->Value() == nullptr ? "" : node->Value()) + ':' + std::to_string(node->GetLineNum());
+        if (const tinyxml2::XMLElement *element = node->ToElement(); element != nullptr)
+            for (const tinyxml2::XMLAttribute *attribute = element->FirstAttribute(); attribute != nullptr; attribute = attribute->Next())
+                description += ' ' + std::string(attribute->Name()) + '=' + attribute->Value();
+        description += ']';
+    }
+    return (description);
+}
+
+TEST_CASE("tinyxml2::XMLUtil::SetScanKernel")
+{
+    const std::string   indent(70, ' ');
+    const std::string   text(200, 't');
+    const std::vector<std::string>  documents{
+        "<?xml version=\"1.0\"?>\n<register>\n" + indent + "<variable>\n" + indent + "\t<key>" + text + "</key>\n" + indent + "</variable>\n</register>\n",
+        "<a>\r\n" + indent + "<b>line\r\nline\rline\n\rline" + text + "\r\n</b>\r\n</a>",
+        "<a x=\"&lt;" + text + "&amp;&#x41;&#66;&unknown;\" y='" + indent + "\r\n'>&quot;" + text + "&apos;&gt;" + text + "</a>",
+        "<a><!--" + indent + "\n\n-->\n<![CDATA[" + text + "\r\n" + text + "]]>\n\n\n<b/>" + indent + "\n</a>",
+        "<a>" + text + "<b>" + text,
+        indent + "\n\n" + indent,
+        "<a>" + std::string(31, ' ') + "</a>",
+        "<a>" + std::string(32, ' ') + "<b>" + std::string(33, 't') + "</b></a>"
+    };
+    std::vector<std::string>    expected;
+    tinyxml2::XMLUtil::ScanKernel   initial = tinyxml2::XMLUtil::GetScanKernel();
+
+    CHECK(tinyxml2::XMLUtil::SetScanKernel(tinyxml2::XMLUtil::SCAN_SCALAR) == tinyxml2::XMLUtil::SCAN_SCALAR);
+    for (const std::string &document : documents)
+        expected.push_back(describe(document));
+    CHECK(expected[0].find("[key:4]") != std::string::npos);
+    CHECK(expected[1].find("line\nline\nline\nline") != std::string::npos);
+    CHECK(expected[2].find("x=<" + text + "&AB&unknown;") != std::string::npos);
+    CHECK(expected[4].rfind("error", 0) == 0);
+
+    SUBCASE("Same parsing with all the kernels.")
+    {
+        for (tinyxml2::XMLUtil::ScanKernel kernel : { tinyxml2::XMLUtil::SCAN_SSE2, tinyxml2::XMLUtil::SCAN_AVX2 })
+        {
+            tinyxml2::XMLUtil::ScanKernel   selected = tinyxml2::XMLUtil::SetScanKernel(kernel);
+
+            CHECK(selected <= kernel);
+            CHECK(tinyxml2::XMLUtil::GetScanKernel() == selected);
+            for (std::size_t i = 0; i < documents.size(); ++i)
+                CHECK(describe(documents[i]) == expected[i]);
+        }
+    }
+
+    SUBCASE("Kernels changed while documents are parsed.")
+    {
+        std::atomic<bool>   stop{false};
+        std::size_t         mismatches = 0;
+        std::thread         parser([&]() {
+            do {
+                for (std::size_t i = 0; i < documents.size(); ++i)
+                    mismatches += describe(documents[i]) != expected[i];
+            } while (!stop);
+        });
+
+        for (std::size_t i = 0; i < 3000; ++i)
+            (void)tinyxml2::XMLUtil::SetScanKernel(static_cast<tinyxml2::XMLUtil::ScanKernel>(i % 3));
+        stop = true;
+        parser.join();
+        CHECK(mismatches == 0);
+    }
+
+    tinyxml2::XMLUtil::SetScanKernel(initial);
+}
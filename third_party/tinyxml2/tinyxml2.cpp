@@ -24,6 +24,7 @@ distribution.
 #include "tinyxml2.h"
 
 #include <new>		// yes, this one new style header, is in the Android SDK.
+#include <atomic>
 #if defined(ANDROID_NDK) || defined(__BORLANDC__) || defined(__QNXNTO__)
 #   include <stddef.h>
 #   include <stdarg.h>
@@ -32,6 +33,28 @@ distribution.
 #   include <cstdarg>
 #endif
 
+// Vectorized scanning kernels, SSE2 is part of the x86-64 baseline, AVX2 is selected at runtime.
+#if !defined(TINYXML2_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#   define TIXML_SSE2
+#   include <emmintrin.h>
+#   if defined(__GNUC__) || defined(__clang__)
+#       define TIXML_AVX2
+#       include <immintrin.h>
+#   endif
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   endif
+#endif
+
+// Private file mappings, for the in place parsing of MapFile().
+#if !defined(TINYXML2_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#   define TIXML_MMAP
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
 #if defined(_MSC_VER) && (_MSC_VER >= 1400 ) && (!defined WINCE)
 	// Microsoft Visual Studio, version 2005 and higher. Not WinCE.
 	/*int _snprintf_s(
@@ -135,6 +158,277 @@ static const Entity entities[NUM_ENTITIES] = {
 };
 
 
+// --------- Scanning kernels ----------- //
+
+/*
+	The parsing loops scan the document buffer byte per byte. The SSE2 and AVX2 kernels
+	scan it 16 or 32 bytes at a time. The unbounded kernels read up to TIXML_SCAN_PADDING
+	bytes from a position which is not after the buffer null terminator, so the document
+	buffers are allocated with this padding after the null terminator.
+*/
+static const size_t TIXML_SCAN_PADDING = 32;
+
+// Whitespaces of the "C" locale isspace().
+static inline bool IsScannedWhiteSpace( char c )
+{
+    return c == ' ' || static_cast<unsigned char>( c - '\t' ) <= static_cast<unsigned char>( '\r' - '\t' );
+}
+
+static const char* SkipWhiteSpaceScalar( const char* p, int* curLineNumPtr )
+{
+    while ( IsScannedWhiteSpace( *p ) ) {
+        if ( curLineNumPtr && *p == LF ) {
+            ++(*curLineNumPtr);
+        }
+        ++p;
+    }
+    return p;
+}
+
+// Find the first end character or null terminator, counting the new lines before it.
+static const char* FindDelimiterScalar( const char* p, char endChar, int* curLineNumPtr )
+{
+    while ( *p && *p != endChar ) {
+        if ( *p == LF ) {
+            ++(*curLineNumPtr);
+        }
+        ++p;
+    }
+    return p;
+}
+
+// Find the first character to normalize in [p, end): new lines and / or entities.
+static const char* FindSpecialScalar( const char* p, const char* end, bool newLines, bool entities )
+{
+    for ( ; p < end; ++p ) {
+        if ( ( newLines && ( *p == CR || *p == LF ) ) || ( entities && *p == '&' ) ) {
+            return p;
+        }
+    }
+    return end;
+}
+
+#ifdef TIXML_SSE2
+static inline int TrailingZeros( unsigned int mask )
+{
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward( &index, mask );
+    return static_cast<int>( index );
+#else
+    return __builtin_ctz( mask );
+#endif
+}
+
+static inline int PopCount( unsigned int mask )
+{
+#if defined(_MSC_VER)
+    mask = mask - ( ( mask >> 1 ) & 0x55555555u );
+    mask = ( mask & 0x33333333u ) + ( ( mask >> 2 ) & 0x33333333u );
+    return static_cast<int>( ( ( ( mask + ( mask >> 4 ) ) & 0x0F0F0F0Fu ) * 0x01010101u ) >> 24 );
+#else
+    return __builtin_popcount( mask );
+#endif
+}
+
+// Count the new lines marked in the mask, below a bit index.
+static inline void CountLines( unsigned int lines, int index, int* curLineNumPtr )
+{
+    if ( curLineNumPtr && lines ) {
+        *curLineNumPtr += PopCount( index < 32 ? lines & ( ( 1u << index ) - 1 ) : lines );
+    }
+}
+
+static const char* SkipWhiteSpaceSSE2( const char* p, int* curLineNumPtr )
+{
+    const __m128i space = _mm_set1_epi8( ' ' );
+    const __m128i tab = _mm_set1_epi8( '\t' );
+    const __m128i range = _mm_set1_epi8( '\r' - '\t' );
+    const __m128i lf = _mm_set1_epi8( LF );
+
+    for ( ;; ) {
+        const __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) );
+        const __m128i shifted = _mm_sub_epi8( c, tab );
+        const __m128i white = _mm_or_si128( _mm_cmpeq_epi8( c, space ), _mm_cmpeq_epi8( _mm_min_epu8( shifted, range ), shifted ) );
+        const unsigned int stop = ~static_cast<unsigned int>( _mm_movemask_epi8( white ) ) & 0xFFFFu;
+        const unsigned int lines = static_cast<unsigned int>( _mm_movemask_epi8( _mm_cmpeq_epi8( c, lf ) ) );
+
+        if ( stop ) {
+            const int index = TrailingZeros( stop );
+            CountLines( lines, index, curLineNumPtr );
+            return p + index;
+        }
+        CountLines( lines, 32, curLineNumPtr );
+        p += 16;
+    }
+}
+
+static const char* FindDelimiterSSE2( const char* p, char endChar, int* curLineNumPtr )
+{
+    const __m128i end = _mm_set1_epi8( endChar );
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lf = _mm_set1_epi8( LF );
+
+    for ( ;; ) {
+        const __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) );
+        const unsigned int stop = static_cast<unsigned int>( _mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( c, end ), _mm_cmpeq_epi8( c, zero ) ) ) );
+        const unsigned int lines = static_cast<unsigned int>( _mm_movemask_epi8( _mm_cmpeq_epi8( c, lf ) ) );
+
+        if ( stop ) {
+            const int index = TrailingZeros( stop );
+            CountLines( lines, index, curLineNumPtr );
+            return p + index;
+        }
+        CountLines( lines, 32, curLineNumPtr );
+        p += 16;
+    }
+}
+
+static const char* FindSpecialSSE2( const char* p, const char* end, bool newLines, bool entities )
+{
+    if ( !newLines && !entities ) {
+        return end;
+    }
+    const __m128i first = _mm_set1_epi8( entities ? '&' : CR );
+    const __m128i second = _mm_set1_epi8( newLines ? CR : '&' );
+    const __m128i third = _mm_set1_epi8( newLines ? LF : '&' );
+
+    while ( end - p >= 16 ) {
+        const __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) );
+        const __m128i found = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( c, first ), _mm_cmpeq_epi8( c, second ) ), _mm_cmpeq_epi8( c, third ) );
+        const unsigned int mask = static_cast<unsigned int>( _mm_movemask_epi8( found ) );
+
+        if ( mask ) {
+            return p + TrailingZeros( mask );
+        }
+        p += 16;
+    }
+    return FindSpecialScalar( p, end, newLines, entities );
+}
+#endif
+
+#ifdef TIXML_AVX2
+__attribute__(( target( "avx2" ) ))
+static const char* SkipWhiteSpaceAVX2( const char* p, int* curLineNumPtr )
+{
+    const __m256i space = _mm256_set1_epi8( ' ' );
+    const __m256i tab = _mm256_set1_epi8( '\t' );
+    const __m256i range = _mm256_set1_epi8( '\r' - '\t' );
+    const __m256i lf = _mm256_set1_epi8( LF );
+
+    for ( ;; ) {
+        const __m256i c = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p ) );
+        const __m256i shifted = _mm256_sub_epi8( c, tab );
+        const __m256i white = _mm256_or_si256( _mm256_cmpeq_epi8( c, space ), _mm256_cmpeq_epi8( _mm256_min_epu8( shifted, range ), shifted ) );
+        const unsigned int stop = ~static_cast<unsigned int>( _mm256_movemask_epi8( white ) );
+        const unsigned int lines = static_cast<unsigned int>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( c, lf ) ) );
+
+        if ( stop ) {
+            const int index = TrailingZeros( stop );
+            CountLines( lines, index, curLineNumPtr );
+            return p + index;
+        }
+        CountLines( lines, 32, curLineNumPtr );
+        p += 32;
+    }
+}
+
+__attribute__(( target( "avx2" ) ))
+static const char* FindDelimiterAVX2( const char* p, char endChar, int* curLineNumPtr )
+{
+    const __m256i end = _mm256_set1_epi8( endChar );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lf = _mm256_set1_epi8( LF );
+
+    for ( ;; ) {
+        const __m256i c = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p ) );
+        const unsigned int stop = static_cast<unsigned int>( _mm256_movemask_epi8( _mm256_or_si256( _mm256_cmpeq_epi8( c, end ), _mm256_cmpeq_epi8( c, zero ) ) ) );
+        const unsigned int lines = static_cast<unsigned int>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( c, lf ) ) );
+
+        if ( stop ) {
+            const int index = TrailingZeros( stop );
+            CountLines( lines, index, curLineNumPtr );
+            return p + index;
+        }
+        CountLines( lines, 32, curLineNumPtr );
+        p += 32;
+    }
+}
+
+__attribute__(( target( "avx2" ) ))
+static const char* FindSpecialAVX2( const char* p, const char* end, bool newLines, bool entities )
+{
+    if ( !newLines && !entities ) {
+        return end;
+    }
+    const __m256i first = _mm256_set1_epi8( entities ? '&' : CR );
+    const __m256i second = _mm256_set1_epi8( newLines ? CR : '&' );
+    const __m256i third = _mm256_set1_epi8( newLines ? LF : '&' );
+
+    while ( end - p >= 32 ) {
+        const __m256i c = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p ) );
+        const __m256i found = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( c, first ), _mm256_cmpeq_epi8( c, second ) ), _mm256_cmpeq_epi8( c, third ) );
+        const unsigned int mask = static_cast<unsigned int>( _mm256_movemask_epi8( found ) );
+
+        if ( mask ) {
+            return p + TrailingZeros( mask );
+        }
+        p += 32;
+    }
+    return FindSpecialSSE2( p, end, newLines, entities );
+}
+#endif
+
+struct ScanKernels {
+    XMLUtil::ScanKernel kernel;
+    const char* (*skipWhiteSpace)( const char* p, int* curLineNumPtr );
+    const char* (*findDelimiter)( const char* p, char endChar, int* curLineNumPtr );
+    const char* (*findSpecial)( const char* p, const char* end, bool newLines, bool entities );
+};
+
+static const ScanKernels scalarKernels = { XMLUtil::SCAN_SCALAR, SkipWhiteSpaceScalar, FindDelimiterScalar, FindSpecialScalar };
+#ifdef TIXML_SSE2
+static const ScanKernels sse2Kernels = { XMLUtil::SCAN_SSE2, SkipWhiteSpaceSSE2, FindDelimiterSSE2, FindSpecialSSE2 };
+#endif
+#ifdef TIXML_AVX2
+static const ScanKernels avx2Kernels = { XMLUtil::SCAN_AVX2, SkipWhiteSpaceAVX2, FindDelimiterAVX2, FindSpecialAVX2 };
+#endif
+
+// Selected kernels, scalar until the CPU features are detected. Loaded once by each scan, the
+// kernels can be changed while documents are parsed.
+static std::atomic<const ScanKernels*> scanKernels( &scalarKernels );
+
+static XMLUtil::ScanKernel FastestScanKernel()
+{
+#if defined(TIXML_AVX2)
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        return XMLUtil::SCAN_AVX2;
+    }
+#endif
+#if defined(TIXML_SSE2)
+    return XMLUtil::SCAN_SSE2;
+#else
+    return XMLUtil::SCAN_SCALAR;
+#endif
+}
+
+static struct ScanKernelsSelector {
+    ScanKernelsSelector() {
+        XMLUtil::SetScanKernel( FastestScanKernel() );
+    }
+} scanKernelsSelector;
+
+// Skip the whitespaces of the padded document buffer.
+static inline char* SkipParsedWhiteSpace( char* p, int* curLineNumPtr )
+{
+    if ( !IsScannedWhiteSpace( *p ) ) {
+        return p;
+    }
+    return const_cast<char*>( scanKernels.load( std::memory_order_relaxed )->skipWhiteSpace( p, curLineNumPtr ) );
+}
+
+
 StrPair::~StrPair()
 {
     Reset();
@@ -199,19 +493,20 @@ char* StrPair::ParseText( char* p, const char* endTag, int strFlags, int* curLin
     char* start = p;
     const char  endChar = *endTag;
     size_t length = strlen( endTag );
+    const ScanKernels* kernels = scanKernels.load( std::memory_order_relaxed );
 
     // Inner loop of text parsing.
-    while ( *p ) {
-        if ( *p == endChar && strncmp( p, endTag, length ) == 0 ) {
+    for ( ;; ) {
+        p = const_cast<char*>( kernels->findDelimiter( p, endChar, curLineNumPtr ) );
+        if ( !*p ) {
+            return 0;
+        }
+        if ( strncmp( p, endTag, length ) == 0 ) {
             Set( start, p, strFlags );
             return p + length;
-        } else if (*p == '\n') {
-            ++(*curLineNumPtr);
         }
         ++p;
-        TIXMLASSERT( p );
     }
-    return 0;
 }
 
 
@@ -275,8 +570,21 @@ const char* StrPair::GetStr()
         if ( _flags ) {
             const char* p = _start;	// the read pointer
             char* q = _start;	// the write pointer
+            const bool newLines = ( _flags & NEEDS_NEWLINE_NORMALIZATION ) != 0;
+            const bool processEntities = ( _flags & NEEDS_ENTITY_PROCESSING ) != 0;
+            const ScanKernels* kernels = scanKernels.load( std::memory_order_relaxed );
 
             while( p < _end ) {
+                // Move the run of characters kept as is.
+                const char* special = kernels->findSpecial( p, _end, newLines, processEntities );
+                if ( special != p ) {
+                    if ( q != p ) {
+                        memmove( q, p, special - p );
+                    }
+                    q += special - p;
+                    p = special;
+                    continue;
+                }
                 if ( (_flags & NEEDS_NEWLINE_NORMALIZATION) && *p == CR ) {
                     // CR-LF pair becomes LF
                     // CR alone becomes LF
@@ -352,11 +660,13 @@ const char* StrPair::GetStr()
                 }
             }
             *q = 0;
+            _end = q;
         }
         // The loop below has plenty going on, and this
         // is a less useful mode. Break it out.
         if ( _flags & NEEDS_WHITESPACE_COLLAPSING ) {
             CollapseWhitespace();
+            _end = _start + strlen( _start );
         }
         _flags = (_flags & NEEDS_DELETE);
     }
@@ -367,6 +677,23 @@ const char* StrPair::GetStr()
 
 
 
+bool StrPair::Equals( const char* str, size_t length )
+{
+    const char* start = GetStr();
+
+    if ( start == str ) {
+        return true;
+    }
+    if ( !_end ) {
+        // Interned string, its length is unknown.
+        return strncmp( start, str, length ) == 0 && start[length] == 0;
+    }
+    return static_cast<size_t>( _end - start ) == length && memcmp( start, str, length ) == 0;
+}
+
+
+
+
 // --------- XMLUtil ----------- //
 
 const char* XMLUtil::writeBoolTrue  = "true";
@@ -382,6 +709,39 @@ void XMLUtil::SetBoolSerialization(const char* writeTrue, const char* writeFalse
 }
 
 
+XMLUtil::ScanKernel XMLUtil::SetScanKernel( ScanKernel kernel )
+{
+    const ScanKernel fastest = FastestScanKernel();
+    const ScanKernels* kernels = &scalarKernels;
+
+    if ( kernel > fastest ) {
+        kernel = fastest;
+    }
+    switch ( kernel ) {
+#ifdef TIXML_AVX2
+        case SCAN_AVX2:
+            kernels = &avx2Kernels;
+            break;
+#endif
+#ifdef TIXML_SSE2
+        case SCAN_SSE2:
+            kernels = &sse2Kernels;
+            break;
+#endif
+        default:
+            break;
+    }
+    scanKernels.store( kernels, std::memory_order_relaxed );
+    return kernels->kernel;
+}
+
+
+XMLUtil::ScanKernel XMLUtil::GetScanKernel()
+{
+    return scanKernels.load( std::memory_order_relaxed )->kernel;
+}
+
+
 const char* XMLUtil::ReadBOM( const char* p, bool* bom )
 {
     TIXMLASSERT( p );
@@ -659,7 +1019,7 @@ char* XMLDocument::Identify( char* p, XMLNode** node )
     TIXMLASSERT( p );
     char* const start = p;
     int const startLine = _parseCurLineNum;
-    p = XMLUtil::SkipWhiteSpace( p, &_parseCurLineNum );
+    p = SkipParsedWhiteSpace( p, &_parseCurLineNum );
     if( !*p ) {
         *node = 0;
         TIXMLASSERT( p );
@@ -949,6 +1309,18 @@ const XMLElement* XMLNode::FirstChildElement( const char* name ) const
 }
 
 
+const XMLElement* XMLNode::FirstChildElement( const char* name, size_t length ) const
+{
+    for( const XMLNode* node = _firstChild; node; node = node->_next ) {
+        const XMLElement* element = node->ToElementWithName( name, length );
+        if ( element ) {
+            return element;
+        }
+    }
+    return 0;
+}
+
+
 const XMLElement* XMLNode::LastChildElement( const char* name ) const
 {
     for( const XMLNode* node = _lastChild; node; node = node->_prev ) {
@@ -973,6 +1345,18 @@ const XMLElement* XMLNode::NextSiblingElement( const char* name ) const
 }
 
 
+const XMLElement* XMLNode::NextSiblingElement( const char* name, size_t length ) const
+{
+    for( const XMLNode* node = _next; node; node = node->_next ) {
+        const XMLElement* element = node->ToElementWithName( name, length );
+        if ( element ) {
+            return element;
+        }
+    }
+    return 0;
+}
+
+
 const XMLElement* XMLNode::PreviousSiblingElement( const char* name ) const
 {
     for( const XMLNode* node = _prev; node; node = node->_prev ) {
@@ -1143,6 +1527,15 @@ const XMLElement* XMLNode::ToElementWithName( const char* name ) const
     return 0;
 }
 
+const XMLElement* XMLNode::ToElementWithName( const char* name, size_t length ) const
+{
+    const XMLElement* element = this->ToElement();
+    if ( element == 0 || !element->_value.Equals( name, length ) ) {
+        return 0;
+    }
+    return element;
+}
+
 // --------- XMLText ---------- //
 char* XMLText::ParseDeep( char* p, StrPair*, int* curLineNumPtr )
 {
@@ -1362,13 +1755,13 @@ char* XMLAttribute::ParseDeep( char* p, bool processEntities, int* curLineNumPtr
     }
 
     // Skip white space before =
-    p = XMLUtil::SkipWhiteSpace( p, curLineNumPtr );
+    p = SkipParsedWhiteSpace( p, curLineNumPtr );
     if ( *p != '=' ) {
         return 0;
     }
 
     ++p;	// move up to opening quote
-    p = XMLUtil::SkipWhiteSpace( p, curLineNumPtr );
+    p = SkipParsedWhiteSpace( p, curLineNumPtr );
     if ( *p != '\"' && *p != '\'' ) {
         return 0;
     }
@@ -1818,7 +2211,7 @@ char* XMLElement::ParseAttributes( char* p, int* curLineNumPtr )
 
     // Read the attributes.
     while( p ) {
-        p = XMLUtil::SkipWhiteSpace( p, curLineNumPtr );
+        p = SkipParsedWhiteSpace( p, curLineNumPtr );
         if ( !(*p) ) {
             _document->SetError( XML_ERROR_PARSING_ELEMENT, _parseLineNum, "XMLElement name=%s", Name() );
             return 0;
@@ -1898,7 +2291,7 @@ XMLAttribute* XMLElement::CreateAttribute()
 char* XMLElement::ParseDeep( char* p, StrPair* parentEndTag, int* curLineNumPtr )
 {
     // Read the element name.
-    p = XMLUtil::SkipWhiteSpace( p, curLineNumPtr );
+    p = SkipParsedWhiteSpace( p, curLineNumPtr );
 
     // The closing element is the </element> form. It is
     // parsed just like a regular element then deleted from
@@ -2012,6 +2405,10 @@ XMLDocument::XMLDocument( bool processEntities, Whitespace whitespaceMode ) :
     _errorStr(),
     _errorLineNum( 0 ),
     _charBuffer( 0 ),
+    _charBufferSize( 0 ),
+    _mappedBuffer( 0 ),
+    _mappingSize( 0 ),
+    _mappedFileSize( 0 ),
     _parseCurLineNum( 0 ),
 	_parsingDepth(0),
     _unlinked(),
@@ -2028,6 +2425,7 @@ XMLDocument::XMLDocument( bool processEntities, Whitespace whitespaceMode ) :
 XMLDocument::~XMLDocument()
 {
     Clear();
+    delete [] _charBuffer;
 }
 
 
@@ -2056,8 +2454,8 @@ void XMLDocument::Clear()
 #endif
     ClearError();
 
-    delete [] _charBuffer;
-    _charBuffer = 0;
+    // The character buffer is kept for the next parsing, the mapping is not.
+    Unmap();
 	_parsingDepth = 0;
 
 #if 0
@@ -2078,6 +2476,62 @@ void XMLDocument::Clear()
 }
 
 
+void XMLDocument::ReleaseMemory()
+{
+    Clear();
+    delete [] _charBuffer;
+    _charBuffer = 0;
+    _charBufferSize = 0;
+    _elementPool.Clear();
+    _attributePool.Clear();
+    _textPool.Clear();
+    _commentPool.Clear();
+}
+
+
+void XMLDocument::SetPoolBlockSize( size_t bytes )
+{
+    _elementPool.SetBlockSize( bytes );
+    _attributePool.SetBlockSize( bytes );
+    _textPool.SetBlockSize( bytes );
+    _commentPool.SetBlockSize( bytes );
+}
+
+
+size_t XMLDocument::PoolBytes() const
+{
+    return _elementPool.BlockBytes() + _attributePool.BlockBytes() + _textPool.BlockBytes() + _commentPool.BlockBytes();
+}
+
+
+void XMLDocument::ReserveCharBuffer( size_t size )
+{
+    const size_t required = size + 1 + TIXML_SCAN_PADDING;
+
+    if ( _charBufferSize < required ) {
+        delete [] _charBuffer;
+        _charBuffer = 0;
+        _charBufferSize = 0;
+        _charBuffer = new char[required];
+        _charBufferSize = required;
+    }
+    memset( _charBuffer + size, 0, 1 + TIXML_SCAN_PADDING );
+}
+
+
+void XMLDocument::Unmap()
+{
+#ifdef TIXML_MMAP
+    if ( _mappedBuffer ) {
+        munmap( _mappedBuffer, _mappingSize );
+    }
+#endif
+    _mappedBuffer = 0;
+    _mappingSize = 0;
+    _mappedFileSize = 0;
+}
+
+
 void XMLDocument::DeepCopy(XMLDocument* target) const
 {
 	TIXMLASSERT(target);
@@ -2237,8 +2691,7 @@ XMLError XMLDocument::LoadFile( FILE* fp )
     }
 
     const size_t size = filelength;
-    TIXMLASSERT( _charBuffer == 0 );
-    _charBuffer = new char[size+1];
+    ReserveCharBuffer( size );
     const size_t read = fread( _charBuffer, 1, size, fp );
     if ( read != size ) {
         SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
@@ -2252,6 +2705,138 @@ XMLError XMLDocument::LoadFile( FILE* fp )
 }
 
 
+XMLError XMLDocument::MapFile( const char* filename, size_t minMapSize )
+{
+    Clear();
+    if ( !filename ) {
+        TIXMLASSERT( false );
+        SetError( XML_ERROR_FILE_COULD_NOT_BE_OPENED, 0, "filename=<null>" );
+        return _errorID;
+    }
+
+#ifdef TIXML_MMAP
+    const int fd = open( filename, O_RDONLY | O_CLOEXEC );
+    if ( fd < 0 ) {
+        SetError( XML_ERROR_FILE_NOT_FOUND, 0, "filename=%s", filename );
+        return _errorID;
+    }
+    struct stat status;
+    if ( fstat( fd, &status ) != 0 || status.st_size < 0 ) {
+        close( fd );
+        SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+        return _errorID;
+    }
+    const size_t size = static_cast<size_t>( status.st_size );
+    if ( size == 0 ) {
+        close( fd );
+        SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
+        return _errorID;
+    }
+
+    if ( size < minMapSize ) {
+        ReserveCharBuffer( size );
+        size_t read = 0;
+        while ( read < size ) {
+            const ssize_t count = ::read( fd, _charBuffer + read, size - read );
+            if ( count <= 0 ) {
+                break;
+            }
+            read += static_cast<size_t>( count );
+        }
+        close( fd );
+        if ( read != size ) {
+            SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+            return _errorID;
+        }
+        _mappedFileSize = size;
+        return _errorID;
+    }
+
+    // The padding and null terminator come from a anonymous mapping reserved
+    // after the file pages. The file is populated read only, so the pages are
+    // shared with the page cache until the parsing writes them.
+    const size_t page = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+    const size_t mappingSize = ( size + 1 + TIXML_SCAN_PADDING + page - 1 ) / page * page;
+    void* const mapping = mmap( 0, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( mapping == MAP_FAILED ) {
+        close( fd );
+        SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+        return _errorID;
+    }
+    int flags = MAP_PRIVATE | MAP_FIXED;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+    if ( mmap( mapping, size, PROT_READ, flags, fd, 0 ) == MAP_FAILED
+         || mprotect( mapping, size, PROT_READ | PROT_WRITE ) != 0 ) {
+        munmap( mapping, mappingSize );
+        close( fd );
+        SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+        return _errorID;
+    }
+    close( fd );
+    _mappedBuffer = static_cast<char*>( mapping );
+    _mappingSize = mappingSize;
+    _mappedFileSize = size;
+    memset( _mappedBuffer + size, 0, 1 + TIXML_SCAN_PADDING );
+    return _errorID;
+#else
+    (void)minMapSize;
+    FILE* fp = callfopen( filename, "rb" );
+    if ( !fp ) {
+        SetError( XML_ERROR_FILE_NOT_FOUND, 0, "filename=%s", filename );
+        return _errorID;
+    }
+    fseek( fp, 0, SEEK_END );
+    const long filelength = ftell( fp );
+    fseek( fp, 0, SEEK_SET );
+    if ( filelength == -1L || !LongFitsIntoSizeTMinusOne<>::Fits( filelength ) ) {
+        fclose( fp );
+        SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+        return _errorID;
+    }
+    if ( filelength == 0 ) {
+        fclose( fp );
+        SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
+        return _errorID;
+    }
+    const size_t size = filelength;
+    ReserveCharBuffer( size );
+    const size_t read = fread( _charBuffer, 1, size, fp );
+    fclose( fp );
+    if ( read != size ) {
+        SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
+        return _errorID;
+    }
+    _mappedFileSize = size;
+    return _errorID;
+#endif
+}
+
+
+XMLError XMLDocument::ParseMapped()
+{
+    if ( Error() ) {
+        return _errorID;
+    }
+    if ( !_mappedFileSize || !NoChildren() ) {
+        SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
+        return _errorID;
+    }
+
+    Parse();
+    if ( Error() ) {
+        // Same clean up than Parse( const char*, size_t ).
+        DeleteChildren();
+        _elementPool.Clear();
+        _attributePool.Clear();
+        _textPool.Clear();
+        _commentPool.Clear();
+    }
+    return _errorID;
+}
+
+
 XMLError XMLDocument::SaveFile( const char* filename, bool compact )
 {
     if ( !filename ) {
@@ -2293,10 +2878,8 @@ XMLError XMLDocument::Parse( const char* p, size_t len )
     if ( len == (size_t)(-1) ) {
         len = strlen( p );
     }
-    TIXMLASSERT( _charBuffer == 0 );
-    _charBuffer = new char[ len+1 ];
+    ReserveCharBuffer( len );
     memcpy( _charBuffer, p, len );
-    _charBuffer[len] = 0;
 
     Parse();
     if ( Error() ) {
@@ -2380,11 +2963,11 @@ const char* XMLDocument::ErrorName() const
 void XMLDocument::Parse()
 {
     TIXMLASSERT( NoChildren() ); // Clear() must have been called previously
-    TIXMLASSERT( _charBuffer );
+    TIXMLASSERT( _mappedBuffer || _charBuffer );
     _parseCurLineNum = 1;
     _parseLineNum = 1;
-    char* p = _charBuffer;
-    p = XMLUtil::SkipWhiteSpace( p, &_parseCurLineNum );
+    char* p = _mappedBuffer ? _mappedBuffer : _charBuffer;
+    p = SkipParsedWhiteSpace( p, &_parseCurLineNum );
     p = const_cast<char*>( XMLUtil::ReadBOM( p, &_writeBOM ) );
     if ( !*p ) {
         SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
@@ -162,10 +162,23 @@ public:
 
     const char* GetStr();
 
+    // The characters as parsed, entities and new lines not processed, while GetStr() has not been called.
+    bool GetRaw( const char** start, size_t* length ) const {
+        if ( !( _flags & NEEDS_FLUSH ) || ( _flags & NEEDS_WHITESPACE_COLLAPSING ) ) {
+            return false;
+        }
+        *start = _start;
+        *length = _end - _start;
+        return true;
+    }
+
     bool Empty() const {
         return _start == _end;
     }
 
+    // Compare to a string of known length, the lengths first then the characters, without scanning for the terminators.
+    bool Equals( const char* str, size_t length );
+
     void SetInternedStr( const char* str ) {
         Reset();
         _start = const_cast<char*>(str);
@@ -346,7 +359,7 @@ template< int ITEM_SIZE >
 class MemPoolT : public MemPool
 {
 public:
-    MemPoolT() : _blockPtrs(), _root(0), _currentAllocs(0), _nAllocs(0), _maxAllocs(0), _nUntracked(0)	{}
+    MemPoolT() : _blockPtrs(), _root(0), _currentAllocs(0), _nAllocs(0), _maxAllocs(0), _nUntracked(0), _itemsPerBlock(ITEMS_PER_BLOCK), _blockBytes(0)	{}
     ~MemPoolT() {
         MemPoolT< ITEM_SIZE >::Clear();
     }
@@ -354,14 +367,24 @@ public:
     void Clear() {
         // Delete the blocks.
         while( !_blockPtrs.Empty()) {
-            Block* lastBlock = _blockPtrs.Pop();
-            delete lastBlock;
+            Item* lastBlock = _blockPtrs.Pop();
+            delete [] lastBlock;
         }
         _root = 0;
         _currentAllocs = 0;
         _nAllocs = 0;
         _maxAllocs = 0;
         _nUntracked = 0;
+        _blockBytes = 0;
+    }
+
+    // Size of the blocks allocated from now, 4k by default. The existing blocks are kept.
+    void SetBlockSize( size_t bytes ) {
+        _itemsPerBlock = bytes / ITEM_SIZE > 0 ? static_cast<int>( bytes / ITEM_SIZE ) : 1;
+    }
+    // Bytes of the allocated blocks, used or not.
+    size_t BlockBytes() const {
+        return _blockBytes;
     }
 
     virtual int ItemSize() const	{
@@ -374,14 +397,14 @@ public:
     virtual void* Alloc() {
         if ( !_root ) {
             // Need a new block.
-            Block* block = new Block();
-            _blockPtrs.Push( block );
+            Item* blockItems = new Item[_itemsPerBlock];
+            _blockPtrs.Push( blockItems );
+            _blockBytes += _itemsPerBlock * sizeof( Item );
 
-            Item* blockItems = block->items;
-            for( int i = 0; i < ITEMS_PER_BLOCK - 1; ++i ) {
+            for( int i = 0; i < _itemsPerBlock - 1; ++i ) {
                 blockItems[i].next = &(blockItems[i + 1]);
             }
-            blockItems[ITEMS_PER_BLOCK - 1].next = 0;
+            blockItems[_itemsPerBlock - 1].next = 0;
             _root = blockItems;
         }
         Item* const result = _root;
@@ -433,7 +456,7 @@ public:
 	//		32k:	4300
 	//		64k:	4000	21000
     // Declared public because some compilers do not accept to use ITEMS_PER_BLOCK
-    // in private part if ITEMS_PER_BLOCK is private
+    // in private part if ITEMS_PER_BLOCK is private. Default number of items per block.
     enum { ITEMS_PER_BLOCK = (4 * 1024) / ITEM_SIZE };
 
 private:
@@ -444,16 +467,15 @@ private:
         Item*   next;
         char    itemData[ITEM_SIZE];
     };
-    struct Block {
-        Item items[ITEMS_PER_BLOCK];
-    };
-    DynArray< Block*, 10 > _blockPtrs;
+    DynArray< Item*, 10 > _blockPtrs;
     Item* _root;
 
     int _currentAllocs;
     int _nAllocs;
     int _maxAllocs;
     int _nUntracked;
+    int _itemsPerBlock;
+    size_t _blockBytes;
 };
 
 
@@ -626,6 +648,24 @@ public:
     static bool ToDouble( const char* str, double* value );
 	static bool ToInt64(const char* str, int64_t* value);
 
+    // Kernels scanning the document buffer while parsing: whitespaces, text delimiters,
+    // entities and new lines to normalize.
+    enum ScanKernel {
+        SCAN_SCALAR = 0,
+        SCAN_SSE2,
+        SCAN_AVX2
+    };
+
+    /**
+        Select the kernel scanning the document buffers while parsing. By default the fastest
+        kernel supported by the CPU is selected. Returns the selected kernel: the requested one,
+        or the fastest supported one below it. Mainly useful to compare the kernels.
+        Static & global. Thread safe: each scan of a document parsed meanwhile uses either kernel.
+    */
+    static ScanKernel SetScanKernel( ScanKernel kernel );
+    /// Return the kernel scanning the document buffers while parsing.
+    static ScanKernel GetScanKernel();
+
 	// Changes what is serialized for a boolean value.
 	// Default to "true" and "false". Shouldn't be changed
 	// unless you have a special testing or compatibility need.
@@ -736,6 +776,15 @@ public:
     */
     const char* Value() const;
 
+    /** The value as parsed, entities and new lines not processed,
+    	if Value() has not been called since the parsing. Written
+    	back as is, it gives the text of the parsed document.
+    	Returns false if the value is not available as parsed.
+    */
+    bool RawValue( const char** value, size_t* length ) const {
+        return _value.GetRaw( value, length );
+    }
+
     /** Set the Value of an XML node.
     	@sa Value()
     */
@@ -776,6 +825,15 @@ public:
         return const_cast<XMLElement*>(const_cast<const XMLNode*>(this)->FirstChildElement( name ));
     }
 
+    /** Get the first child element with the specified name, of known
+        length. The siblings names are compared by length first.
+    */
+    const XMLElement* FirstChildElement( const char* name, size_t length ) const;
+
+    XMLElement* FirstChildElement( const char* name, size_t length )	{
+        return const_cast<XMLElement*>(const_cast<const XMLNode*>(this)->FirstChildElement( name, length ));
+    }
+
     /// Get the last child node, or null if none exists.
     const XMLNode*	LastChild() const						{
         return _lastChild;
@@ -826,6 +884,13 @@ public:
         return const_cast<XMLElement*>(const_cast<const XMLNode*>(this)->NextSiblingElement( name ) );
     }
 
+    /// Get the next (right) sibling element of this node with the specified name, of known length.
+    const XMLElement*	NextSiblingElement( const char* name, size_t length ) const;
+
+    XMLElement*	NextSiblingElement( const char* name, size_t length )	{
+        return const_cast<XMLElement*>(const_cast<const XMLNode*>(this)->NextSiblingElement( name, length ) );
+    }
+
     /**
     	Add a child node as the last (right) child.
 		If the child node is already part of the document,
@@ -963,6 +1028,7 @@ private:
     static void DeleteNode( XMLNode* node );
     void InsertChildPreamble( XMLNode* insertThis ) const;
     const XMLElement* ToElementWithName( const char* name ) const;
+    const XMLElement* ToElementWithName( const char* name, size_t length ) const;
 
     XMLNode( const XMLNode& );	// not supported
     XMLNode& operator=( const XMLNode& );	// not supported
@@ -1706,6 +1772,47 @@ public:
     */
     XMLError LoadFile( FILE* );
 
+    /**
+    	Load a file to be parsed in place by ParseMapped(), without copy.
+    	On POSIX systems, a file of at least minMapSize bytes is
+    	mapped private and copy-on-write (mmap MAP_PRIVATE): the page
+    	cache backs the buffer, only the pages modified by the
+    	parsing are copied. The file must not be truncated while
+    	the document is loaded, replace it by a rename instead.
+    	Smaller files, or all the files on other systems, are read
+    	into the character buffer.
+
+    	Returns XML_SUCCESS (0) on success, or
+    	an errorID.
+    */
+    XMLError MapFile( const char* filename, size_t minMapSize = 0 );
+
+    /**
+    	Parse in place the file loaded by MapFile().
+
+    	Returns XML_SUCCESS (0) on success, or
+    	an errorID.
+    */
+    XMLError ParseMapped();
+
+    /// Load with MapFile() then parse a file in place.
+    XMLError LoadFileMapped( const char* filename, size_t minMapSize = 0 ) {
+        if ( MapFile( filename, minMapSize ) == XML_SUCCESS ) {
+            ParseMapped();
+        }
+        return _errorID;
+    }
+
+    /// Size of the file loaded by MapFile(), 0 if none.
+    size_t MappedFileSize() const {
+        return _mappedFileSize;
+    }
+
+    /// True if the file loaded by MapFile() is memory mapped.
+    bool Mapped() const {
+        return _mappedBuffer != 0;
+    }
+
     /**
     	Save the XML file to disk.
     	Returns XML_SUCCESS (0) on success, or
@@ -1840,9 +1947,28 @@ public:
         return _errorLineNum;
     }
 
-    /// Clear the document, resetting it to the initial state.
+    /** Clear the document, resetting it to the initial state.
+        The pools blocks and the character buffer are kept,
+        to be reused by the next parsing. See ReleaseMemory().
+    */
     void Clear();
 
+    /// Clear the document and free the kept pools blocks and character buffer.
+    void ReleaseMemory();
+
+    /** Set the size of the pools blocks allocated from now, 4k by default.
+        Larger blocks do fewer allocations while parsing large documents.
+    */
+    void SetPoolBlockSize( size_t bytes );
+
+    /// Bytes allocated by the pools blocks, used or kept for reuse.
+    size_t PoolBytes() const;
+
+    /// Bytes allocated by the character buffer, used or kept for reuse.
+    size_t CharBufferBytes() const {
+        return _charBufferSize;
+    }
+
 	/**
 		Copies this document to a target document.
 		The target will be completely cleared before the copy.
@@ -1876,6 +2002,10 @@ private:
     mutable StrPair	_errorStr;
     int             _errorLineNum;
     char*			_charBuffer;
+    size_t			_charBufferSize;
+    char*			_mappedBuffer;
+    size_t			_mappingSize;
+    size_t			_mappedFileSize;
     int				_parseCurLineNum;
 	int				_parsingDepth;
 	// Memory tracking does add some overhead.
@@ -1894,6 +2024,10 @@ private:
 	static const char* _errorNames[XML_ERROR_COUNT];
 
     void Parse();
+    // Make the character buffer large enough for a document of this size, padded and null terminated.
+    void ReserveCharBuffer( size_t size );
+    // Unmap the buffer of the last MapFile().
+    void Unmap();
 
     void SetError( XMLError error, int lineNum, const char* format, ... );
 